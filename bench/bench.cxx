@@ -0,0 +1,126 @@
+#include "bench.hxx"
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string_view>
+
+using StormByte::Database::Database;
+using StormByte::Database::ExpectedRows;
+using StormByte::Database::Statement;
+
+namespace Bench {
+	std::atomic<std::size_t> allocations{0};
+	std::atomic<std::size_t> allocated_bytes{0};
+	volatile std::size_t sink = 0;
+
+	void Report(const char* name, double ns, std::size_t ops, std::size_t allocs, std::size_t bytes) {
+		std::printf("%-44s %10.1f ns/op %8.2f allocs/op %10.1f bytes/op\n", name, ns / ops,
+			static_cast<double>(allocs) / ops, static_cast<double>(bytes) / ops);
+	}
+
+	std::string Env(const char* name, const char* fallback) {
+		const char* value = std::getenv(name);
+		return value && *value ? value : fallback;
+	}
+
+	std::shared_ptr<StormByte::Logger::Log> Logger() {
+		static auto logger = std::make_shared<StormByte::Logger::Log>(std::cerr, StormByte::Logger::Level::Error);
+		return logger;
+	}
+
+	namespace {
+		/**
+		 * Aborts the benchmark on a failed statement.
+		 */
+		const StormByte::Database::Rows& Check(const ExpectedRows& rows, const std::string& what) {
+			if (!rows) {
+				std::cerr << what << ": " << rows.error()->what() << std::endl;
+				std::exit(1);
+			}
+			return *rows;
+		}
+
+		template<typename F>
+		void Lookups(const char* name, long int keys, std::size_t count, F&& execute) {
+			std::size_t allocs = 0, bytes = 0, found = 0;
+			const double ns = Best(5, [&] {
+				AllocationScope scope;
+				for (std::size_t i = 0; i < count; ++i)
+					found += Check(execute(static_cast<std::int64_t>(i % keys) + 1), name).Count();
+				allocs = scope.Count();
+				bytes = scope.Bytes();
+			});
+			sink = found;
+			Report(name, ns, count, allocs, bytes);
+		}
+	}
+
+	void PointLookup(Database& db, const char* name, const std::string& stmt, long int keys, std::size_t count) {
+		Lookups(name, keys, count, [&](std::int64_t key) {
+			return db.ExecuteSTMT(stmt, key);
+		});
+	}
+
+	void HandleLookup(const char* name, const Statement<std::int64_t>& stmt, long int keys, std::size_t count) {
+		Lookups(name, keys, count, [&](std::int64_t key) {
+			return stmt.Execute(key);
+		});
+	}
+
+	void Insert(Database& db, const char* name, const std::string& stmt, std::size_t count) {
+		constexpr std::string_view label = "inserted row";
+		std::size_t allocs = 0, bytes = 0;
+		const double ns = Best(5, [&] {
+			// Never committed: the destructor rolls the inserts back
+			auto transaction = db.BeginTransaction();
+			AllocationScope scope;
+			for (std::size_t i = 0; i < count; ++i)
+				Check(db.ExecuteSTMT(stmt, static_cast<std::int64_t>(i), static_cast<double>(i) * 0.5, label), name);
+			allocs = scope.Count();
+			bytes = scope.Bytes();
+		});
+		Report(name, ns, count, allocs, bytes);
+	}
+
+	void Decode(Database& db, const char* name, const std::string& stmt) {
+		std::size_t cells = 0, allocs = 0, bytes = 0;
+		const double ns = Best(5, [&] {
+			AllocationScope scope;
+			auto rows = db.ExecuteSTMT(stmt);
+			allocs = scope.Count();
+			bytes = scope.Bytes();
+			Check(rows, name);
+			cells = rows->Count() == 0 ? 0 : rows->Count() * (*rows)[0].Count();
+		});
+		Report(name, ns, cells ? cells : 1, allocs, bytes);
+	}
+
+	void RunStatementSuite(Database& db, const Statement<std::int64_t>& lookup, const std::string& backend, long int keys, std::size_t lookups) {
+		const auto label = [&backend](const char* what) {
+			return backend + " " + what;
+		};
+		PointLookup(db, label("point lookup, ExecuteSTMT").c_str(), "point_lookup", keys, lookups);
+		HandleLookup(label("point lookup, Statement handle").c_str(), lookup, keys, lookups);
+		Insert(db, label("insert (3 params), ExecuteSTMT").c_str(), "insert", lookups);
+		Decode(db, label("decode, narrow (per cell)").c_str(), "select_narrow");
+		Decode(db, label("decode, wide (per cell)").c_str(), "select_wide");
+	}
+}
+
+void* operator new(std::size_t size) {
+	Bench::allocations.fetch_add(1, std::memory_order_relaxed);
+	Bench::allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+	if (void* p = std::malloc(size ? size : 1))
+		return p;
+	throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/database.hxx>
+#include <StormByte/database/statement.hxx>
+#include <StormByte/logger/log.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+/**
+ * @namespace Bench
+ * @brief Shared harness of the micro-benchmarks: timing, allocation counting
+ * and the workloads every backend runs.
+ *
+ * Each benchmark executable links bench.cxx, which replaces the global
+ * operator new / delete to count allocations. Reported figures are per
+ * operation and come from the best of several runs.
+ */
+namespace Bench {
+	using Clock = std::chrono::steady_clock;
+
+	extern std::atomic<std::size_t> allocations;		///< Calls to operator new
+	extern std::atomic<std::size_t> allocated_bytes;	///< Bytes requested from operator new
+	extern volatile std::size_t sink;					///< Keeps results from being optimized away
+
+	/**
+	 * @struct AllocationScope
+	 * @brief Allocation counters over a scope.
+	 */
+	struct AllocationScope {
+		std::size_t count = allocations.load();
+		std::size_t bytes = allocated_bytes.load();
+
+		inline std::size_t Count() const { return allocations.load() - count; }
+		inline std::size_t Bytes() const { return allocated_bytes.load() - bytes; }
+	};
+
+	/**
+	 * Best wall time of @p repeat runs of @p run.
+	 * @param repeat Number of runs.
+	 * @param run Workload.
+	 * @return Time in nanoseconds.
+	 */
+	template<typename F>
+	double Best(int repeat, F&& run) {
+		double best = std::numeric_limits<double>::max();
+		for (int i = 0; i < repeat; ++i) {
+			const auto start = Clock::now();
+			run();
+			best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+		}
+		return best;
+	}
+
+	/**
+	 * Prints one result line.
+	 * @param name Benchmark name.
+	 * @param ns Total time in nanoseconds.
+	 * @param ops Operations in @p ns.
+	 * @param allocs Allocations in @p ns.
+	 * @param bytes Allocated bytes in @p ns.
+	 */
+	void Report(const char* name, double ns, std::size_t ops, std::size_t allocs, std::size_t bytes);
+
+	/**
+	 * @param name Environment variable.
+	 * @param fallback Value when unset.
+	 * @return Value of @p name, or @p fallback.
+	 */
+	std::string Env(const char* name, const char* fallback);
+
+	/**
+	 * @return Logger for benchmark databases (errors only).
+	 */
+	std::shared_ptr<StormByte::Logger::Log> Logger();
+
+	/**
+	 * Point lookups through a named prepared statement taking one integer key:
+	 * bind, execute, decode one row and reset per operation.
+	 * @param db Connected database.
+	 * @param name Benchmark name.
+	 * @param stmt Statement name.
+	 * @param keys Keys are cycled through 1..@p keys.
+	 * @param count Lookups per run.
+	 */
+	void PointLookup(StormByte::Database::Database& db, const char* name, const std::string& stmt, long int keys, std::size_t count);
+
+	/**
+	 * PointLookup() through a typed statement handle, which binds without
+	 * building Values and skips the statement map.
+	 * @param name Benchmark name.
+	 * @param stmt Statement handle.
+	 * @param keys Keys are cycled through 1..@p keys.
+	 * @param count Lookups per run.
+	 */
+	void HandleLookup(const char* name, const StormByte::Database::Statement<std::int64_t>& stmt, long int keys, std::size_t count);
+
+	/**
+	 * Inserts through a named prepared statement taking (integer, double,
+	 * text) in one transaction that is rolled back, so the table is unchanged.
+	 * @param db Connected database.
+	 * @param name Benchmark name.
+	 * @param stmt Statement name.
+	 * @param count Inserts per run.
+	 */
+	void Insert(StormByte::Database::Database& db, const char* name, const std::string& stmt, std::size_t count);
+
+	/**
+	 * Executes a named prepared statement without parameters and reports the
+	 * decode cost per cell of its result.
+	 * @param db Connected database.
+	 * @param name Benchmark name.
+	 * @param stmt Statement name.
+	 */
+	void Decode(StormByte::Database::Database& db, const char* name, const std::string& stmt);
+
+	/**
+	 * Runs the shared workloads on a database prepared with the statements
+	 * point_lookup, insert, select_narrow and select_wide.
+	 * @param db Connected database.
+	 * @param lookup Typed handle of point_lookup.
+	 * @param backend Name printed before each benchmark.
+	 * @param keys Rows in the narrow table.
+	 * @param lookups Point lookups / inserts per run.
+	 */
+	void RunStatementSuite(StormByte::Database::Database& db, const StormByte::Database::Statement<std::int64_t>& lookup,
+		const std::string& backend, long int keys, std::size_t lookups);
+}
@@ -0,0 +1,57 @@
+#include "bench.hxx"
+
+#include <StormByte/database/mariadb/mariadb.hxx>
+
+#include <cstdio>
+#include <string>
+
+// Statement and decode costs of the MariaDB backend against a local server.
+// Connection settings default to the test suite's and can be overridden with
+// STORMBYTE_BENCH_HOST, _USER, _PASSWORD, _DATABASE and _PORT; without a
+// reachable server the benchmark is skipped. Tables are temporary and filled
+// from the SEQUENCE engine.
+
+using StormByte::Database::SslMode;
+using StormByte::Database::Statement;
+
+namespace {
+	constexpr long int narrow_rows = 50'000;
+	constexpr long int wide_rows = 5'000;
+
+	class BenchDatabase: public StormByte::Database::MariaDB::MariaDB {
+		public:
+			BenchDatabase()
+				: MariaDB(Bench::Env("STORMBYTE_BENCH_HOST", "127.0.0.1"), Bench::Env("STORMBYTE_BENCH_USER", "testuser"),
+					Bench::Env("STORMBYTE_BENCH_PASSWORD", "testpass"), Bench::Env("STORMBYTE_BENCH_DATABASE", "stormbyte_test"),
+					std::stoi(Bench::Env("STORMBYTE_BENCH_PORT", "3306")), Bench::Logger()) {
+				SetSslMode(SslMode::Disable);
+			}
+
+			Statement<std::int64_t> lookup;
+
+		private:
+			void DoPostConnect() noexcept override {
+				DoSilentQuery("CREATE TEMPORARY TABLE narrow (id BIGINT PRIMARY KEY, price DOUBLE, name TEXT, flag BIGINT);");
+				DoSilentQuery("CREATE TEMPORARY TABLE wide (c0 BIGINT, c1 DOUBLE, c2 TEXT, c3 TEXT, c4 BLOB, c5 BIGINT, c6 DOUBLE, c7 TEXT, c8 BIGINT, c9 TEXT, c10 BIGINT, c11 DOUBLE, c12 TEXT, c13 BLOB, c14 BIGINT, c15 TEXT);");
+				DoSilentQuery("CREATE TEMPORARY TABLE inserts (id BIGINT, price DOUBLE, name TEXT);");
+				DoSilentQuery("INSERT INTO narrow SELECT seq, seq * 0.5, CONCAT('item ', seq), seq % 2 FROM seq_1_to_" + std::to_string(narrow_rows) + ";");
+				DoSilentQuery("INSERT INTO wide SELECT seq, seq * 0.25, CONCAT('k', seq), LPAD(seq, 40, '0'), UNHEX(MD5(seq)), seq * 7, seq / 3.0, CONCAT('category ', seq % 17), seq % 5, "
+					"RPAD(seq, 64, ' '), -seq, seq * 1.5, 'ok', UNHEX(REPEAT(MD5(seq), 16)), seq, 'tag' FROM seq_1_to_" + std::to_string(wide_rows) + ";");
+
+				lookup = DoPrepareSTMT<std::int64_t>("point_lookup", "SELECT id, price, name, flag FROM narrow WHERE id = ?;");
+				DoPrepareSTMT("insert", "INSERT INTO inserts (id, price, name) VALUES (?, ?, ?);");
+				DoPrepareSTMT("select_narrow", "SELECT * FROM narrow;");
+				DoPrepareSTMT("select_wide", "SELECT * FROM wide;");
+			}
+	};
+}
+
+int main() {
+	BenchDatabase db;
+	if (!db.Connect()) {
+		std::printf("MariaDB benchmark skipped: no server reachable\n");
+		return 0;
+	}
+	Bench::RunStatementSuite(db, db.lookup, "MariaDB", narrow_rows, 10'000);
+	return 0;
+}
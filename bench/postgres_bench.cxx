@@ -0,0 +1,55 @@
+#include "bench.hxx"
+
+#include <StormByte/database/postgres/postgres.hxx>
+
+#include <cstdio>
+#include <string>
+
+// Statement and decode costs of the PostgreSQL backend against a local server.
+// Connection settings default to the test suite's and can be overridden with
+// STORMBYTE_BENCH_HOST, _USER, _PASSWORD and _DATABASE; without a reachable
+// server the benchmark is skipped. Tables are temporary.
+
+using StormByte::Database::SslMode;
+using StormByte::Database::Statement;
+
+namespace {
+	constexpr long int narrow_rows = 50'000;
+	constexpr long int wide_rows = 5'000;
+
+	class BenchDatabase: public StormByte::Database::Postgres::Postgres {
+		public:
+			BenchDatabase()
+				: Postgres(Bench::Env("STORMBYTE_BENCH_HOST", "localhost"), Bench::Env("STORMBYTE_BENCH_USER", "testuser"),
+					Bench::Env("STORMBYTE_BENCH_PASSWORD", "testpass"), Bench::Env("STORMBYTE_BENCH_DATABASE", "stormbyte_test"), Bench::Logger()) {
+				SetSslMode(SslMode::Disable);
+			}
+
+			Statement<std::int64_t> lookup;
+
+		private:
+			void DoPostConnect() noexcept override {
+				DoSilentQuery("CREATE TEMPORARY TABLE narrow (id BIGINT PRIMARY KEY, price DOUBLE PRECISION, name TEXT, flag BIGINT);");
+				DoSilentQuery("CREATE TEMPORARY TABLE wide (c0 BIGINT, c1 DOUBLE PRECISION, c2 TEXT, c3 TEXT, c4 BYTEA, c5 BIGINT, c6 DOUBLE PRECISION, c7 TEXT, c8 BIGINT, c9 TEXT, c10 BIGINT, c11 DOUBLE PRECISION, c12 TEXT, c13 BYTEA, c14 BIGINT, c15 TEXT);");
+				DoSilentQuery("CREATE TEMPORARY TABLE inserts (id BIGINT, price DOUBLE PRECISION, name TEXT);");
+				DoSilentQuery("INSERT INTO narrow SELECT x, x * 0.5, 'item ' || x, x % 2 FROM generate_series(1, " + std::to_string(narrow_rows) + ") AS x;");
+				DoSilentQuery("INSERT INTO wide SELECT x, x * 0.25, 'k' || x, lpad(x::text, 40, '0'), decode(md5(x::text), 'hex'), x * 7, x / 3.0, 'category ' || (x % 17), x % 5, "
+					"rpad(x::text, 64), -x, x * 1.5, 'ok', decode(repeat(md5(x::text), 16), 'hex'), x, 'tag' FROM generate_series(1, " + std::to_string(wide_rows) + ") AS x;");
+
+				lookup = DoPrepareSTMT<std::int64_t>("point_lookup", "SELECT id, price, name, flag FROM narrow WHERE id = $1;");
+				DoPrepareSTMT("insert", "INSERT INTO inserts (id, price, name) VALUES ($1, $2, $3);");
+				DoPrepareSTMT("select_narrow", "SELECT * FROM narrow;");
+				DoPrepareSTMT("select_wide", "SELECT * FROM wide;");
+			}
+	};
+}
+
+int main() {
+	BenchDatabase db;
+	if (!db.Connect()) {
+		std::printf("PostgreSQL benchmark skipped: no server reachable\n");
+		return 0;
+	}
+	Bench::RunStatementSuite(db, db.lookup, "PostgreSQL", narrow_rows, 10'000);
+	return 0;
+}
@@ -0,0 +1,49 @@
+#include "bench.hxx"
+
+#include <StormByte/database/sqlite/sqlite3.hxx>
+
+#include <cstdio>
+#include <string>
+
+// Statement and decode costs of the SQLite backend on an in-memory database:
+// nothing but the library and SQLite itself is measured.
+
+using StormByte::Database::Statement;
+
+namespace {
+	constexpr long int narrow_rows = 200'000;
+	constexpr long int wide_rows = 20'000;
+
+	class BenchDatabase: public StormByte::Database::SQLite::SQLite3 {
+		public:
+			BenchDatabase(): SQLite3(Bench::Logger()) {}
+
+			Statement<std::int64_t> lookup;
+
+		private:
+			void DoPostConnect() noexcept override {
+				DoSilentQuery("CREATE TABLE narrow (id INTEGER PRIMARY KEY, price REAL, name TEXT, flag INTEGER);");
+				DoSilentQuery("CREATE TABLE wide (c0 INTEGER, c1 REAL, c2 TEXT, c3 TEXT, c4 BLOB, c5 INTEGER, c6 REAL, c7 TEXT, c8 INTEGER, c9 TEXT, c10 INTEGER, c11 REAL, c12 TEXT, c13 BLOB, c14 INTEGER, c15 TEXT);");
+				DoSilentQuery("CREATE TABLE inserts (id INTEGER, price REAL, name TEXT);");
+				DoSilentQuery("WITH RECURSIVE n(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM n WHERE x < " + std::to_string(narrow_rows) + ") "
+					"INSERT INTO narrow SELECT x, x * 0.5, 'item ' || x, x % 2 FROM n;");
+				DoSilentQuery("WITH RECURSIVE n(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM n WHERE x < " + std::to_string(wide_rows) + ") "
+					"INSERT INTO wide SELECT x, x * 0.25, 'k' || x, printf('%040d', x), randomblob(8), x * 7, x / 3.0, 'category ' || (x % 17), x % 5, printf('%-64d', x), -x, x * 1.5, 'ok', randomblob(256), x, 'tag' FROM n;");
+
+				lookup = DoPrepareSTMT<std::int64_t>("point_lookup", "SELECT id, price, name, flag FROM narrow WHERE id = ?;");
+				DoPrepareSTMT("insert", "INSERT INTO inserts (id, price, name) VALUES (?, ?, ?);");
+				DoPrepareSTMT("select_narrow", "SELECT * FROM narrow;");
+				DoPrepareSTMT("select_wide", "SELECT * FROM wide;");
+			}
+	};
+}
+
+int main() {
+	BenchDatabase db;
+	if (!db.Connect()) {
+		std::fprintf(stderr, "Cannot open the in-memory database\n");
+		return 1;
+	}
+	Bench::RunStatementSuite(db, db.lookup, "SQLite", narrow_rows, 100'000);
+	return 0;
+}
@@ -0,0 +1,102 @@
+#include "bench.hxx"
+
+#include <StormByte/database/rows.hxx>
+
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Measures the cost of Value and Row themselves, without a backend: the size
+// of a Value, building Values from the usual payloads, reading them back with
+// Get<T>(), and looking cells up by position, by name and through a ColumnRef.
+
+using StormByte::Database::ColumnRef;
+using StormByte::Database::ResultSchema;
+using StormByte::Database::Row;
+using StormByte::Database::Rows;
+using StormByte::Database::Value;
+
+namespace {
+	void ValueConstruction() {
+		constexpr std::size_t count = 1'000'000;
+		const std::string short_text = "item 12345";
+		const std::string long_text(64, 'x');
+		const std::vector<std::byte> blob(32, std::byte{0x5A});
+		std::vector<Value> values;
+		values.reserve(count);
+
+		std::size_t allocs = 0, bytes = 0;
+		const double ns = Bench::Best(5, [&] {
+			values.clear();
+			Bench::AllocationScope scope;
+			for (std::size_t i = 0; i < count; i += 5) {
+				values.emplace_back(static_cast<long int>(i));
+				values.emplace_back(static_cast<double>(i) * 0.5);
+				values.emplace_back(short_text);
+				values.emplace_back(long_text);
+				values.emplace_back(blob);
+			}
+			allocs = scope.Count();
+			bytes = scope.Bytes();
+		});
+		Bench::Report("Value construction (mixed)", ns, count, allocs, bytes);
+
+		long int sum = 0;
+		std::size_t length = 0;
+		const double get_ns = Bench::Best(5, [&] {
+			for (std::size_t i = 0; i < count; i += 5) {
+				sum += values[i].Get<long int>();
+				length += values[i + 2].Get<std::string_view>().size();
+				length += values[i + 3].Get<std::string_view>().size();
+			}
+		});
+		Bench::Report("Get<long int> / Get<string_view>", get_ns, count / 5 * 3, 0, 0);
+		Bench::sink = static_cast<std::size_t>(sum) + length;
+	}
+
+	template<typename F>
+	void Lookup(const char* name, const Rows& rows, F&& cell) {
+		long int sum = 0;
+		std::size_t allocs = 0, bytes = 0;
+		const double ns = Bench::Best(5, [&] {
+			Bench::AllocationScope scope;
+			for (const Row& row : rows)
+				sum += cell(row).template Get<long int>();
+			allocs = scope.Count();
+			bytes = scope.Bytes();
+		});
+		Bench::sink = static_cast<std::size_t>(sum);
+		Bench::Report(name, ns, rows.Count(), allocs, bytes);
+	}
+
+	void RowLookup() {
+		constexpr long int count = 200'000;
+		constexpr const char* names[] = {"id", "name", "email", "created_at", "score", "flags", "owner", "region"};
+		auto schema = std::make_shared<ResultSchema>();
+		for (const char* name : names)
+			schema->AddColumn(name);
+		Rows rows;
+		for (long int i = 0; i < count; ++i) {
+			Row row(schema);
+			for (std::size_t c = 0; c < std::size(names); ++c)
+				row.add(Value(i + static_cast<long int>(c)));
+			rows.add(std::move(row));
+		}
+
+		const std::string key = "region";
+		const ColumnRef column = rows.Column("region");
+		Lookup("Row lookup, position", rows, [](const Row& row) -> const Value& { return row[7]; });
+		Lookup("Row lookup, std::string name", rows, [&key](const Row& row) -> const Value& { return row[key]; });
+		Lookup("Row lookup, literal name", rows, [](const Row& row) -> const Value& { return row["region"]; });
+		Lookup("Row lookup, ColumnRef", rows, [&column](const Row& row) -> const Value& { return row[column]; });
+	}
+}
+
+int main() {
+	std::printf("sizeof(Value) = %zu bytes\n\n", sizeof(Value));
+	ValueConstruction();
+	RowLookup();
+	return 0;
+}
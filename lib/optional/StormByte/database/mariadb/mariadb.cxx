@@ -1,4 +1,6 @@
 #include <StormByte/database/mariadb/mariadb.hxx>
+#include <StormByte/database/mariadb/async_query.hxx>
+#include <StormByte/database/mariadb/blob_stream.hxx>
 #include <StormByte/database/mariadb/result_fetch.hxx>
 #include <StormByte/database/mariadb/prepared_stmt.hxx>
 
@@ -107,6 +109,8 @@ bool MariaDB::DoConnect() noexcept {
 	}
 
 	ApplySslMode(conn, m_ssl_mode);
+	// Enables the *_start / *_cont calls behind QueryAsync() / ExecuteAsync()
+	mysql_options(conn, MYSQL_OPT_NONBLOCK, nullptr);
 
 	unsigned int port = static_cast<unsigned int>(m_port);
 	if (!mysql_real_connect(conn,
@@ -143,7 +147,7 @@ void MariaDB::DoDisconnect() noexcept {
 	}
 }
 
-StormByte::Database::ExpectedRows MariaDB::Query(const std::string& query) noexcept {
+StormByte::Database::ExpectedRows MariaDB::DoQuery(const std::string& query) noexcept {
 	if (m_logger)
 		*m_logger << Logger::Level::Debug << "Executing query: " << query << std::endl;
 
@@ -163,11 +167,123 @@ StormByte::Database::ExpectedRows MariaDB::Query(const std::string& query) noexc
 		return Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
 	}
 
-	StormByte::Database::ExpectedRows rows = StormByte::Database::MariaDB::StepResults(res);
+	StormByte::Database::ExpectedRows rows = StormByte::Database::MariaDB::StepResults(res, m_result_storage);
 	mysql_free_result(res);
 	return rows;
 }
 
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> MariaDB::DoQueryAsync(const std::string& query) {
+	return std::make_unique<AsyncQuery>(m_conn, query, m_result_storage);
+}
+
+StormByte::Database::ExpectedColumnarRows MariaDB::DoQueryColumnar(const std::string& query) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	if (mysql_real_query(m_conn, query.c_str(), static_cast<unsigned long>(query.size())) != 0) {
+		return Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
+	}
+
+	LogMariaDBWarnings(m_conn, m_logger);
+
+	MYSQL_RES* res = mysql_store_result(m_conn);
+	if (!res) {
+		if (mysql_field_count(m_conn) == 0)
+			return ColumnarRows();
+		return Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
+	}
+
+	ExpectedColumnarRows result = StepColumnar(res);
+	mysql_free_result(res);
+	return result;
+}
+
+StormByte::Database::ExpectedCursor MariaDB::DoQueryStream(const std::string& query) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	if (mysql_real_query(m_conn, query.c_str(), static_cast<unsigned long>(query.size())) != 0) {
+		return Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
+	}
+
+	// Warnings are not logged here: SHOW WARNINGS cannot run while an unbuffered result is pending
+	MYSQL_RES* res = mysql_use_result(m_conn);
+	if (!res) {
+		if (mysql_field_count(m_conn) == 0)
+			return Cursor();
+		return Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
+	}
+
+	return Cursor(std::make_unique<UseResultSource>(m_conn, res));
+}
+
+StormByte::Database::ExpectedBlobStream MariaDB::DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	const std::string key = std::to_string(location.key);
+	const std::string where = " FROM " + location.table + " WHERE " + location.key_column + " = ";
+	const std::string length = "SELECT LENGTH(" + location.column + ")" + where + key;
+	if (mysql_real_query(m_conn, length.c_str(), static_cast<unsigned long>(length.size())) != 0)
+		return Unexpected<ExecuteError>(mysql_error(m_conn));
+	MYSQL_RES* res = mysql_store_result(m_conn);
+	if (!res)
+		return Unexpected<ExecuteError>(mysql_error(m_conn));
+	MYSQL_ROW row = mysql_fetch_row(res);
+	const bool found = row != nullptr;
+	const bool is_null = found && !row[0];
+	const std::uint64_t bytes = found && row[0] ? std::stoull(row[0]) : 0;
+	mysql_free_result(res);
+	if (!found)
+		return Unexpected<ExecuteError>("No row in " + location.table + " where " + location.key_column + " = " + key);
+
+	std::string error;
+	if (mode == BlobMode::Read) {
+		if (is_null)
+			return Unexpected<ExecuteError>("Blob value is NULL");
+		MYSQL_STMT* stmt = PrepareBlobSTMT(m_conn, "SELECT SUBSTRING(" + location.column + ", ?, ?)" + where + "?", error);
+		if (!stmt)
+			return Unexpected<ExecuteError>(error);
+		return std::make_unique<SubstringBlob>(stmt, location.key, bytes);
+	}
+
+	MYSQL_STMT* stmt = PrepareBlobSTMT(m_conn, "UPDATE " + location.table + " SET " + location.column + " = ? WHERE " + location.key_column + " = ?", error);
+	if (!stmt)
+		return Unexpected<ExecuteError>(error);
+	auto blob = std::make_unique<LongDataBlob>(stmt, location.key, size);
+	if (!blob->Bind())
+		return Unexpected<ExecuteError>(blob->Error());
+	return blob;
+}
+
+StormByte::Database::SlowQueryLog::Explainer MariaDB::DoExplainer() noexcept {
+	return [conn = m_conn](const std::string& sql, std::span<const Value> parameters) -> SlowQueryLog::ExpectedPlan {
+		PreparedSTMT explain("explain", "EXPLAIN FORMAT=JSON " + sql, conn, nullptr);
+		if (!explain.m_stmt)
+			return Unexpected<ExecuteError>(std::string("Failed to prepare EXPLAIN: ") + mysql_error(conn));
+		for (std::size_t i = 0; i < parameters.size(); ++i)
+			explain.Binder(static_cast<int>(i), Value(parameters[i]));
+
+		ExpectedRows rows = explain.DoExecute();
+		explain.Reset();
+		if (!rows)
+			return Unexpected(rows.error());
+
+		// One row holding the JSON document (text or, with a binary collation, a blob)
+		std::string plan;
+		for (const Row& row : *rows) {
+			const Value& cell = row[0];
+			if (cell.Type() == Value::Type::Text)
+				plan += cell.Get<std::string_view>();
+			else if (cell.Type() == Value::Type::Blob) {
+				const auto bytes = cell.Get<std::span<const std::byte>>();
+				plan.append(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+			}
+		}
+		return plan;
+	};
+}
+
 bool MariaDB::SilentQuery(const std::string& query) noexcept {
 	return DoSilentQuery(query);
 }
@@ -197,8 +313,13 @@ std::unique_ptr<StormByte::Database::PreparedSTMT>
 MariaDB::CreatePreparedSTMT(std::string&& name, std::string&& query) noexcept {
 	if (!m_conn)
 		return nullptr;
-	return std::unique_ptr<PreparedSTMT>(
-		new PreparedSTMT(std::move(name), std::move(query), m_conn, m_logger));
+	std::unique_ptr<PreparedSTMT> stmt(new PreparedSTMT(std::move(name), std::move(query), m_conn, m_logger));
+	if (!stmt->m_stmt) {
+		if (m_logger)
+			*m_logger << Logger::Level::Error << "MariaDB: failed to prepare statement '" << stmt->Name() << "': " << mysql_error(m_conn) << std::endl;
+		return nullptr;
+	}
+	return stmt;
 }
 
 void MariaDB::DoBeginTransaction(IsolationLevel level) {
@@ -69,13 +69,6 @@ namespace StormByte::Database::MariaDB {
 			 */
 			~MariaDB() noexcept override;
 
-			/**
-			 * Executes a query and returns rows.
-			 * @param query SQL text.
-			 * @return Result rows or an error.
-			 */
-			ExpectedRows Query(const std::string& query) noexcept override;
-
 			/**
 			 * Executes a query that does not return rows.
 			 * @param query SQL text.
@@ -114,6 +107,51 @@ namespace StormByte::Database::MariaDB {
 			 */
 			bool DoSilentQuery(const std::string& query) noexcept override;
 
+			/**
+			 * Executes @p query and decodes the stored result into rows.
+			 * @param query SQL text.
+			 * @return Result rows or an error.
+			 */
+			ExpectedRows DoQuery(const std::string& query) noexcept override;
+
+			/**
+			 * Executes @p query and decodes the stored result into columns.
+			 * @param query SQL text.
+			 * @return Columnar result or an error.
+			 */
+			ExpectedColumnarRows DoQueryColumnar(const std::string& query) override;
+
+			/**
+			 * Executes @p query with mysql_use_result so rows are read on demand.
+			 * @param query SQL text.
+			 * @return Cursor over the result rows or an error.
+			 */
+			ExpectedCursor DoQueryStream(const std::string& query) override;
+
+			/**
+			 * Opens a blob cell as a BlobStream: reads run one SUBSTRING() per
+			 * chunk, writes stream the new value with mysql_stmt_send_long_data().
+			 * @param location Table, column and row of the value.
+			 * @param mode Stream direction.
+			 * @param size Size of the new value (BlobMode::Write only).
+			 * @return SubstringBlob / LongDataBlob or an error.
+			 */
+			ExpectedBlobStream DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) override;
+
+			/**
+			 * Explains slow statements with EXPLAIN FORMAT=JSON, prepared with
+			 * the same parameters bound.
+			 * @return Explainer bound to the connection handle.
+			 */
+			SlowQueryLog::Explainer DoExplainer() noexcept override;
+
+			/**
+			 * Runs @p query on Connector/C's non-blocking API.
+			 * @param query SQL text.
+			 * @return Operation advanced as the socket becomes ready.
+			 */
+			std::unique_ptr<AsyncResult<ExpectedRows>> DoQueryAsync(const std::string& query) override;
+
 		private:
 			std::string m_host;			///< Host
 			std::string m_user;			///< User
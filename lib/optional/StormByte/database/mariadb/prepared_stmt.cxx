@@ -1,9 +1,12 @@
 #include <StormByte/database/mariadb/prepared_stmt.hxx>
+#include <StormByte/database/mariadb/param_binds.hxx>
 #include <StormByte/database/mariadb/result_fetch.hxx>
+#include <StormByte/database/mariadb/async_query.hxx>
 
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <mysql.h>
 #include <string>
 #include <vector>
@@ -52,6 +55,7 @@ PreparedSTMT::PreparedSTMT(const std::string& name, const std::string& query, st
 		return;
 	}
 	m_stmt = to_st_mysql_stmt(stmt);
+	InitBuffers();
 }
 
 PreparedSTMT::PreparedSTMT(std::string&& name, std::string&& query, struct st_mysql* conn, std::shared_ptr<Logger::Log> logger) noexcept
@@ -69,6 +73,7 @@ PreparedSTMT::PreparedSTMT(std::string&& name, std::string&& query, struct st_my
 		return;
 	}
 	m_stmt = to_st_mysql_stmt(stmt);
+	InitBuffers();
 }
 
 PreparedSTMT::~PreparedSTMT() noexcept {
@@ -86,330 +91,488 @@ void PreparedSTMT::Binder(const int& index, Value&& value) noexcept {
 
 void PreparedSTMT::Reset() noexcept {
 	m_params.clear();
-	if (m_stmt) {
+	if (m_stmt && m_needs_reset) {
 		mysql_stmt_reset(to_mysql_stmt(m_stmt));
+		m_needs_reset = false;
 	}
 }
 
-StormByte::Database::ExpectedRows PreparedSTMT::DoExecute() {
-	if (!m_conn || !m_stmt) {
-		return Unexpected<ExecuteError>("No DB connection or statement");
+void PreparedSTMT::InitBuffers() {
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+	m_binds = std::make_unique<ParamBinds>(static_cast<std::size_t>(mysql_stmt_param_count(stmt)));
+	if (Output()) {
+		// Stored results report their longest values, which StmtResult::Fit() sizes buffers to
+		my_bool update_max_length = 1;
+		mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &update_max_length);
 	}
+}
 
+bool PreparedSTMT::BindAndExecute(const std::vector<Value>& params) {
 	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+	if (m_binds->Bind(stmt, params) && mysql_stmt_execute(stmt) == 0)
+		return true;
+	m_needs_reset = true;
+	return false;
+}
 
-	std::vector<MYSQL_BIND> bind_in;
-	bind_in.resize(m_params.size());
-	std::vector<int32_t> int_buf(m_params.size());
-	std::vector<uint32_t> uint_buf(m_params.size());
-	std::vector<int64_t> ll_buf(m_params.size());
-	std::vector<uint64_t> ull_buf(m_params.size());
-	std::vector<double> dbl_buf(m_params.size());
-	std::vector<char> bool_buf(m_params.size());
-	std::vector<std::string> str_buf(m_params.size());
-	std::vector<std::vector<char>> bin_buf(m_params.size());
-	std::vector<unsigned long> str_len(m_params.size());
-	std::vector<my_bool> is_null(m_params.size());
-
-	for (size_t i = 0; i < m_params.size(); ++i) {
-		memset(&bind_in[i], 0, sizeof(MYSQL_BIND));
-		const StormByte::Database::Value& p = m_params[i];
-		is_null[i] = 0;
-
-		if (p.IsNull()) {
-			bind_in[i].buffer_type = MYSQL_TYPE_NULL;
-			bind_in[i].is_null = &is_null[i];
-			is_null[i] = 1;
-			continue;
-		}
+StmtResult* PreparedSTMT::Output() {
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+	const unsigned int fields = mysql_stmt_field_count(stmt);
+	if (fields == 0)
+		return nullptr;
+	if (!m_output || m_output->FieldCount() != fields) {
+		MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
+		if (!meta)
+			return nullptr;
+		m_output = std::make_unique<StmtResult>(meta);
+	}
+	return m_output.get();
+}
 
-		auto vt = p.Type();
-		switch (vt) {
-			case StormByte::Database::Value::Type::Integer: {
-				int_buf[i] = p.Get<int>();
-				bind_in[i].buffer_type = MYSQL_TYPE_LONG;
-				bind_in[i].buffer = &int_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+namespace {
+	/**
+	 * @class AsyncExecute
+	 * @brief Prepared statement run on Connector/C's non-blocking API
+	 * (mysql_stmt_execute_start / mysql_stmt_store_result_start and their _cont calls).
+	 */
+	class AsyncExecute final: public StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows> {
+		public:
+			AsyncExecute(MYSQL* conn, MYSQL_STMT* stmt, std::vector<StormByte::Database::Value>&& params, StormByte::Database::ResultStorage storage)
+				: m_conn(conn), m_stmt(stmt), m_params(std::move(params)), m_storage(storage) {}
+
+			StormByte::Database::AsyncStatus Start() override {
+				if (!m_conn || !m_stmt) {
+					m_result = StormByte::Unexpected<StormByte::Database::ExecuteError>("No DB connection or statement");
+					return StormByte::Database::AsyncStatus::Done;
+				}
+				if (!m_binds.Bind(m_stmt, m_params))
+					return Fail();
+				m_wait = mysql_stmt_execute_start(&m_error, m_stmt);
+				return Step();
 			}
-			case StormByte::Database::Value::Type::UnsignedInteger: {
-				uint_buf[i] = p.Get<unsigned int>();
-				bind_in[i].buffer_type = MYSQL_TYPE_LONG;
-				bind_in[i].buffer = &uint_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			StormByte::Database::AsyncStatus Resume() override {
+				if (m_output)
+					m_wait = mysql_stmt_store_result_cont(&m_error, m_stmt, ReadyFlags(m_wait));
+				else
+					m_wait = mysql_stmt_execute_cont(&m_error, m_stmt, ReadyFlags(m_wait));
+				return Step();
 			}
-			case StormByte::Database::Value::Type::LongInteger: {
-				ll_buf[i] = p.Get<long int>();
-				bind_in[i].buffer_type = MYSQL_TYPE_LONGLONG;
-				bind_in[i].buffer = &ll_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			std::intptr_t Handle() const noexcept override {
+				return m_conn ? static_cast<std::intptr_t>(mysql_get_socket(m_conn)) : -1;
 			}
-			case StormByte::Database::Value::Type::UnsignedLongInteger: {
-				ull_buf[i] = p.Get<unsigned long int>();
-				bind_in[i].buffer_type = MYSQL_TYPE_LONGLONG;
-				bind_in[i].buffer = &ull_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			StormByte::Database::ExpectedRows Result() override {
+				return std::move(*m_result);
+			}
+
+		private:
+			MYSQL* m_conn;												///< Connection
+			MYSQL_STMT* m_stmt;											///< Statement
+			std::vector<StormByte::Database::Value> m_params;			///< Parameters (bound at Start())
+			StormByte::Database::ResultStorage m_storage;				///< Rows payload storage
+			ParamBinds m_binds;											///< Input buffers, alive until executed
+			std::optional<StmtResult> m_output;							///< Output buffers once executed
+			int m_wait = 0;												///< Pending MYSQL_WAIT_* flags
+			int m_error = 0;											///< Result of the last finished call
+			std::optional<StormByte::Database::ExpectedRows> m_result;	///< Result once done
+
+			StormByte::Database::AsyncStatus Step() {
+				if (m_wait)
+					return WaitStatus(m_wait);
+				if (m_error != 0)
+					return Fail();
+
+				if (!m_output) {
+					MYSQL_RES* meta = mysql_stmt_result_metadata(m_stmt);
+					if (!meta) {
+						if (mysql_stmt_field_count(m_stmt) != 0)
+							return Fail();
+						m_result = StormByte::Database::Rows();
+						return StormByte::Database::AsyncStatus::Done;
+					}
+					m_output.emplace(meta);
+					if (!m_output->Bind(m_stmt))
+						return Fail();
+					m_wait = mysql_stmt_store_result_start(&m_error, m_stmt);
+					if (m_wait)
+						return WaitStatus(m_wait);
+					if (m_error != 0)
+						return Fail();
+				}
+
+				// Stored client-side: fetching no longer touches the socket
+				if (!m_output->Fit(m_stmt))
+					return Fail();
+				StormByte::Database::Rows rows;
+				StormByte::Database::Arena* arena = m_storage != StormByte::Database::ResultStorage::Owned ? &rows.UseArena() : nullptr;
+				int rc;
+				while ((rc = m_output->Fetch(m_stmt)) == 0)
+					rows.add(m_output->ToRow(arena));
+				mysql_stmt_free_result(m_stmt);
+				if (rc != MYSQL_NO_DATA)
+					return Fail();
+				m_result = std::move(rows);
+				return StormByte::Database::AsyncStatus::Done;
 			}
-			case StormByte::Database::Value::Type::Double: {
-				dbl_buf[i] = p.Get<double>();
-				bind_in[i].buffer_type = MYSQL_TYPE_DOUBLE;
-				bind_in[i].buffer = &dbl_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			StormByte::Database::AsyncStatus Fail() {
+				m_result = StormByte::Unexpected<StormByte::Database::ExecuteError>(mysql_stmt_error(m_stmt) ? mysql_stmt_error(m_stmt) : "Unknown MySQL stmt error");
+				// Reset() no longer round-trips on every call: drop any partial result here
+				mysql_stmt_free_result(m_stmt);
+				return StormByte::Database::AsyncStatus::Done;
 			}
-			case StormByte::Database::Value::Type::Boolean: {
-				bool_buf[i] = p.Get<bool>() ? 1 : 0;
-				bind_in[i].buffer_type = MYSQL_TYPE_TINY;
-				bind_in[i].buffer = &bool_buf[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+	};
+}
+
+// Column-wise array binding of a whole batch; parameter arrays only need to outlive mysql_stmt_execute.
+// Returns 1 on success (affected set), 0 on execution error, -1 if a column mixes types (caller falls back).
+static int BulkExecute(MYSQL_STMT* stmt, const std::vector<std::vector<StormByte::Database::Value>>& rows, my_ulonglong& affected) {
+	using StormByte::Database::Value;
+	enum class Kind { Null, Integer, Double, Boolean, Text, Blob };
+	auto kind_of = [](const Value& v) {
+		switch (v.Type()) {
+			case Value::Type::Integer:
+			case Value::Type::UnsignedInteger:
+			case Value::Type::LongInteger:
+			case Value::Type::UnsignedLongInteger:	return Kind::Integer;
+			case Value::Type::Double:				return Kind::Double;
+			case Value::Type::Boolean:				return Kind::Boolean;
+			case Value::Type::Text:					return Kind::Text;
+			case Value::Type::Blob:					return Kind::Blob;
+			default:								return Kind::Null;
+		}
+	};
+
+	const std::size_t nrows = rows.size();
+	const std::size_t ncols = static_cast<std::size_t>(mysql_stmt_param_count(stmt));
+	for (const auto& row : rows)
+		if (row.size() != ncols)
+			return -1;
+
+	std::vector<MYSQL_BIND> binds(ncols);
+	std::vector<std::vector<int64_t>> ints(ncols);
+	std::vector<std::vector<double>> doubles(ncols);
+	std::vector<std::vector<char>> bools(ncols);
+	std::vector<std::vector<char*>> ptrs(ncols);
+	std::vector<std::vector<unsigned long>> lengths(ncols);
+	std::vector<std::vector<char>> indicators(ncols);
+
+	try {
+		for (std::size_t c = 0; c < ncols; ++c) {
+			Kind kind = Kind::Null;
+			for (const auto& row : rows) {
+				if (!row[c].IsNull()) {
+					kind = kind_of(row[c]);
+					break;
+				}
 			}
-			case StormByte::Database::Value::Type::Text: {
-				str_buf[i] = p.Get<std::string>();
-				bind_in[i].buffer_type = MYSQL_TYPE_STRING;
-				bind_in[i].buffer = const_cast<char*>(str_buf[i].data());
-				bind_in[i].buffer_length = static_cast<unsigned long>(str_buf[i].size());
-				str_len[i] = bind_in[i].buffer_length;
-				bind_in[i].length = &str_len[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			// An integer column is sent unsigned if it holds values above INT64_MAX
+			bool above_int64 = false;
+			bool negative = false;
+			indicators[c].assign(nrows, STMT_INDICATOR_NONE);
+			switch (kind) {
+				case Kind::Integer:		ints[c].resize(nrows); break;
+				case Kind::Double:		doubles[c].resize(nrows); break;
+				case Kind::Boolean:		bools[c].resize(nrows); break;
+				case Kind::Text:
+				case Kind::Blob:		ptrs[c].resize(nrows); lengths[c].resize(nrows); break;
+				default:				break;
 			}
-			case StormByte::Database::Value::Type::Blob: {
-				auto bv = p.Get<std::vector<std::byte>>();
-				bin_buf[i].resize(bv.size());
-				for (size_t k = 0; k < bv.size(); ++k)
-					bin_buf[i][k] = static_cast<char>(bv[k]);
-				bind_in[i].buffer_type = MYSQL_TYPE_BLOB;
-				bind_in[i].buffer = bin_buf[i].data();
-				bind_in[i].buffer_length = static_cast<unsigned long>(bin_buf[i].size());
-				str_len[i] = bind_in[i].buffer_length;
-				bind_in[i].length = &str_len[i];
-				bind_in[i].is_null = &is_null[i];
-				break;
+
+			for (std::size_t r = 0; r < nrows; ++r) {
+				const Value& v = rows[r][c];
+				if (v.IsNull()) {
+					indicators[c][r] = STMT_INDICATOR_NULL;
+					continue;
+				}
+				if (kind_of(v) != kind)
+					return -1;
+				switch (kind) {
+					case Kind::Integer:
+						if (v.Type() == Value::Type::UnsignedInteger || v.Type() == Value::Type::UnsignedLongInteger) {
+							const unsigned long int u = v.Get<unsigned long int>();
+							above_int64 = above_int64 || u > static_cast<unsigned long int>(std::numeric_limits<int64_t>::max());
+							ints[c][r] = static_cast<int64_t>(u);
+						}
+						else {
+							ints[c][r] = v.Get<long int>();
+							negative = negative || ints[c][r] < 0;
+						}
+						break;
+					case Kind::Double:		doubles[c][r] = v.Get<double>(); break;
+					case Kind::Boolean:		bools[c][r] = v.Get<bool>() ? 1 : 0; break;
+					case Kind::Text: {
+						const auto text = v.Get<std::string_view>();
+						ptrs[c][r] = const_cast<char*>(text.data());
+						lengths[c][r] = static_cast<unsigned long>(text.size());
+						break;
+					}
+					case Kind::Blob: {
+						const auto blob = v.Get<std::span<const std::byte>>();
+						ptrs[c][r] = reinterpret_cast<char*>(const_cast<std::byte*>(blob.data()));
+						lengths[c][r] = static_cast<unsigned long>(blob.size());
+						break;
+					}
+					default:
+						break;
+				}
 			}
-			case StormByte::Database::Value::Type::Null:
-			default: {
-				bind_in[i].buffer_type = MYSQL_TYPE_NULL;
-				bind_in[i].is_null = &is_null[i];
-				is_null[i] = 1;
-				break;
+
+			// One signedness per array column: mixed ones go through the row loop
+			if (above_int64 && negative)
+				return -1;
+
+			MYSQL_BIND& bind = binds[c];
+			memset(&bind, 0, sizeof(MYSQL_BIND));
+			bind.u.indicator = indicators[c].data();
+			bind.is_unsigned = above_int64 ? 1 : 0;
+			switch (kind) {
+				case Kind::Integer:		bind.buffer_type = MYSQL_TYPE_LONGLONG; bind.buffer = ints[c].data(); break;
+				case Kind::Double:		bind.buffer_type = MYSQL_TYPE_DOUBLE; bind.buffer = doubles[c].data(); break;
+				case Kind::Boolean:		bind.buffer_type = MYSQL_TYPE_TINY; bind.buffer = bools[c].data(); break;
+				case Kind::Text:		bind.buffer_type = MYSQL_TYPE_STRING; bind.buffer = ptrs[c].data(); bind.length = lengths[c].data(); break;
+				case Kind::Blob:		bind.buffer_type = MYSQL_TYPE_BLOB; bind.buffer = ptrs[c].data(); bind.length = lengths[c].data(); break;
+				default:				bind.buffer_type = MYSQL_TYPE_NULL; break;
 			}
 		}
+	} catch (...) {
+		// Value out of range for its column type
+		return -1;
 	}
 
-	if (!bind_in.empty()) {
-		if (mysql_stmt_bind_param(stmt, bind_in.data()) != 0) {
-			return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	unsigned int array_size = static_cast<unsigned int>(nrows);
+	mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, &array_size);
+	const bool ok = (binds.empty() || mysql_stmt_bind_param(stmt, binds.data()) == 0) && mysql_stmt_execute(stmt) == 0;
+	if (ok)
+		affected = mysql_stmt_affected_rows(stmt);
+	array_size = 0;
+	mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, &array_size);
+	return ok ? 1 : 0;
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBeginBatch() {
+	if (!m_conn || !m_stmt)
+		return Unexpected<ExecuteError>("No DB connection or statement");
+	m_batch_rows.clear();
+	return {};
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBatchRow(BatchResult&) {
+	m_batch_rows.push_back(std::move(m_params));
+	m_params.clear();
+	return {};
+}
+
+StormByte::Database::ExpectedBatch PreparedSTMT::DoEndBatch(ExpectedBatch&& result) {
+	std::vector<std::vector<Value>> rows = std::move(m_batch_rows);
+	m_batch_rows.clear();
+	if (!result || rows.empty())
+		return std::move(result);
+
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+	if (rows.size() > 1 && BulkSupported()) {
+		my_ulonglong affected = 0;
+		const int bulk = BulkExecute(stmt, rows, affected);
+		if (bulk > 0) {
+			result->total_affected = static_cast<std::uint64_t>(affected);
+			return std::move(result);
 		}
+		if (bulk == 0)
+			return Unexpected<BatchError>(BatchError::WholeBatch{}, rows.size(), mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
+	return ExecuteRows(rows, std::move(*result));
+}
+
+bool PreparedSTMT::BulkSupported() const noexcept {
+	MYSQL* conn = to_mysql_conn(m_conn);
+	const char* info = mysql_get_server_info(conn);
+	return info && std::strstr(info, "MariaDB") && mysql_get_server_version(conn) >= 100200;
+}
 
-	if (mysql_stmt_execute(stmt) != 0) {
+StormByte::Database::ExpectedBatch PreparedSTMT::ExecuteRows(const std::vector<std::vector<Value>>& rows, BatchResult&& result) {
+	MYSQL* conn = to_mysql_conn(m_conn);
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+
+	unsigned int status = 0;
+	mariadb_get_infov(conn, MARIADB_CONNECTION_SERVER_STATUS, &status);
+	const bool own_transaction = (status & SERVER_STATUS_IN_TRANS) == 0;
+	if (own_transaction && mysql_query(conn, "START TRANSACTION") != 0)
+		return Unexpected<ExecuteError>(mysql_error(conn));
+
+	for (std::size_t i = 0; i < rows.size(); ++i) {
+		if (!BindAndExecute(rows[i])) {
+			const std::string error = mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error";
+			if (own_transaction)
+				mysql_query(conn, "ROLLBACK");
+			return Unexpected<BatchError>(i, error);
+		}
+		const auto affected = static_cast<std::uint64_t>(mysql_stmt_affected_rows(stmt));
+		result.affected.push_back(affected);
+		result.total_affected += affected;
+		if (mysql_stmt_field_count(stmt) > 0)
+			mysql_stmt_free_result(stmt);
+	}
+
+	if (own_transaction && mysql_query(conn, "COMMIT") != 0) {
+		const std::string error = mysql_error(conn);
+		mysql_query(conn, "ROLLBACK");
+		return Unexpected<ExecuteError>(error);
+	}
+	return std::move(result);
+}
+
+StormByte::Database::ExpectedRows PreparedSTMT::DoExecute() {
+	if (!m_conn || !m_stmt) {
+		return Unexpected<ExecuteError>("No DB connection or statement");
+	}
+
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+
+	if (!BindAndExecute(m_params)) {
 		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
 
-	MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
-	if (!meta) {
+	StmtResult* result = Output();
+	if (!result) {
 		if (mysql_stmt_field_count(stmt) == 0) {
 			return Rows();
 		}
+		m_needs_reset = true;
 		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
 
-	const unsigned int nfields = mysql_num_fields(meta);
-
-	std::vector<MYSQL_BIND> bind_out(nfields);
-	std::vector<unsigned long> out_len(nfields);
-	std::vector<my_bool> out_is_null(nfields);
-	std::vector<std::vector<char>> out_str(nfields);
-	std::vector<int32_t> out_int(nfields);
-	std::vector<uint32_t> out_uint(nfields);
-	std::vector<int64_t> out_ll(nfields);
-	std::vector<uint64_t> out_ull(nfields);
-	std::vector<double> out_dbl(nfields);
-	std::vector<char> out_bool(nfields);
-
-	for (unsigned int i = 0; i < nfields; ++i) {
-		memset(&bind_out[i], 0, sizeof(MYSQL_BIND));
-		MYSQL_FIELD* f = mysql_fetch_field_direct(meta, i);
-		unsigned long blen = (f && f->length) ? f->length : 1024;
-		out_is_null[i] = 0;
-
-		switch (f ? f->type : MYSQL_TYPE_STRING) {
-			case MYSQL_TYPE_TINY:
-				if (f && (f->flags & UNSIGNED_FLAG) == 0 && f->length == 1) {
-					bind_out[i].buffer_type = MYSQL_TYPE_TINY;
-					bind_out[i].buffer = &out_bool[i];
-				} else {
-					bind_out[i].buffer_type = MYSQL_TYPE_LONG;
-					if (f && (f->flags & UNSIGNED_FLAG)) {
-						bind_out[i].buffer = &out_uint[i];
-					} else {
-						bind_out[i].buffer = &out_int[i];
-					}
-				}
-				bind_out[i].is_null = &out_is_null[i];
-				bind_out[i].length = &out_len[i];
-				break;
-
-			case MYSQL_TYPE_SHORT:
-			case MYSQL_TYPE_LONG:
-				bind_out[i].buffer_type = MYSQL_TYPE_LONG;
-				if (f && (f->flags & UNSIGNED_FLAG)) {
-					bind_out[i].buffer = &out_uint[i];
-				} else {
-					bind_out[i].buffer = &out_int[i];
-				}
-				bind_out[i].is_null = &out_is_null[i];
-				bind_out[i].length = &out_len[i];
-				break;
-
-			case MYSQL_TYPE_LONGLONG:
-				bind_out[i].buffer_type = MYSQL_TYPE_LONGLONG;
-				if (f && (f->flags & UNSIGNED_FLAG)) {
-					bind_out[i].buffer = &out_ull[i];
-				} else {
-					bind_out[i].buffer = &out_ll[i];
-				}
-				bind_out[i].is_null = &out_is_null[i];
-				bind_out[i].length = &out_len[i];
-				break;
-
-			case MYSQL_TYPE_FLOAT:
-			case MYSQL_TYPE_DOUBLE:
-				bind_out[i].buffer_type = MYSQL_TYPE_DOUBLE;
-				bind_out[i].buffer = &out_dbl[i];
-				bind_out[i].is_null = &out_is_null[i];
-				bind_out[i].length = &out_len[i];
-				break;
-
-			case MYSQL_TYPE_BLOB:
-			case MYSQL_TYPE_VAR_STRING:
-			case MYSQL_TYPE_STRING:
-			default:
-				out_str[i].resize(blen + 1);
-				bind_out[i].buffer_type = MYSQL_TYPE_STRING;
-				bind_out[i].buffer = out_str[i].data();
-				bind_out[i].buffer_length = static_cast<unsigned long>(out_str[i].size());
-				bind_out[i].length = &out_len[i];
-				bind_out[i].is_null = &out_is_null[i];
-				break;
-		}
+	if (!result->Bind(stmt) || mysql_stmt_store_result(stmt) != 0 || !result->Fit(stmt)) {
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
+
+	StatementMetrics::BeginDecode();
+	Rows rows;
+	Arena* arena = m_result_storage != ResultStorage::Owned ? &rows.UseArena() : nullptr;
+	std::uint64_t decoded = 0;
+	int rc;
+	while ((rc = result->Fetch(stmt)) == 0)
+		rows.add(result->ToRow(arena, &decoded));
+
+	if (rc != MYSQL_NO_DATA) {
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt fetch error");
+	}
+
+	mysql_stmt_free_result(stmt);
+
+	StatementMetrics::AddDecodedBytes(decoded);
+	return rows;
+}
+
+StormByte::Database::ExpectedColumnarRows PreparedSTMT::DoExecuteColumnar() {
+	if (!m_conn || !m_stmt) {
+		return Unexpected<ExecuteError>("No DB connection or statement");
 	}
 
-	if (mysql_stmt_bind_result(stmt, bind_out.data()) != 0) {
-		mysql_free_result(meta);
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+
+	if (!BindAndExecute(m_params)) {
 		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
 
-	if (mysql_stmt_store_result(stmt) != 0) {
-		mysql_free_result(meta);
+	StmtResult* buffers = Output();
+	if (!buffers) {
+		if (mysql_stmt_field_count(stmt) == 0) {
+			return ColumnarRows();
+		}
+		m_needs_reset = true;
 		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
 
-	Rows rows;
-	while (true) {
-		int rc = mysql_stmt_fetch(stmt);
+	if (!buffers->Bind(stmt) || mysql_stmt_store_result(stmt) != 0 || !buffers->Fit(stmt)) {
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
 
-		if (rc == MYSQL_NO_DATA) break;
-		if (rc != 0 && rc != MYSQL_DATA_TRUNCATED) {
-			mysql_free_result(meta);
-			return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt fetch error");
-		}
+	ColumnarRows result(buffers->Schema());
+	const std::size_t nrows = static_cast<std::size_t>(mysql_stmt_num_rows(stmt));
+	for (std::size_t c = 0; c < result.ColumnCount(); ++c)
+		result[c].Reserve(nrows);
 
-		if (rc == MYSQL_DATA_TRUNCATED) {
-			for (unsigned int ci = 0; ci < nfields; ++ci) {
-				if (out_is_null[ci]) continue;
-				if (out_len[ci] > bind_out[ci].buffer_length) {
-					out_str[ci].resize(out_len[ci] + 1);
-					bind_out[ci].buffer = out_str[ci].data();
-					bind_out[ci].buffer_length = static_cast<unsigned long>(out_str[ci].size());
-					if (mysql_stmt_fetch_column(stmt, &bind_out[ci], ci, 0) != 0) {
-						mysql_free_result(meta);
-						return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt fetch_column error");
-					}
-				}
-			}
-		}
+	int rc;
+	while ((rc = buffers->Fetch(stmt)) == 0)
+		buffers->AppendTo(result);
 
-		Row prow;
-		for (unsigned int i = 0; i < nfields; ++i) {
-			MYSQL_FIELD* f = mysql_fetch_field_direct(meta, i);
-			const char* colName = f ? f->name : nullptr;
+	if (rc != MYSQL_NO_DATA) {
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt fetch error");
+	}
 
-			if (out_is_null[i]) {
-				prow.add(std::string(colName ? colName : ""), Value());
-				continue;
-			}
+	mysql_stmt_free_result(stmt);
 
-			switch (f ? f->type : MYSQL_TYPE_STRING) {
-				case MYSQL_TYPE_TINY: {
-					if (f && (f->flags & UNSIGNED_FLAG) == 0 && f->length == 1) {
-						prow.add(std::string(colName ? colName : ""), static_cast<bool>(out_bool[i] != 0));
-					} else if (f && (f->flags & UNSIGNED_FLAG)) {
-						prow.add(std::string(colName ? colName : ""), static_cast<unsigned int>(out_uint[i]));
-					} else {
-						prow.add(std::string(colName ? colName : ""), static_cast<int>(out_int[i]));
-					}
-					break;
-				}
+	return result;
+}
 
-				case MYSQL_TYPE_SHORT:
-				case MYSQL_TYPE_LONG:
-					if (f && (f->flags & UNSIGNED_FLAG))
-						prow.add(std::string(colName ? colName : ""), static_cast<unsigned int>(out_uint[i]));
-					else
-						prow.add(std::string(colName ? colName : ""), static_cast<int>(out_int[i]));
-					break;
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> PreparedSTMT::DoExecuteAsync() {
+	auto operation = std::make_unique<AsyncExecute>(to_mysql_conn(m_conn), to_mysql_stmt(m_stmt), std::move(m_params), m_result_storage);
+	m_params.clear();
+	return operation;
+}
 
-				case MYSQL_TYPE_LONGLONG:
-					if (f && (f->flags & UNSIGNED_FLAG))
-						prow.add(std::string(colName ? colName : ""), static_cast<unsigned long int>(out_ull[i]));
-					else
-						prow.add(std::string(colName ? colName : ""), static_cast<long int>(out_ll[i]));
-					break;
+StormByte::Database::ExpectedCursor PreparedSTMT::DoExecuteStream() {
+	if (!m_conn || !m_stmt) {
+		return Unexpected<ExecuteError>("No DB connection or statement");
+	}
 
-				case MYSQL_TYPE_FLOAT:
-				case MYSQL_TYPE_DOUBLE:
-					prow.add(std::string(colName ? colName : ""), out_dbl[i]);
-					break;
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
 
-				case MYSQL_TYPE_BLOB: {
-					unsigned long llen = out_len[i];
-					// 63 = binary charset; otherwise treat as text (TEXT/VARCHAR)
-					const bool is_binary = f && f->charsetnr == 63;
-					if (is_binary) {
-						std::vector<std::byte> blob;
-						if (llen > 0) {
-							blob.resize(llen);
-							for (unsigned long bi = 0; bi < llen; ++bi)
-								blob[bi] = static_cast<std::byte>(out_str[i][bi]);
-						}
-						prow.add(std::string(colName ? colName : ""), std::move(blob));
-					} else {
-						std::string sval(out_str[i].data(), llen);
-						prow.add(std::string(colName ? colName : ""), std::move(sval));
-					}
-					break;
-				}
+	if (!BindAndExecute(m_params)) {
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
+	m_params.clear();
 
-				case MYSQL_TYPE_VAR_STRING:
-				case MYSQL_TYPE_STRING:
-				default: {
-					unsigned long llen = out_len[i];
-					std::string sval(out_str[i].data(), llen);
-					prow.add(std::string(colName ? colName : ""), std::move(sval));
-					break;
-				}
-			}
+	MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
+	if (!meta) {
+		if (mysql_stmt_field_count(stmt) == 0) {
+			return Cursor();
 		}
-		rows.add(std::move(prow));
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
 	}
 
-	mysql_free_result(meta);
-	mysql_stmt_free_result(stmt);
+	// No mysql_stmt_store_result: rows are pulled from the server on each fetch
+	StmtResult result(meta);
+	if (!result.Bind(stmt)) {
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
 
-	return rows;
+	return Cursor(std::make_unique<StmtSource>(stmt, std::move(result)));
+}
+
+StormByte::Database::ExpectedRowReader PreparedSTMT::DoExecuteReader() {
+	if (!m_conn || !m_stmt) {
+		return Unexpected<ExecuteError>("No DB connection or statement");
+	}
+
+	MYSQL_STMT* stmt = to_mysql_stmt(m_stmt);
+
+	if (!BindAndExecute(m_params)) {
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
+
+	MYSQL_RES* meta = mysql_stmt_result_metadata(stmt);
+	if (!meta) {
+		if (mysql_stmt_field_count(stmt) == 0) {
+			return std::unique_ptr<RowReader>();
+		}
+		m_needs_reset = true;
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
+
+	// Rows are decoded as they arrive, so the result is not stored client-side
+	StmtResult result(meta);
+	if (!result.Bind(stmt)) {
+		return Unexpected<ExecuteError>(mysql_stmt_error(stmt) ? mysql_stmt_error(stmt) : "Unknown MySQL stmt error");
+	}
+
+	return std::make_unique<StmtReader>(stmt, std::move(result));
 }
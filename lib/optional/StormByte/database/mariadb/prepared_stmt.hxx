@@ -35,10 +35,16 @@ struct st_mysql_stmt;
  */
 namespace StormByte::Database::MariaDB {
 	class MariaDB;
+	struct ParamBinds;
+	class StmtResult;
 
 	/**
 	 * @class PreparedSTMT
 	 * @brief MariaDB prepared statement.
+	 *
+	 * Parameter and result buffers, together with the decoded result metadata,
+	 * are set up once at prepare time and reused by every execution, so a
+	 * point lookup costs one round trip and no buffer allocations.
 	 */
 	class STORMBYTE_DATABASE_PUBLIC PreparedSTMT final : public StormByte::Database::PreparedSTMT {
 		friend class ::StormByte::Database::MariaDB::MariaDB;
@@ -72,6 +78,10 @@ namespace StormByte::Database::MariaDB {
 		struct st_mysql* m_conn;						///< Connection handle
 		struct st_mysql_stmt* m_stmt;					///< Statement handle
 		std::vector<StormByte::Database::Value> m_params;	///< Bound parameters
+		std::vector<std::vector<StormByte::Database::Value>> m_batch_rows;	///< ExecuteBatch() rows awaiting execution
+		std::unique_ptr<ParamBinds> m_binds;			///< Reusable input buffers
+		std::unique_ptr<StmtResult> m_output;			///< Reusable output buffers and metadata (null without a result set)
+		bool m_needs_reset = false;						///< A failed execution left server-side state behind
 
 		/**
 		 * @param name Statement name.
@@ -89,6 +99,25 @@ namespace StormByte::Database::MariaDB {
 		 */
 		PreparedSTMT(std::string&& name, std::string&& query, struct st_mysql* conn, std::shared_ptr<Logger::Log> logger) noexcept;
 
+		/**
+		 * Sets up the reusable buffers of a freshly prepared statement.
+		 */
+		void InitBuffers();
+
+		/**
+		 * Binds @p params into the reusable input buffers and executes the statement.
+		 * @param params Parameter values.
+		 * @return true on success; on failure the next Reset() resets the statement.
+		 */
+		bool BindAndExecute(const std::vector<Value>& params);
+
+		/**
+		 * Output buffers matching the statement's current result set, rebuilt
+		 * only if its column count changed (re-prepare after DDL).
+		 * @return Output buffers, or nullptr if there is no result set.
+		 */
+		StmtResult* Output();
+
 		/**
 		 * Grows @p params so that @p index is valid.
 		 * @param params Parameter vector.
@@ -110,7 +139,68 @@ namespace StormByte::Database::MariaDB {
 		StormByte::Database::ExpectedRows DoExecute() override;
 
 		/**
-		 * Clears parameters and resets the statement.
+		 * Executes the statement and decodes the result into columns.
+		 * @return Columnar result or an error.
+		 */
+		StormByte::Database::ExpectedColumnarRows DoExecuteColumnar() override;
+
+		/**
+		 * Executes the statement without storing the result; rows are fetched per Next().
+		 * @return Cursor over the result rows or an error.
+		 */
+		StormByte::Database::ExpectedCursor DoExecuteStream() override;
+
+		/**
+		 * Executes and stores the result on Connector/C's non-blocking API. The
+		 * bound parameters move into the operation.
+		 * @return Operation advanced as the socket becomes ready.
+		 */
+		std::unique_ptr<AsyncResult<ExpectedRows>> DoExecuteAsync() override;
+
+		/**
+		 * Executes the statement and reads the MYSQL_BIND output buffers row by row.
+		 * @return Reader (null if there is no result set) or an error.
+		 */
+		StormByte::Database::ExpectedRowReader DoExecuteReader() override;
+
+		/**
+		 * Starts collecting batch rows.
+		 * @return Error if there is no connection or statement.
+		 */
+		Expected<void, QueryException> DoBeginBatch() override;
+
+		/**
+		 * Moves the bound parameters into the batch.
+		 * @param result Batch result (untouched until DoEndBatch()).
+		 * @return Always success.
+		 */
+		Expected<void, QueryException> DoBatchRow(BatchResult& result) override;
+
+		/**
+		 * Executes the collected rows: one array execution (STMT_ATTR_ARRAY_SIZE)
+		 * when the server supports bulk operations and every column has a single
+		 * type, otherwise row by row inside an implicit transaction.
+		 * @param result Result so far.
+		 * @return Final result.
+		 */
+		ExpectedBatch DoEndBatch(ExpectedBatch&& result) override;
+
+		/**
+		 * @return true if the server accepts array execution (MariaDB 10.2+).
+		 */
+		bool BulkSupported() const noexcept;
+
+		/**
+		 * Executes @p rows one by one, in a transaction unless one is already open.
+		 * @param rows Bound parameters per row.
+		 * @param result Batch result.
+		 * @return Final result.
+		 */
+		ExpectedBatch ExecuteRows(const std::vector<std::vector<Value>>& rows, BatchResult&& result);
+
+		/**
+		 * Clears parameters. The statement itself is only reset (a server round
+		 * trip) after a failed execution; successful ones free their own result.
 		 */
 		void Reset() noexcept override;
 	};
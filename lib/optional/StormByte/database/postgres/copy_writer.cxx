@@ -0,0 +1,306 @@
+#include <StormByte/database/postgres/copy_writer.hxx>
+#include <StormByte/database/postgres/result_fetch.hxx>
+#include <StormByte/database/postgres/binary.hxx>
+#include <libpq-fe.h>
+
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+using namespace StormByte::Database::Postgres;
+
+// Encoded bytes collected before they are handed to PQputCopyData
+static constexpr std::size_t send_threshold = 64 * 1024;
+
+// Binary COPY signature, flags field and header extension length
+static constexpr char binary_header[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+
+namespace {
+	/**
+	 * @param value Integer Value.
+	 * @param out Receives the value.
+	 * @return false if @p value is not an integer (or does not fit int64).
+	 */
+	bool AsInt64(const StormByte::Database::Value& value, std::int64_t& out) {
+		using StormByte::Database::Value;
+		switch (value.Type()) {
+			case Value::Type::Integer:				out = value.Get<int>(); return true;
+			case Value::Type::UnsignedInteger:		out = value.Get<unsigned int>(); return true;
+			case Value::Type::LongInteger:			out = value.Get<long int>(); return true;
+			case Value::Type::UnsignedLongInteger: {
+				const unsigned long int v = value.Get<unsigned long int>();
+				if (v > static_cast<unsigned long int>(std::numeric_limits<std::int64_t>::max()))
+					return false;
+				out = static_cast<std::int64_t>(v);
+				return true;
+			}
+			default:								return false;
+		}
+	}
+
+	/**
+	 * Appends @p value with to_chars (integers, shortest round-trip doubles).
+	 */
+	template<typename T>
+	void AppendNumber(std::string& out, T value) {
+		char buffer[32];
+		out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+	}
+
+	/**
+	 * Appends @p text escaped for the COPY text format.
+	 */
+	void AppendEscaped(std::string& out, std::string_view text) {
+		std::size_t start = 0;
+		for (std::size_t i = 0; i < text.size(); ++i) {
+			char escaped;
+			switch (text[i]) {
+				case '\\':	escaped = '\\'; break;
+				case '\t':	escaped = 't'; break;
+				case '\n':	escaped = 'n'; break;
+				case '\r':	escaped = 'r'; break;
+				default:	continue;
+			}
+			out.append(text.substr(start, i - start));
+			out.push_back('\\');
+			out.push_back(escaped);
+			start = i + 1;
+		}
+		out.append(text.substr(start));
+	}
+
+	/**
+	 * Reserves a big-endian field length followed by @p size payload bytes.
+	 * @return Start of the payload.
+	 */
+	char* AppendField(std::string& out, std::size_t size) {
+		const std::size_t offset = out.size();
+		out.resize(offset + 4 + size);
+		Binary::WriteInt<std::int32_t>(out.data() + offset, static_cast<std::int32_t>(size));
+		return out.data() + offset + 4;
+	}
+}
+
+CopyWriter::CopyWriter(struct pg_conn* conn, CopyFormat format, std::size_t columns, std::vector<unsigned int>&& types)
+	: m_conn(conn), m_format(format), m_columns(columns), m_types(std::move(types)), m_row_start(0), m_rows(0) {
+	m_buffer.reserve(send_threshold + send_threshold / 4);
+	if (m_format == CopyFormat::Binary)
+		m_buffer.append(binary_header, sizeof(binary_header) - 1);
+}
+
+CopyWriter::CopyWriter(CopyWriter&& other) noexcept
+	: m_conn(std::exchange(other.m_conn, nullptr)), m_format(other.m_format), m_columns(other.m_columns),
+	  m_types(std::move(other.m_types)), m_buffer(std::move(other.m_buffer)), m_row_start(other.m_row_start), m_rows(other.m_rows) {}
+
+CopyWriter::~CopyWriter() noexcept {
+	Abort();
+}
+
+CopyWriter& CopyWriter::operator=(CopyWriter&& other) noexcept {
+	if (this != &other) {
+		Abort();
+		m_conn = std::exchange(other.m_conn, nullptr);
+		m_format = other.m_format;
+		m_columns = other.m_columns;
+		m_types = std::move(other.m_types);
+		m_buffer = std::move(other.m_buffer);
+		m_row_start = other.m_row_start;
+		m_rows = other.m_rows;
+	}
+	return *this;
+}
+
+bool CopyWriter::BeginRow() {
+	if (!m_conn)
+		return false;
+	m_row_start = m_buffer.size();
+	if (m_format == CopyFormat::Binary) {
+		char count[2];
+		Binary::WriteInt<std::int16_t>(count, static_cast<std::int16_t>(m_columns));
+		m_buffer.append(count, sizeof(count));
+	}
+	return true;
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> CopyWriter::Encode(std::size_t column, const Value& value) {
+	if (m_columns && column >= m_columns)
+		return Unexpected<ExecuteError>("COPY row has more than " + std::to_string(m_columns) + " fields");
+
+	if (m_format == CopyFormat::Text) {
+		if (column > 0)
+			m_buffer.push_back('\t');
+		std::int64_t integer;
+		if (value.IsNull())
+			m_buffer.append("\\N");
+		else if (AsInt64(value, integer))
+			AppendNumber(m_buffer, integer);
+		else if (value.Type() == Value::Type::UnsignedLongInteger)
+			AppendNumber(m_buffer, value.Get<unsigned long int>());
+		else if (value.Type() == Value::Type::Double)
+			AppendNumber(m_buffer, value.Get<double>());
+		else if (value.Type() == Value::Type::Boolean)
+			m_buffer.push_back(value.Get<bool>() ? 't' : 'f');
+		else if (value.Type() == Value::Type::Text)
+			AppendEscaped(m_buffer, value.Get<std::string_view>());
+		else if (value.Type() == Value::Type::Blob) {
+			// bytea hex input (\x...), with its backslash escaped for COPY
+			static constexpr char hex[] = "0123456789abcdef";
+			const auto data = value.Get<std::span<const std::byte>>();
+			m_buffer.append("\\\\x");
+			for (const std::byte b : data) {
+				m_buffer.push_back(hex[std::to_integer<unsigned>(b) >> 4]);
+				m_buffer.push_back(hex[std::to_integer<unsigned>(b) & 0x0f]);
+			}
+		}
+		return {};
+	}
+
+	using namespace Binary;
+	if (value.IsNull()) {
+		char null_length[4];
+		WriteInt<std::int32_t>(null_length, -1);
+		m_buffer.append(null_length, sizeof(null_length));
+		return {};
+	}
+
+	const Oid type = m_types[column];
+	std::int64_t integer;
+	const bool is_integer = AsInt64(value, integer);
+	switch (type) {
+		case 16:
+			if (value.Type() == Value::Type::Boolean) {
+				*AppendField(m_buffer, 1) = value.Get<bool>() ? 1 : 0;
+				return {};
+			}
+			break;
+		case 21:
+			if (is_integer && integer >= std::numeric_limits<std::int16_t>::min() && integer <= std::numeric_limits<std::int16_t>::max()) {
+				WriteInt<std::int16_t>(AppendField(m_buffer, 2), static_cast<std::int16_t>(integer));
+				return {};
+			}
+			break;
+		case 23:
+			if (is_integer && integer >= std::numeric_limits<std::int32_t>::min() && integer <= std::numeric_limits<std::int32_t>::max()) {
+				WriteInt<std::int32_t>(AppendField(m_buffer, 4), static_cast<std::int32_t>(integer));
+				return {};
+			}
+			break;
+		case 20:
+			if (is_integer) {
+				WriteInt<std::int64_t>(AppendField(m_buffer, 8), integer);
+				return {};
+			}
+			break;
+		case 700:
+		case 701: {
+			double number;
+			if (value.Type() == Value::Type::Double)
+				number = value.Get<double>();
+			else if (is_integer)
+				number = static_cast<double>(integer);
+			else
+				break;
+			if (type == 700)
+				WriteFloat<float>(AppendField(m_buffer, 4), static_cast<float>(number));
+			else
+				WriteFloat<double>(AppendField(m_buffer, 8), number);
+			return {};
+		}
+		case 17:
+			if (value.Type() == Value::Type::Blob) {
+				const auto data = value.Get<std::span<const std::byte>>();
+				if (!data.empty())
+					std::memcpy(AppendField(m_buffer, data.size()), data.data(), data.size());
+				else
+					AppendField(m_buffer, 0);
+				return {};
+			}
+			break;
+		case 18: case 19: case 25: case 114: case 1042: case 1043: case 3802:
+			if (value.Type() == Value::Type::Text) {
+				const std::string_view text = value.Get<std::string_view>();
+				// jsonb: version byte, then the JSON text
+				const std::size_t prefix = type == 3802 ? 1 : 0;
+				char* dest = AppendField(m_buffer, prefix + text.size());
+				if (prefix)
+					*dest = 1;
+				if (!text.empty())
+					std::memcpy(dest + prefix, text.data(), text.size());
+				return {};
+			}
+			break;
+		default:
+			break;
+	}
+	return Unexpected<ExecuteError>("COPY column " + std::to_string(column) + " (" + TypeName(type)
+		+ ") cannot be encoded in binary from this value; use CopyFormat::Text");
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> CopyWriter::EndRow(std::size_t fields) {
+	if (m_columns && fields != m_columns) {
+		DiscardRow();
+		return Unexpected<ExecuteError>("COPY row has " + std::to_string(fields) + " fields, expected " + std::to_string(m_columns));
+	}
+	if (m_format == CopyFormat::Text)
+		m_buffer.push_back('\n');
+	++m_rows;
+	if (m_buffer.size() >= send_threshold && !Send())
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn));
+	return {};
+}
+
+void CopyWriter::DiscardRow() noexcept {
+	m_buffer.resize(m_row_start);
+}
+
+bool CopyWriter::Send() noexcept {
+	if (m_buffer.empty())
+		return true;
+	if (PQputCopyData(m_conn, m_buffer.data(), static_cast<int>(m_buffer.size())) != 1)
+		return false;
+	m_buffer.clear();
+	return true;
+}
+
+StormByte::Expected<std::uint64_t, StormByte::Database::QueryException> CopyWriter::End() {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("COPY is not active");
+
+	if (m_format == CopyFormat::Binary) {
+		char trailer[2];
+		Binary::WriteInt<std::int16_t>(trailer, -1);
+		m_buffer.append(trailer, sizeof(trailer));
+	}
+	if (!Send() || PQputCopyEnd(m_conn, nullptr) != 1) {
+		const std::string error = PQerrorMessage(m_conn);
+		Abort(error);
+		return Unexpected<ExecuteError>(error);
+	}
+
+	PGconn* conn = std::exchange(m_conn, nullptr);
+	m_buffer.clear();
+	Expected<std::uint64_t, QueryException> result = Unexpected<ExecuteError>("COPY ended without a result");
+	while (PGresult* res = PQgetResult(conn)) {
+		if (PQresultStatus(res) == PGRES_COMMAND_OK) {
+			std::uint64_t count = 0;
+			const char* tuples = PQcmdTuples(res);
+			std::from_chars(tuples, tuples + std::strlen(tuples), count);
+			result = count;
+		}
+		else
+			result = Unexpected<ExecuteError>(PQresultErrorMessage(res));
+		PQclear(res);
+	}
+	return result;
+}
+
+void CopyWriter::Abort(const std::string& reason) noexcept {
+	if (!m_conn)
+		return;
+	PGconn* conn = std::exchange(m_conn, nullptr);
+	m_buffer.clear();
+	PQputCopyEnd(conn, reason.c_str());
+	while (PGresult* res = PQgetResult(conn))
+		PQclear(res);
+}
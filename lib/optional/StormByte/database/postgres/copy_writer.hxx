@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/value.hxx>
+
+#include <cstdint>
+#include <initializer_list>
+#include <ranges>
+#include <string>
+#include <vector>
+
+struct pg_conn;
+
+/**
+ * @namespace Postgres
+ * @brief PostgreSQL backend for StormByte::Database.
+ */
+namespace StormByte::Database::Postgres {
+	class Postgres;
+
+	/**
+	 * @enum CopyFormat
+	 * @brief Data format of a COPY FROM STDIN stream.
+	 */
+	enum class CopyFormat {
+		Text,		///< Tab-separated text; the server parses every cell, any column type works
+		Binary		///< Native binary tuples; smaller and cheaper to parse, limited to the types listed in CopyWriter
+	};
+
+	/**
+	 * @class CopyWriter
+	 * @brief Streams rows into a table with COPY ... FROM STDIN.
+	 *
+	 * Rows are encoded into a buffer that is handed to PQputCopyData each time
+	 * it reaches 64 KiB, so memory stays bounded whatever the number of rows.
+	 * Nothing is committed until End() succeeds; a failure makes the whole COPY
+	 * fail.
+	 *
+	 * CopyFormat::Binary needs the column types, which CopyIn() looks up first.
+	 * It encodes integers as int2 / int4 / int8, numbers as float4 / float8,
+	 * bools as bool, text as text-like columns (text, varchar, bpchar, name,
+	 * json, jsonb) and blobs as bytea; other column types need CopyFormat::Text.
+	 *
+	 * @note While a CopyWriter is active the connection accepts nothing else.
+	 * End() or Abort() it (the destructor aborts) before issuing other queries;
+	 * it must not outlive its Postgres connection.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC CopyWriter {
+		friend class Postgres;
+		public:
+			/**
+			 * Copy constructor (deleted).
+			 */
+			CopyWriter(const CopyWriter&) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			CopyWriter(CopyWriter&& other) noexcept;
+
+			/**
+			 * Destructor. Aborts the COPY if End() was not called.
+			 */
+			~CopyWriter() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			CopyWriter& operator=(const CopyWriter&) = delete;
+
+			/**
+			 * Move assignment. Aborts the current COPY first.
+			 */
+			CopyWriter& operator=(CopyWriter&& other) noexcept;
+
+			/**
+			 * Writes one row.
+			 * @tparam R Range of Value (a Row, std::vector<Value>, ...).
+			 * @param row One value per copied column, in order.
+			 * @return Nothing, or an error (the row is then not written).
+			 */
+			template<std::ranges::input_range R>
+			requires std::convertible_to<std::ranges::range_reference_t<const R>, const Value&>
+			Expected<void, QueryException> Write(const R& row) {
+				if (!BeginRow())
+					return Unexpected<ExecuteError>("COPY is not active");
+				std::size_t column = 0;
+				for (const Value& value : row) {
+					if (auto encoded = Encode(column++, value); !encoded) {
+						DiscardRow();
+						return encoded;
+					}
+				}
+				return EndRow(column);
+			}
+
+			/**
+			 * Writes one row.
+			 * @param row One value per copied column, in order.
+			 * @return Nothing, or an error (the row is then not written).
+			 */
+			Expected<void, QueryException> Write(std::initializer_list<Value> row) {
+				return Write<std::initializer_list<Value>>(row);
+			}
+
+			/**
+			 * Sends the remaining rows and ends the COPY.
+			 * @return Number of rows copied, or the server error (nothing is kept).
+			 */
+			Expected<std::uint64_t, QueryException> End();
+
+			/**
+			 * Cancels the COPY; nothing is kept.
+			 * @param reason Error message reported by the server.
+			 */
+			void Abort(const std::string& reason = "COPY aborted by the client") noexcept;
+
+			/**
+			 * @return true until End() or Abort().
+			 */
+			inline bool IsActive() const noexcept {
+				return m_conn != nullptr;
+			}
+
+			/**
+			 * @return Rows written so far.
+			 */
+			inline std::uint64_t Rows() const noexcept {
+				return m_rows;
+			}
+
+		private:
+			struct pg_conn* m_conn;				///< Connection in COPY IN state (null once ended)
+			CopyFormat m_format;				///< Stream format
+			std::size_t m_columns;				///< Expected fields per row (0 = not checked)
+			std::vector<unsigned int> m_types;	///< Column type OIDs (binary format)
+			std::string m_buffer;				///< Encoded rows not yet sent
+			std::size_t m_row_start;			///< Offset of the row being encoded
+			std::uint64_t m_rows;				///< Rows written
+
+			/**
+			 * @param conn Connection in COPY IN state.
+			 * @param format Stream format.
+			 * @param columns Fields per row (0 = not checked).
+			 * @param types Column type OIDs (binary format).
+			 */
+			CopyWriter(struct pg_conn* conn, CopyFormat format, std::size_t columns, std::vector<unsigned int>&& types);
+
+			/**
+			 * Starts a row in the buffer.
+			 * @return false if the COPY is not active.
+			 */
+			bool BeginRow();
+
+			/**
+			 * Appends one field of the current row.
+			 * @param column Column position.
+			 * @param value Value to encode.
+			 * @return Nothing, or an error if @p value cannot be encoded for that column.
+			 */
+			Expected<void, QueryException> Encode(std::size_t column, const Value& value);
+
+			/**
+			 * Completes the current row and sends the buffer once it is large enough.
+			 * @param fields Fields written.
+			 * @return Nothing, or an error (wrong field count, connection failure).
+			 */
+			Expected<void, QueryException> EndRow(std::size_t fields);
+
+			/**
+			 * Drops the partially encoded current row.
+			 */
+			void DiscardRow() noexcept;
+
+			/**
+			 * Hands the buffer to PQputCopyData.
+			 * @return false on a connection error.
+			 */
+			bool Send() noexcept;
+	};
+
+	/**
+	 * @typedef ExpectedCopyWriter
+	 * @brief CopyWriter or QueryException.
+	 */
+	using ExpectedCopyWriter = Expected<CopyWriter, QueryException>;
+}
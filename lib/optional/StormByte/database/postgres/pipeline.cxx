@@ -0,0 +1,210 @@
+#include <StormByte/database/postgres/pipeline.hxx>
+#include <StormByte/database/postgres/result_fetch.hxx>
+#include <libpq-fe.h>
+
+#include <deque>
+#include <optional>
+#include <vector>
+
+using namespace StormByte::Database::Postgres;
+
+struct Pipeline::State {
+	/**
+	 * @struct Entry
+	 * @brief One expected reply: a statement result or a sync point.
+	 */
+	struct Entry {
+		bool sync;					///< PGRES_PIPELINE_SYNC marker
+		std::size_t index;			///< Slot in results (statements only)
+		ResultStorage storage;		///< Rows payload storage (statements only)
+	};
+
+	PGconn* conn;										///< Connection in pipeline mode (null once finished)
+	ResultStorage storage;								///< Storage for AddQuery()
+	std::deque<Entry> pending;							///< Sent, not yet read, in send order
+	std::vector<std::optional<ExpectedRows>> results;	///< Read results awaiting their future
+	bool unflushed = false;								///< Statements sent since the last sync / flush
+	bool unsynced = false;								///< Statements sent since the last sync
+
+	std::size_t Add(bool sent, ResultStorage rows_storage) {
+		const std::size_t index = results.size();
+		results.emplace_back();
+		if (!sent || !conn) {
+			const char* error = conn ? PQerrorMessage(conn) : nullptr;
+			results[index] = Unexpected<ExecuteError>(error && *error ? error : "Pipeline is not active");
+			return index;
+		}
+		pending.push_back({false, index, rows_storage});
+		unflushed = true;
+		unsynced = true;
+		return index;
+	}
+
+	bool Sync() noexcept {
+		if (!conn || PQpipelineSync(conn) != 1)
+			return false;
+		pending.push_back({true, 0, ResultStorage::Owned});
+		unflushed = false;
+		unsynced = false;
+		return true;
+	}
+
+	bool Flush() noexcept {
+		if (!conn)
+			return false;
+		if (unflushed && PQsendFlushRequest(conn) != 1)
+			return false;
+		unflushed = false;
+		return PQflush(conn) == 0;
+	}
+
+	void ReadNext() {
+		const Entry entry = pending.front();
+		pending.pop_front();
+
+		if (entry.sync) {
+			while (PGresult* res = PQgetResult(conn)) {
+				const bool synced = PQresultStatus(res) == PGRES_PIPELINE_SYNC;
+				PQclear(res);
+				if (synced)
+					break;
+			}
+			return;
+		}
+
+		PGresult* res = PQgetResult(conn);
+		if (!res) {
+			results[entry.index] = Unexpected<ExecuteError>(PQerrorMessage(conn) ? PQerrorMessage(conn) : "Missing pipeline result");
+			return;
+		}
+
+		switch (PQresultStatus(res)) {
+			case PGRES_TUPLES_OK:
+			case PGRES_COMMAND_OK:
+				results[entry.index] = StepResults(MakeShared(res), entry.storage);
+				break;
+			case PGRES_PIPELINE_ABORTED:
+				PQclear(res);
+				results[entry.index] = Unexpected<ExecuteError>("Aborted by an earlier failure in the pipeline");
+				break;
+			default:
+				results[entry.index] = Unexpected<ExecuteError>(PQresultErrorMessage(res));
+				PQclear(res);
+				break;
+		}
+
+		// Each statement's results are terminated by a null PGresult
+		while (PGresult* extra = PQgetResult(conn))
+			PQclear(extra);
+	}
+
+	ExpectedRows Take(std::size_t index) {
+		while (!results[index]) {
+			if (pending.empty() || !conn)
+				return Unexpected<ExecuteError>("Pipeline result was lost");
+			if (unflushed && !Flush())
+				return Unexpected<ExecuteError>(PQerrorMessage(conn) ? PQerrorMessage(conn) : "Pipeline flush failed");
+			ReadNext();
+		}
+		ExpectedRows result = std::move(*results[index]);
+		results[index].reset();
+		return result;
+	}
+
+	void Finish() noexcept {
+		if (!conn)
+			return;
+		if (unsynced)
+			Sync();
+		try {
+			while (!pending.empty())
+				ReadNext();
+		} catch (...) {
+			pending.clear();
+		}
+		PQexitPipelineMode(conn);
+		conn = nullptr;
+	}
+};
+
+Pipeline::Pipeline(struct pg_conn* conn, std::unordered_map<std::string, std::unique_ptr<StormByte::Database::PreparedSTMT>>* stmts, ResultStorage storage)
+	: m_state(std::make_shared<State>()), m_stmts(stmts) {
+	m_state->conn = conn;
+	m_state->storage = storage;
+}
+
+Pipeline::~Pipeline() noexcept {
+	Finish();
+}
+
+Pipeline& Pipeline::operator=(Pipeline&& other) noexcept {
+	if (this != &other) {
+		Finish();
+		m_state = std::move(other.m_state);
+		m_stmts = other.m_stmts;
+	}
+	return *this;
+}
+
+std::future<StormByte::Database::ExpectedRows> Pipeline::AddQuery(const std::string& query) {
+	if (!IsActive())
+		return Ready(Unexpected<ExecuteError>("Pipeline is not active"));
+	const bool sent = PQsendQueryParams(m_state->conn, query.c_str(), 0, nullptr, nullptr, nullptr, nullptr, 0) == 1;
+	return Queued(sent, m_state->storage);
+}
+
+bool Pipeline::Sync() noexcept {
+	return m_state && m_state->Sync();
+}
+
+bool Pipeline::Flush() noexcept {
+	return m_state && m_state->Flush();
+}
+
+void Pipeline::Finish() noexcept {
+	if (m_state)
+		m_state->Finish();
+}
+
+bool Pipeline::IsActive() const noexcept {
+	return m_state && m_state->conn;
+}
+
+PreparedSTMT* Pipeline::Find(const std::string& name) const noexcept {
+	if (!IsActive() || !m_stmts)
+		return nullptr;
+	auto it = m_stmts->find(name);
+	// Every statement of a Postgres connection is a Postgres::PreparedSTMT
+	return it == m_stmts->end() ? nullptr : static_cast<PreparedSTMT*>(it->second.get());
+}
+
+std::future<StormByte::Database::ExpectedRows> Pipeline::Queued(bool sent, ResultStorage storage) {
+	if (!m_state)
+		return Ready(Unexpected<ExecuteError>("Pipeline is not active"));
+	const std::size_t index = m_state->Add(sent, storage);
+	return std::async(std::launch::deferred, [state = m_state, index] {
+		return state->Take(index);
+	});
+}
+
+bool Pipeline::IsActive(const std::weak_ptr<State>& state) noexcept {
+	auto locked = state.lock();
+	return locked && locked->conn;
+}
+
+void Pipeline::Detach(const std::weak_ptr<State>& state) noexcept {
+	auto locked = state.lock();
+	if (!locked || !locked->conn)
+		return;
+	for (const auto& entry : locked->pending)
+		if (!entry.sync)
+			locked->results[entry.index] = Unexpected<ExecuteError>("Connection closed before the pipeline result was read");
+	locked->pending.clear();
+	locked->conn = nullptr;
+}
+
+std::future<StormByte::Database::ExpectedRows> Pipeline::Ready(ExpectedRows&& result) {
+	std::promise<ExpectedRows> promise;
+	promise.set_value(std::move(result));
+	return promise.get_future();
+}
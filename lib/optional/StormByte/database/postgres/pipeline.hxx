@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/postgres/prepared_stmt.hxx>
+#include <StormByte/database/rows.hxx>
+#include <StormByte/database/typedefs.hxx>
+
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+struct pg_conn;
+
+/**
+ * @namespace Postgres
+ * @brief PostgreSQL backend for StormByte::Database.
+ */
+namespace StormByte::Database::Postgres {
+	class Postgres;
+
+	/**
+	 * @class Pipeline
+	 * @brief Queues statements on a connection in libpq pipeline mode.
+	 *
+	 * Add() / AddQuery() send a statement without waiting for the previous one,
+	 * so N independent statements cost one round trip instead of N. Each call
+	 * returns a deferred std::future; get() flushes the queue if needed and reads
+	 * results, in order, up to its own.
+	 *
+	 * Statements up to a Sync() run as one implicit transaction: if one fails,
+	 * its future holds the error, the following ones up to the next Sync() hold
+	 * an "aborted" error, and the pipeline carries on after that Sync().
+	 *
+	 * @note While a Pipeline is active the connection accepts nothing else
+	 * (Query(), ExecuteSTMT(), ...). Finish() or destroy it first. Futures stay
+	 * readable after the Pipeline is finished or destroyed; the Pipeline must
+	 * not outlive its Postgres connection.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Pipeline {
+		friend class Postgres;
+		public:
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Pipeline(const Pipeline&) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			Pipeline(Pipeline&&) noexcept = default;
+
+			/**
+			 * Destructor. Calls Finish().
+			 */
+			~Pipeline() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Pipeline& operator=(const Pipeline&) = delete;
+
+			/**
+			 * Move assignment. Finishes the current pipeline first.
+			 */
+			Pipeline& operator=(Pipeline&& other) noexcept;
+
+			/**
+			 * Queues a prepared statement.
+			 * @tparam Args Argument types (see PreparedSTMT::BindNative).
+			 * @param name Prepared statement name.
+			 * @param args Positional bind values.
+			 * @return Future result (already set on an unknown statement or send failure).
+			 */
+			template<typename... Args>
+			std::future<ExpectedRows> Add(const std::string& name, const Args&... args) {
+				if (!IsActive())
+					return Ready(Unexpected<ExecuteError>("Pipeline is not active"));
+				PreparedSTMT* stmt = Find(name);
+				if (!stmt)
+					return Ready(Unexpected<UnknownSTMT>(name));
+				stmt->BindAll(args...);
+				return Queued(stmt->SendBound(), stmt->m_result_storage);
+			}
+
+			/**
+			 * Queues a plain query (one statement, text results).
+			 * @param query SQL text.
+			 * @return Future result (already set on a send failure).
+			 */
+			std::future<ExpectedRows> AddQuery(const std::string& query);
+
+			/**
+			 * Ends the current implicit transaction (PQpipelineSync) and sends the queue.
+			 * @return false on a connection error.
+			 */
+			bool Sync() noexcept;
+
+			/**
+			 * Sends the queue and asks the server to return the results so far,
+			 * without ending the implicit transaction.
+			 * @return false on a connection error.
+			 */
+			bool Flush() noexcept;
+
+			/**
+			 * Syncs, reads every outstanding result into its future and leaves
+			 * pipeline mode. Further Add() calls fail.
+			 */
+			void Finish() noexcept;
+
+			/**
+			 * @return true until Finish().
+			 */
+			bool IsActive() const noexcept;
+
+		private:
+			struct State;
+
+			std::shared_ptr<State> m_state;		///< Shared with the deferred futures
+			std::unordered_map<std::string, std::unique_ptr<StormByte::Database::PreparedSTMT>>* m_stmts;	///< Owner's prepared statements
+
+			/**
+			 * @param conn Connection, already in pipeline mode.
+			 * @param stmts Owner's prepared statements.
+			 * @param storage Result storage for AddQuery().
+			 */
+			Pipeline(struct pg_conn* conn, std::unordered_map<std::string, std::unique_ptr<StormByte::Database::PreparedSTMT>>* stmts, ResultStorage storage);
+
+			/**
+			 * @param name Statement name.
+			 * @return Statement, or nullptr if unknown or the pipeline is finished.
+			 */
+			PreparedSTMT* Find(const std::string& name) const noexcept;
+
+			/**
+			 * Registers a sent statement.
+			 * @param sent Whether libpq accepted it.
+			 * @param storage Result storage for its Rows.
+			 * @return Deferred future reading its result.
+			 */
+			std::future<ExpectedRows> Queued(bool sent, ResultStorage storage);
+
+			/**
+			 * @param result Result to hand out.
+			 * @return Future that is already set.
+			 */
+			static std::future<ExpectedRows> Ready(ExpectedRows&& result);
+
+			/**
+			 * @param state Pipeline state (may be expired).
+			 * @return true if that pipeline is still active.
+			 */
+			static bool IsActive(const std::weak_ptr<State>& state) noexcept;
+
+			/**
+			 * Abandons an active pipeline whose connection is closing: unread
+			 * results become errors and the connection is no longer touched.
+			 * @param state Pipeline state (may be expired).
+			 */
+			static void Detach(const std::weak_ptr<State>& state) noexcept;
+	};
+
+	/**
+	 * @typedef ExpectedPipeline
+	 * @brief Pipeline or QueryException.
+	 */
+	using ExpectedPipeline = Expected<Pipeline, QueryException>;
+}
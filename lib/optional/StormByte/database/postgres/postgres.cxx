@@ -1,10 +1,15 @@
 #include <StormByte/database/postgres/postgres.hxx>
+#include <StormByte/database/postgres/async_query.hxx>
+#include <StormByte/database/postgres/blob_stream.hxx>
+#include <StormByte/database/postgres/copy_source.hxx>
 #include <StormByte/database/postgres/result_fetch.hxx>
 #include <StormByte/database/postgres/prepared_stmt.hxx>
 
 #include <libpq-fe.h>
 #include <cctype>
+#include <charconv>
 #include <string>
+#include <vector>
 
 using namespace StormByte::Database::Postgres;
 
@@ -19,17 +24,57 @@ namespace {
 		if (!msg.empty())
 			*log << StormByte::Logger::Level::Notice << msg << std::endl;
 	}
+
+	/**
+	 * Text form of a non-NULL @p value as a PQexecParams parameter (bytea in hex format).
+	 */
+	std::string ParameterText(const StormByte::Database::Value& value) {
+		using StormByte::Database::Value;
+		char buffer[32];
+		switch (value.Type()) {
+			case Value::Type::Boolean:
+				return value.Get<bool>() ? "true" : "false";
+			case Value::Type::UnsignedInteger:
+			case Value::Type::UnsignedLongInteger:
+				return std::to_string(value.Get<unsigned long int>());
+			case Value::Type::Double:
+				return std::string(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value.Get<double>()).ptr);
+			case Value::Type::Text:
+				return value.Get<std::string>();
+			case Value::Type::Blob: {
+				static constexpr char digits[] = "0123456789abcdef";
+				std::string text = "\\x";
+				for (std::byte b : value.Get<std::span<const std::byte>>()) {
+					text += digits[std::to_integer<unsigned>(b) >> 4];
+					text += digits[std::to_integer<unsigned>(b) & 0x0F];
+				}
+				return text;
+			}
+			default:
+				return std::to_string(value.Get<long int>());
+		}
+	}
+
+	/**
+	 * Runs a command on @p conn, discarding its result.
+	 */
+	bool RunCommand(PGconn* conn, const char* command) {
+		PGresult* res = PQexec(conn, command);
+		const bool ok = res && PQresultStatus(res) == PGRES_COMMAND_OK;
+		PQclear(res);
+		return ok;
+	}
 }
 
 Postgres::Postgres(const std::string& host, const std::string& user, const std::string& password,
 				const std::string& db_name, std::shared_ptr<Logger::Log> logger)
 	: Database(logger), m_host(host), m_user(user), m_password(password),
-	m_dbname(db_name), m_conn(nullptr) {}
+	m_dbname(db_name), m_conn(nullptr), m_result_format(ResultFormat::Text) {}
 
 Postgres::Postgres(std::string&& host, std::string&& user, std::string&& password,
 				std::string&& db_name, std::shared_ptr<Logger::Log> logger)
 	: Database(logger), m_host(std::move(host)), m_user(std::move(user)),
-	m_password(std::move(password)), m_dbname(std::move(db_name)), m_conn(nullptr) {}
+	m_password(std::move(password)), m_dbname(std::move(db_name)), m_conn(nullptr), m_result_format(ResultFormat::Text) {}
 
 Postgres::~Postgres() noexcept {
 	if (m_logger)
@@ -94,6 +139,7 @@ bool Postgres::DoConnect() noexcept {
 }
 
 void Postgres::DoPreDisconnect() noexcept {
+	Pipeline::Detach(m_pipeline);
 	m_prepared_stmts.clear();
 }
 
@@ -104,7 +150,178 @@ void Postgres::DoDisconnect() noexcept {
 	}
 }
 
-StormByte::Database::ExpectedRows Postgres::Query(const std::string& query) noexcept {
+void Postgres::DoEvictSTMT(StormByte::Database::PreparedSTMT& stmt) noexcept {
+	// A pipeline owns the connection: the name is then released on disconnect
+	if (!m_conn || Pipeline::IsActive(m_pipeline))
+		return;
+	PGconn* conn = static_cast<PGconn*>(m_conn);
+	char* name = PQescapeIdentifier(conn, stmt.Name().c_str(), stmt.Name().size());
+	if (!name)
+		return;
+	PQclear(PQexec(conn, (std::string("DEALLOCATE ") + name).c_str()));
+	PQfreemem(name);
+}
+
+ExpectedPipeline Postgres::BeginPipeline() {
+	if (!m_connected || !m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+	if (Pipeline::IsActive(m_pipeline))
+		return Unexpected<ExecuteError>("A pipeline is already active on this connection");
+	if (PQenterPipelineMode(m_conn) != 1)
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn));
+
+	Pipeline pipeline(m_conn, &m_prepared_stmts, m_result_storage);
+	m_pipeline = pipeline.m_state;
+	return pipeline;
+}
+
+ExpectedCopyWriter Postgres::CopyIn(const std::string& table, const std::vector<std::string>& columns, CopyFormat format) {
+	if (!m_connected || !m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	std::string column_list;
+	for (const auto& column : columns)
+		column_list += (column_list.empty() ? "" : ", ") + column;
+
+	std::vector<unsigned int> types;
+	if (format == CopyFormat::Binary) {
+		// Binary tuples must match the column types exactly
+		auto shape = MakeShared(PQexec(m_conn, ("SELECT " + (column_list.empty() ? std::string("*") : column_list) + " FROM " + table + " LIMIT 0").c_str()));
+		if (!shape || PQresultStatus(shape.get()) != PGRES_TUPLES_OK)
+			return Unexpected<ExecuteError>(shape ? PQresultErrorMessage(shape.get()) : PQerrorMessage(m_conn));
+		for (int c = 0; c < PQnfields(shape.get()); ++c)
+			types.push_back(PQftype(shape.get(), c));
+	}
+
+	std::string query = "COPY " + table;
+	if (!column_list.empty())
+		query += " (" + column_list + ")";
+	query += format == CopyFormat::Binary ? " FROM STDIN (FORMAT binary)" : " FROM STDIN";
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Executing query: " << query << std::endl;
+
+	auto res = MakeShared(PQexec(m_conn, query.c_str()));
+	if (!res || PQresultStatus(res.get()) != PGRES_COPY_IN)
+		return Unexpected<ExecuteError>(res ? PQresultErrorMessage(res.get()) : PQerrorMessage(m_conn));
+
+	const std::size_t count = format == CopyFormat::Binary ? types.size() : columns.size();
+	return CopyWriter(m_conn, format, count, std::move(types));
+}
+
+StormByte::Database::ExpectedCursor Postgres::CopyOut(const std::string& query) {
+	if (!m_connected || !m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	// COPY OUT carries no column types: describe the query first
+	auto prepared = MakeShared(PQprepare(m_conn, "", query.c_str(), 0, nullptr));
+	if (!prepared || PQresultStatus(prepared.get()) != PGRES_COMMAND_OK)
+		return Unexpected<ExecuteError>(prepared ? PQresultErrorMessage(prepared.get()) : PQerrorMessage(m_conn));
+	auto described = MakeShared(PQdescribePrepared(m_conn, ""));
+	if (!described || PQresultStatus(described.get()) != PGRES_COMMAND_OK)
+		return Unexpected<ExecuteError>(described ? PQresultErrorMessage(described.get()) : PQerrorMessage(m_conn));
+	std::vector<Oid> types;
+	for (int c = 0; c < PQnfields(described.get()); ++c)
+		types.push_back(PQftype(described.get(), c));
+
+	const std::string copy = "COPY (" + query + ") TO STDOUT (FORMAT binary)";
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Executing query: " << copy << std::endl;
+
+	auto res = MakeShared(PQexec(m_conn, copy.c_str()));
+	if (!res || PQresultStatus(res.get()) != PGRES_COPY_OUT)
+		return Unexpected<ExecuteError>(res ? PQresultErrorMessage(res.get()) : PQerrorMessage(m_conn));
+	return Cursor(std::make_unique<CopySource>(m_conn, BuildSchema(described.get()), std::move(types)));
+}
+
+StormByte::Database::ExpectedBlobStream Postgres::DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+	if (Pipeline::IsActive(m_pipeline))
+		return Unexpected<ExecuteError>("A pipeline is active on this connection");
+	// Streams share the connection's transaction: closing one would end the other's
+	if (mode == BlobMode::Write && !m_blob_writer.expired())
+		return Unexpected<ExecuteError>("A write blob stream is already open on this connection");
+
+	const std::string key = std::to_string(location.key);
+	const std::string where = " FROM " + location.table + " WHERE " + location.key_column + " = $1";
+	const std::string params[] = { key };
+	SharedPGresult res = ExecText(m_conn, "SELECT octet_length(" + location.column + ")::text" + where, params);
+	if (!res || PQresultStatus(res.get()) != PGRES_TUPLES_OK)
+		return Unexpected<ExecuteError>(ResultError(m_conn, res));
+	if (PQntuples(res.get()) == 0)
+		return Unexpected<ExecuteError>("No row in " + location.table + " where " + location.key_column + " = " + key);
+
+	if (mode == BlobMode::Read) {
+		if (PQgetisnull(res.get(), 0, 0))
+			return Unexpected<ExecuteError>("Blob value is NULL");
+		const std::uint64_t bytes = std::stoull(std::string(PQgetvalue(res.get(), 0, 0), PQgetlength(res.get(), 0, 0)));
+		return std::make_unique<SubstringBlob>(m_conn, location, bytes);
+	}
+
+	// Large objects only exist inside a transaction: begin one, or nest in the caller's
+	std::string savepoint;
+	if (PQtransactionStatus(m_conn) != PQTRANS_IDLE)
+		savepoint = LargeObjectBlob::SavepointPrefix + std::to_string(++m_blob_savepoints);
+	const std::string begin = savepoint.empty() ? "BEGIN" : "SAVEPOINT " + savepoint;
+	SharedPGresult begun = MakeShared(PQexec(m_conn, begin.c_str()));
+	if (!begun || PQresultStatus(begun.get()) != PGRES_COMMAND_OK)
+		return Unexpected<ExecuteError>(ResultError(m_conn, begun));
+
+	const Oid oid = lo_creat(m_conn, INV_READ | INV_WRITE);
+	const int fd = oid == InvalidOid ? -1 : lo_open(m_conn, oid, INV_WRITE);
+	if (fd < 0) {
+		const std::string error = PQerrorMessage(m_conn);
+		LargeObjectBlob::Finish(m_conn, savepoint, false);
+		return Unexpected<ExecuteError>(error);
+	}
+	auto stream = std::make_unique<LargeObjectBlob>(m_conn, location, size, oid, fd, std::move(savepoint));
+	m_blob_writer = stream->OpenToken();
+	return stream;
+}
+
+StormByte::Database::SlowQueryLog::Explainer Postgres::DoExplainer() noexcept {
+	return [conn = m_conn](const std::string& sql, std::span<const Value> parameters) -> SlowQueryLog::ExpectedPlan {
+		if (PQpipelineStatus(conn) != PQ_PIPELINE_OFF)
+			return Unexpected<ExecuteError>("Connection is in pipeline mode");
+		const PGTransactionStatusType status = PQtransactionStatus(conn);
+		if (status == PQTRANS_INERROR)
+			return Unexpected<ExecuteError>("Transaction is aborted");
+		if (status != PQTRANS_IDLE && status != PQTRANS_INTRANS)
+			return Unexpected<ExecuteError>("Connection is busy");
+
+		// A failed EXPLAIN would abort the caller's transaction: contain it in a savepoint
+		const bool savepoint = status == PQTRANS_INTRANS;
+		if (savepoint && !RunCommand(conn, "SAVEPOINT stormbyte_explain"))
+			return Unexpected<ExecuteError>(PQerrorMessage(conn));
+
+		std::vector<std::string> texts;
+		std::vector<const char*> values;
+		texts.reserve(parameters.size());
+		values.reserve(parameters.size());
+		for (const Value& parameter : parameters) {
+			if (parameter.IsNull())
+				values.push_back(nullptr);
+			else
+				values.push_back(texts.emplace_back(ParameterText(parameter)).c_str());
+		}
+
+		const std::string explain = "EXPLAIN (FORMAT JSON) " + sql;
+		PGresult* res = PQexecParams(conn, explain.c_str(), static_cast<int>(values.size()), nullptr, values.data(), nullptr, nullptr, 0);
+		SlowQueryLog::ExpectedPlan plan = res && PQresultStatus(res) == PGRES_TUPLES_OK && PQntuples(res) > 0
+			? SlowQueryLog::ExpectedPlan(std::string(PQgetvalue(res, 0, 0), PQgetlength(res, 0, 0)))
+			: Unexpected<ExecuteError>(PQerrorMessage(conn));
+		PQclear(res);
+
+		if (savepoint) {
+			if (!plan)
+				RunCommand(conn, "ROLLBACK TO SAVEPOINT stormbyte_explain");
+			RunCommand(conn, "RELEASE SAVEPOINT stormbyte_explain");
+		}
+		return plan;
+	};
+}
+
+StormByte::Database::ExpectedRows Postgres::DoQuery(const std::string& query) noexcept {
 	if (m_logger)
 		*m_logger << Logger::Level::Debug << "Executing query: " << query << std::endl;
 
@@ -124,9 +341,38 @@ StormByte::Database::ExpectedRows Postgres::Query(const std::string& query) noex
 		return Unexpected<ExecuteError>(err);
 	}
 
-	ExpectedRows rows = StepResults(res);
+	return StepResults(MakeShared(res), m_result_storage);
+}
+
+StormByte::Database::ExpectedColumnarRows Postgres::DoQueryColumnar(const std::string& query) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	PGresult* res = PQexec(static_cast<PGconn*>(m_conn), query.c_str());
+	if (!res)
+		return Unexpected<ExecuteError>("Null PGresult");
+
+	ExpectedColumnarRows result = StepColumnar(res);
 	PQclear(res);
-	return rows;
+	return result;
+}
+
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> Postgres::DoQueryAsync(const std::string& query) {
+	return std::make_unique<AsyncQuery>(m_conn, [query](PGconn* conn) {
+		return PQsendQuery(conn, query.c_str()) == 1;
+	}, m_result_storage);
+}
+
+StormByte::Database::ExpectedCursor Postgres::DoQueryStream(const std::string& query) {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("Database not connected");
+
+	if (!PQsendQuery(m_conn, query.c_str())) {
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn)
+			? PQerrorMessage(m_conn)
+			: "Unknown Postgres error");
+	}
+	return StreamResults(m_conn);
 }
 
 bool Postgres::SilentQuery(const std::string& query) noexcept {
@@ -198,7 +444,24 @@ Postgres::CreatePreparedSTMT(std::string&& name, std::string&& query) noexcept {
 
 	std::unique_ptr<PreparedSTMT> stmt =
 		std::make_unique<PreparedSTMT>(PreparedSTMT(std::move(name), std::move(query), m_logger));
+
+	// Parameter types inferred by the server select the binary encoders
+	PGresult* desc = PQdescribePrepared(conn, stmt->m_stmt_name.c_str());
+	if (desc && PQresultStatus(desc) == PGRES_COMMAND_OK) {
+		const int nparams = PQnparams(desc);
+		stmt->m_param_types.reserve(nparams);
+		for (int i = 0; i < nparams; ++i)
+			stmt->m_param_types.push_back(PQparamtype(desc, i));
+	} else if (m_logger) {
+		*m_logger << Logger::Level::Warning
+				<< "PQdescribePrepared failed for statement '" << stmt->m_stmt_name
+				<< "'; parameters will be sent as text" << std::endl;
+	}
+	if (desc)
+		PQclear(desc);
+
 	stmt->m_conn = m_conn;
+	stmt->m_result_format = m_result_format;
 	return stmt;
 }
 
@@ -20,10 +20,14 @@
 #pragma once
 
 #include <StormByte/database/database.hxx>
+#include <StormByte/database/postgres/copy_writer.hxx>
+#include <StormByte/database/postgres/pipeline.hxx>
 #include <StormByte/database/postgres/prepared_stmt.hxx>
 
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 struct pg_conn;
 
@@ -69,13 +73,6 @@ namespace StormByte::Database::Postgres {
 			 */
 			~Postgres() noexcept override;
 
-			/**
-			 * Executes a query and returns rows.
-			 * @param query SQL text.
-			 * @return Result rows or an error.
-			 */
-			ExpectedRows Query(const std::string& query) noexcept override;
-
 			/**
 			 * Executes a query that does not return rows.
 			 * @param query SQL text.
@@ -83,6 +80,50 @@ namespace StormByte::Database::Postgres {
 			 */
 			bool SilentQuery(const std::string& query) noexcept override;
 
+			/**
+			 * Sets the result format of statements prepared afterwards (call it
+			 * before Connect() to cover the ones prepared in DoPostConnect()).
+			 * ResultFormat::Binary applies to ExecuteSTMT() and ExecuteSTMTStream();
+			 * Query() and the columnar paths always use the text format.
+			 * @param format Result format.
+			 */
+			void SetResultFormat(ResultFormat format) noexcept {
+				m_result_format = format;
+			}
+
+			/**
+			 * @return Result format for newly prepared statements.
+			 */
+			ResultFormat GetResultFormat() const noexcept {
+				return m_result_format;
+			}
+
+			/**
+			 * Enters libpq pipeline mode and returns the Pipeline that drives it.
+			 * Until the Pipeline is finished or destroyed the connection only
+			 * accepts statements through it.
+			 * @return Pipeline or an error (not connected, pipeline already active).
+			 */
+			ExpectedPipeline BeginPipeline();
+
+			/**
+			 * Starts COPY @p table FROM STDIN and returns the writer streaming its rows.
+			 * @param table Table name, as written in SQL.
+			 * @param columns Columns filled by each row, in order (empty: all of them, in table order).
+			 * @param format Stream format (CopyFormat::Binary looks the column types up first).
+			 * @return Writer or an error.
+			 */
+			ExpectedCopyWriter CopyIn(const std::string& table, const std::vector<std::string>& columns = {}, CopyFormat format = CopyFormat::Text);
+
+			/**
+			 * Runs COPY (@p query) TO STDOUT in binary format and streams its rows.
+			 * Cells are decoded as with ResultFormat::Binary; one row is held at a time.
+			 * @param query Row-returning statement (SELECT, VALUES, ...).
+			 * @return Cursor over the rows or an error. The connection accepts
+			 * nothing else until the cursor is exhausted or destroyed.
+			 */
+			ExpectedCursor CopyOut(const std::string& query);
+
 		protected:
 			/**
 			 * @param host Host name or address.
@@ -118,6 +159,10 @@ namespace StormByte::Database::Postgres {
 			std::string m_password;		///< Password
 			std::string m_dbname;		///< Database name
 			struct pg_conn* m_conn;		///< Connection handle
+			ResultFormat m_result_format;	///< Format for newly prepared statements
+			std::weak_ptr<Pipeline::State> m_pipeline;	///< Active pipeline, if any
+			std::weak_ptr<const bool> m_blob_writer;	///< Open write BlobStream, if any
+			std::uint64_t m_blob_savepoints = 0;		///< Names write BlobStream savepoints
 
 			/**
 			 * Connects via PQconnectdb.
@@ -135,6 +180,31 @@ namespace StormByte::Database::Postgres {
 			 */
 			void DoDisconnect() noexcept override;
 
+			/**
+			 * Releases an evicted cached statement on the server (DEALLOCATE).
+			 * @param stmt Evicted statement.
+			 */
+			void DoEvictSTMT(StormByte::Database::PreparedSTMT& stmt) noexcept override;
+
+			/**
+			 * Opens a bytea cell as a BlobStream: reads run one substring() per
+			 * chunk, writes are staged in a large object applied on Close().
+			 * @param location Table, column and row of the value.
+			 * @param mode Stream direction.
+			 * @param size Size of the new value (BlobMode::Write only).
+			 * @return SubstringBlob / LargeObjectBlob or an error.
+			 */
+			ExpectedBlobStream DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) override;
+
+			/**
+			 * Explains slow statements with EXPLAIN (FORMAT JSON), parameters sent
+			 * as text. Inside a transaction the EXPLAIN runs in a savepoint so a
+			 * failure does not abort it; nothing is captured in pipeline mode or
+			 * in an aborted transaction.
+			 * @return Explainer bound to the connection handle.
+			 */
+			SlowQueryLog::Explainer DoExplainer() noexcept override;
+
 			/**
 			 * Creates a PostgreSQL prepared statement (PQprepare).
 			 * @param name Statement name.
@@ -143,6 +213,34 @@ namespace StormByte::Database::Postgres {
 			 */
 			std::unique_ptr<StormByte::Database::PreparedSTMT> CreatePreparedSTMT(std::string&& name, std::string&& query) noexcept override;
 
+			/**
+			 * Executes @p query and decodes the result into rows.
+			 * @param query SQL text.
+			 * @return Result rows or an error.
+			 */
+			ExpectedRows DoQuery(const std::string& query) noexcept override;
+
+			/**
+			 * Executes @p query and decodes the result into columns.
+			 * @param query SQL text.
+			 * @return Columnar result or an error.
+			 */
+			ExpectedColumnarRows DoQueryColumnar(const std::string& query) override;
+
+			/**
+			 * Sends @p query with PQsendQuery and streams its rows.
+			 * @param query SQL text.
+			 * @return Cursor over the result rows or an error.
+			 */
+			ExpectedCursor DoQueryStream(const std::string& query) override;
+
+			/**
+			 * Sends @p query with PQsendQuery on the non-blocking connection.
+			 * @param query SQL text.
+			 * @return Operation reading the reply as the socket becomes readable.
+			 */
+			std::unique_ptr<AsyncResult<ExpectedRows>> DoQueryAsync(const std::string& query) override;
+
 			/**
 			 * BEGIN with isolation level.
 			 * @param level Isolation level.
@@ -1,115 +1,218 @@
 #include <StormByte/database/postgres/prepared_stmt.hxx>
+#include <StormByte/database/postgres/async_query.hxx>
 #include <StormByte/database/postgres/result_fetch.hxx>
+#include <StormByte/database/postgres/binary.hxx>
 #include <libpq-fe.h>
 
+#include <charconv>
+#include <cstring>
+#include <limits>
+
 using namespace StormByte::Database::Postgres;
 
+// Rows queued in a batch pipeline before the pending results are read back
+static constexpr std::size_t batch_window = 256;
+
 PreparedSTMT::PreparedSTMT(const std::string& name, const std::string& query, std::shared_ptr<Logger::Log> logger)
-	: Database::PreparedSTMT(name, query, std::move(logger)), m_conn(nullptr), m_stmt_name(name) {}
+	: Database::PreparedSTMT(name, query, std::move(logger)), m_conn(nullptr), m_stmt_name(name), m_result_format(ResultFormat::Text) {}
 
 PreparedSTMT::PreparedSTMT(std::string&& name, std::string&& query, std::shared_ptr<Logger::Log> logger) noexcept
-	: Database::PreparedSTMT(std::move(name), std::move(query), std::move(logger)), m_conn(nullptr), m_stmt_name(Database::PreparedSTMT::m_name) {}
+	: Database::PreparedSTMT(std::move(name), std::move(query), std::move(logger)), m_conn(nullptr), m_stmt_name(Database::PreparedSTMT::m_name), m_result_format(ResultFormat::Text) {}
 
 void PreparedSTMT::Binder(const int& index, Value&& value) noexcept {
-	if (static_cast<std::size_t>(index) >= m_param_values.size()) {
-		m_param_values.resize(index + 1, nullptr);
-		m_param_lengths.resize(index + 1, 0);
-		m_param_formats.resize(index + 1, 0);
-	}
-
 	if (value.IsNull()) {
-		m_param_values[index] = nullptr;
-		m_param_lengths[index] = 0;
-		m_param_formats[index] = 0;
+		BindNull(index);
 		return;
 	}
 
-	switch (value.Type()) {
-		case Value::Type::Integer:
-			m_string_storage.emplace_back(std::to_string(value.Get<int>()));
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::UnsignedInteger:
-			m_string_storage.emplace_back(std::to_string(value.Get<unsigned int>()));
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::LongInteger:
-			m_string_storage.emplace_back(std::to_string(value.Get<long int>()));
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::UnsignedLongInteger:
-			m_string_storage.emplace_back(std::to_string(value.Get<unsigned long int>()));
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::Double:
-			m_string_storage.emplace_back(std::to_string(value.Get<double>()));
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::Boolean:
-			m_string_storage.emplace_back(value.Get<bool>() ? "true" : "false");
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::Text:
-			m_string_storage.emplace_back(value.Get<std::string>());
-			m_param_values[index] = m_string_storage.back().c_str();
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
-			break;
-		case Value::Type::Blob: {
-			auto bv = value.Get<std::vector<std::byte>>();
-			m_blob_storage.emplace_back();
-			m_blob_storage.back().resize(bv.size());
-			for (std::size_t i = 0; i < bv.size(); ++i)
-				m_blob_storage.back()[i] = static_cast<char>(bv[i]);
-			m_param_values[index] = m_blob_storage.back().data();
-			m_param_lengths[index] = static_cast<int>(m_blob_storage.back().size());
-			m_param_formats[index] = 1;
-			break;
+	try {
+		switch (value.Type()) {
+			case Value::Type::Integer:			BindInt64(index, value.Get<int>()); break;
+			case Value::Type::UnsignedInteger:	BindInt64(index, value.Get<unsigned int>()); break;
+			case Value::Type::LongInteger:		BindInt64(index, value.Get<long int>()); break;
+			case Value::Type::UnsignedLongInteger: {
+				const unsigned long int v = value.Get<unsigned long int>();
+				if (v > static_cast<unsigned long int>(std::numeric_limits<std::int64_t>::max()))
+					AppendNumber(index, v);
+				else
+					BindInt64(index, static_cast<std::int64_t>(v));
+				break;
+			}
+			case Value::Type::Double:			BindDouble(index, value.Get<double>()); break;
+			case Value::Type::Boolean:			BindBool(index, value.Get<bool>()); break;
+			case Value::Type::Text:
+				if (value.IsView())
+					BindText(index, value.Get<std::string_view>());
+				else
+					CopyText(index, value.Get<std::string_view>());
+				break;
+			case Value::Type::Blob:
+				if (value.IsView())
+					BindBlob(index, value.Get<std::span<const std::byte>>());
+				else
+					CopyBlob(index, value.Get<std::span<const std::byte>>());
+				break;
+			default:							BindNull(index); break;
 		}
+	} catch (...) {
+		BindNull(index);
+	}
+}
+
+void PreparedSTMT::BindInt64(int index, std::int64_t value) noexcept {
+	using namespace Binary;
+	switch (ParamType(index)) {
+		case 21:
+			if (value < std::numeric_limits<std::int16_t>::min() || value > std::numeric_limits<std::int16_t>::max())
+				break;	// Out of range for the binary type: let the server parse the text form
+			WriteInt<std::int16_t>(AppendParam(index, 2, 1), static_cast<std::int16_t>(value));
+			return;
+		case 23:
+			if (value < std::numeric_limits<std::int32_t>::min() || value > std::numeric_limits<std::int32_t>::max())
+				break;
+			WriteInt<std::int32_t>(AppendParam(index, 4, 1), static_cast<std::int32_t>(value));
+			return;
+		case 20:
+			WriteInt<std::int64_t>(AppendParam(index, 8, 1), value);
+			return;
+		case 700:
+			WriteFloat<float>(AppendParam(index, 4, 1), static_cast<float>(value));
+			return;
+		case 701:
+			WriteFloat<double>(AppendParam(index, 8, 1), static_cast<double>(value));
+			return;
 		default:
-			m_param_values[index] = nullptr;
-			m_param_lengths[index] = 0;
-			m_param_formats[index] = 0;
 			break;
 	}
+	AppendNumber(index, value);
+}
+
+void PreparedSTMT::BindDouble(int index, double value) noexcept {
+	using namespace Binary;
+	switch (ParamType(index)) {
+		case 700:
+			WriteFloat<float>(AppendParam(index, 4, 1), static_cast<float>(value));
+			return;
+		case 701:
+			WriteFloat<double>(AppendParam(index, 8, 1), value);
+			return;
+		default:
+			AppendNumber(index, value);
+			return;
+	}
+}
+
+void PreparedSTMT::BindBool(int index, bool value) noexcept {
+	if (ParamType(index) == 16)
+		*AppendParam(index, 1, 1) = value ? 1 : 0;
+	else
+		BindText(index, value ? "true" : "false");
+}
+
+void PreparedSTMT::BindText(int index, std::string_view value) noexcept {
+	switch (ParamType(index)) {
+		case 19:	// name
+		case 25:	// text
+		case 114:	// json
+		case 1042:	// bpchar
+		case 1043:	// varchar
+			// The binary form of these types is the text itself, unterminated
+			BorrowParam(index, value.data(), value.size());
+			return;
+		default:
+			CopyText(index, value);
+			return;
+	}
+}
+
+void PreparedSTMT::BindBlob(int index, std::span<const std::byte> value) noexcept {
+	// Blobs are always sent raw, whatever the parameter type
+	BorrowParam(index, value.data(), value.size());
+}
+
+void PreparedSTMT::BorrowParam(int index, const void* data, std::size_t size) {
+	ReserveParam(index);
+	// libpq treats a null pointer as SQL NULL, so empty values need a real one
+	m_param_borrowed[index] = size == 0 ? "" : static_cast<const char*>(data);
+	m_param_offsets[index] = -1;
+	m_param_lengths[index] = static_cast<int>(size);
+	m_param_formats[index] = 1;
+}
+
+void PreparedSTMT::CopyText(int index, std::string_view value) {
+	char* dest = AppendParam(index, value.size() + 1, 0);
+	if (!value.empty())
+		std::memcpy(dest, value.data(), value.size());
+	dest[value.size()] = '\0';
+}
+
+void PreparedSTMT::CopyBlob(int index, std::span<const std::byte> value) {
+	char* dest = AppendParam(index, value.size(), 1);
+	if (!value.empty())
+		std::memcpy(dest, value.data(), value.size());
+}
+
+void PreparedSTMT::BindNull(int index) noexcept {
+	ReserveParam(index);
+	m_param_borrowed[index] = nullptr;
+	m_param_offsets[index] = -1;
+	m_param_lengths[index] = 0;
+	m_param_formats[index] = 0;
+}
+
+void PreparedSTMT::ReserveParam(int index) {
+	if (static_cast<std::size_t>(index) >= m_param_offsets.size()) {
+		m_param_offsets.resize(index + 1, -1);
+		m_param_borrowed.resize(index + 1, nullptr);
+		m_param_lengths.resize(index + 1, 0);
+		m_param_formats.resize(index + 1, 0);
+	}
+}
+
+char* PreparedSTMT::AppendParam(int index, std::size_t size, int format) {
+	ReserveParam(index);
+	const std::size_t offset = m_param_buffer.size();
+	m_param_buffer.resize(offset + size);
+	m_param_borrowed[index] = nullptr;
+	m_param_offsets[index] = static_cast<int>(offset);
+	m_param_lengths[index] = format == 1 ? static_cast<int>(size) : 0;
+	m_param_formats[index] = format;
+	return m_param_buffer.data() + offset;
+}
+
+template<typename T>
+void PreparedSTMT::AppendNumber(int index, T value) {
+	// Room for any integer or shortest round-trip double, plus the terminator
+	constexpr std::size_t number_size = 32;
+	char* dest = AppendParam(index, number_size, 0);
+	char* end = std::to_chars(dest, dest + number_size - 1, value).ptr;
+	*end = '\0';
+	m_param_buffer.resize(m_param_buffer.size() - number_size + (end - dest) + 1);
+}
+
+void PreparedSTMT::ResolveParams() noexcept {
+	m_param_values.resize(m_param_offsets.size());
+	for (std::size_t i = 0; i < m_param_offsets.size(); ++i)
+		m_param_values[i] = m_param_borrowed[i] ? m_param_borrowed[i] : m_param_offsets[i] < 0 ? nullptr : m_param_buffer.data() + m_param_offsets[i];
 }
 
 void PreparedSTMT::Reset() noexcept {
+	// clear() keeps the capacity, so the next execution reuses the buffers
 	m_param_values.clear();
+	m_param_offsets.clear();
+	m_param_borrowed.clear();
 	m_param_lengths.clear();
 	m_param_formats.clear();
-	m_string_storage.clear();
-	m_blob_storage.clear();
+	m_param_buffer.clear();
 }
 
 StormByte::Database::ExpectedRows PreparedSTMT::DoExecute() {
 	if (!m_conn)
 		return Unexpected<ExecuteError>("No connection available for prepared statement");
 
-	int nParams = static_cast<int>(m_param_values.size());
-	std::vector<const char*> params(nParams);
-	std::vector<int> lengths(nParams);
-	std::vector<int> formats(nParams);
-
-	for (int i = 0; i < nParams; ++i) {
-		params[i] = m_param_values[i];
-		lengths[i] = m_param_lengths[i];
-		formats[i] = m_param_formats[i];
-	}
-
-	PGresult* res = PQexecPrepared(m_conn, m_stmt_name.c_str(), nParams, params.data(), lengths.data(), formats.data(), 0);
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	PGresult* res = PQexecPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), ResultFormatCode());
 	if (!res) {
 		return Unexpected<ExecuteError>("Null PGresult from PQexecPrepared");
 	}
@@ -121,7 +224,157 @@ StormByte::Database::ExpectedRows PreparedSTMT::DoExecute() {
 		return Unexpected<ExecuteError>(err);
 	}
 
-	ExpectedRows rows = StepResults(res);
+	return StepResults(MakeShared(res), m_result_storage);
+}
+
+StormByte::Database::ExpectedColumnarRows PreparedSTMT::DoExecuteColumnar() {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("No connection available for prepared statement");
+
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	PGresult* res = PQexecPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), 0);
+	if (!res) {
+		return Unexpected<ExecuteError>("Null PGresult from PQexecPrepared");
+	}
+
+	ExpectedColumnarRows result = StepColumnar(res);
 	PQclear(res);
-	return rows;
+	return result;
+}
+
+StormByte::Database::ExpectedCursor PreparedSTMT::DoExecuteStream() {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("No connection available for prepared statement");
+
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	if (!PQsendQueryPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), ResultFormatCode())) {
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Unknown Postgres error");
+	}
+	return StreamResults(m_conn);
+}
+
+bool PreparedSTMT::SendBound() noexcept {
+	if (!m_conn)
+		return false;
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	const int sent = PQsendQueryPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), ResultFormatCode());
+	// libpq copied the parameters into its output buffer
+	Reset();
+	return sent == 1;
+}
+
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> PreparedSTMT::DoExecuteAsync() {
+	return std::make_unique<AsyncQuery>(m_conn, [this](PGconn*) {
+		return SendBound();
+	}, m_result_storage);
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBeginBatch() {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("No connection available for prepared statement");
+	if (PQenterPipelineMode(m_conn) != 1)
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Cannot enter pipeline mode");
+	m_batch_sent = 0;
+	m_batch_read = 0;
+	return {};
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBatchRow(BatchResult& result) {
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	const int sent = PQsendQueryPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), 0);
+	// libpq copied the parameters into its output buffer
+	Reset();
+	if (!sent)
+		return Unexpected<BatchError>(result.rows, PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Unknown Postgres error");
+	++m_batch_sent;
+
+	if (m_batch_sent - m_batch_read >= batch_window) {
+		if (PQsendFlushRequest(m_conn) != 1 || PQflush(m_conn) != 0)
+			return Unexpected<BatchError>(result.rows, PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Unknown Postgres error");
+		while (m_batch_read < m_batch_sent) {
+			auto read = ReadBatchResult(result);
+			if (!read)
+				return read;
+		}
+	}
+	return {};
+}
+
+StormByte::Database::ExpectedBatch PreparedSTMT::DoEndBatch(ExpectedBatch&& result) {
+	if (PQpipelineSync(m_conn) != 1 && result)
+		result = Unexpected<ExecuteError>(PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Unknown Postgres error");
+
+	// Rows after a failure come back as aborted; only the first failure is reported
+	BatchResult discarded;
+	while (m_batch_read < m_batch_sent) {
+		auto read = ReadBatchResult(result ? *result : discarded);
+		if (!read && result)
+			result = Unexpected(read.error());
+	}
+
+	PGresult* res;
+	while ((res = PQgetResult(m_conn)) != nullptr) {
+		const bool synced = PQresultStatus(res) == PGRES_PIPELINE_SYNC;
+		PQclear(res);
+		if (synced)
+			break;
+	}
+	PQexitPipelineMode(m_conn);
+	return std::move(result);
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::ReadBatchResult(BatchResult& result) {
+	const std::size_t index = m_batch_read++;
+	PGresult* res = PQgetResult(m_conn);
+	if (!res)
+		return Unexpected<BatchError>(index, PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Missing pipeline result");
+
+	StormByte::Expected<void, QueryException> outcome;
+	switch (PQresultStatus(res)) {
+		case PGRES_COMMAND_OK:
+		case PGRES_TUPLES_OK: {
+			const std::string_view tuples = PQcmdTuples(res);
+			std::uint64_t affected = 0;
+			std::from_chars(tuples.data(), tuples.data() + tuples.size(), affected);
+			result.affected.push_back(affected);
+			result.total_affected += affected;
+			break;
+		}
+		case PGRES_PIPELINE_ABORTED:
+			outcome = Unexpected<BatchError>(index, "aborted by an earlier failure in the pipeline");
+			break;
+		default:
+			outcome = Unexpected<BatchError>(index, PQresultErrorMessage(res));
+			break;
+	}
+	PQclear(res);
+
+	// Each queued query's results are terminated by a null PGresult
+	while ((res = PQgetResult(m_conn)) != nullptr)
+		PQclear(res);
+	return outcome;
+}
+
+StormByte::Database::ExpectedRowReader PreparedSTMT::DoExecuteReader() {
+	if (!m_conn)
+		return Unexpected<ExecuteError>("No connection available for prepared statement");
+
+	ResolveParams();
+	const int nParams = static_cast<int>(m_param_values.size());
+	SharedPGresult res = MakeShared(PQexecPrepared(m_conn, m_stmt_name.c_str(), nParams, m_param_values.data(), m_param_lengths.data(), m_param_formats.data(), ResultFormatCode()));
+	if (!res) {
+		return Unexpected<ExecuteError>("Null PGresult from PQexecPrepared");
+	}
+
+	const ExecStatusType st = PQresultStatus(res.get());
+	if (st == PGRES_COMMAND_OK)
+		return std::unique_ptr<RowReader>();
+	if (st != PGRES_TUPLES_OK)
+		return Unexpected<ExecuteError>(PQerrorMessage(m_conn) ? PQerrorMessage(m_conn) : "Unknown Postgres error");
+
+	return std::make_unique<ResultReader>(std::move(res));
 }
@@ -33,12 +33,30 @@ struct pg_conn;
  * @brief PostgreSQL backend for StormByte::Database.
  */
 namespace StormByte::Database::Postgres {
+	class Pipeline;
+
+	/**
+	 * @enum ResultFormat
+	 * @brief Wire format requested for prepared statement results.
+	 */
+	enum class ResultFormat {
+		Text,		///< Text format (PostgreSQL default); cells are parsed client-side
+		Binary		///< Binary format; cells are decoded from their native representation by type OID
+	};
+
 	/**
 	 * @class PreparedSTMT
 	 * @brief PostgreSQL prepared statement (PQexecPrepared).
+	 *
+	 * Parameters are encoded into one reusable per-statement buffer. Their types
+	 * are taken from PQdescribePrepared when the statement is prepared: int2 /
+	 * int4 / int8, float4 / float8, bool and bytea parameters are sent in binary
+	 * format, everything else as text. Once the buffers have grown to the
+	 * statement's working size, binding and executing allocate nothing.
 	 */
 	class STORMBYTE_DATABASE_PUBLIC PreparedSTMT final : public StormByte::Database::PreparedSTMT {
 		friend class Postgres;
+		friend class Pipeline;
 	public:
 		/**
 		 * Copy constructor (deleted).
@@ -69,11 +87,16 @@ namespace StormByte::Database::Postgres {
 		struct pg_conn* m_conn;							///< Connection handle
 		std::string m_stmt_name;						///< Server-side statement name
 
-		std::vector<const char*> m_param_values;		///< Bind value pointers
-		std::vector<int> m_param_lengths;				///< Bind lengths (blobs)
+		std::vector<unsigned int> m_param_types;		///< Parameter type OIDs (PQdescribePrepared)
+		std::vector<const char*> m_param_values;		///< Bind value pointers (set by ResolveParams())
+		std::vector<int> m_param_offsets;				///< Offset of each bound value in m_param_buffer (-1 = NULL or borrowed)
+		std::vector<const char*> m_param_borrowed;		///< Caller-owned value sent in place (nullptr = use m_param_offsets)
+		std::vector<int> m_param_lengths;				///< Bind lengths (binary values)
 		std::vector<int> m_param_formats;				///< 0 = text, 1 = binary
-		std::vector<std::string> m_string_storage;		///< Owns text/numeric string params
-		std::vector<std::vector<char>> m_blob_storage;	///< Owns blob params
+		std::vector<char> m_param_buffer;				///< Encoded bound values
+		ResultFormat m_result_format;					///< Format requested for Execute / ExecuteStream results
+		std::size_t m_batch_sent = 0;					///< ExecuteBatch() rows sent in the pipeline
+		std::size_t m_batch_read = 0;					///< ExecuteBatch() results read back
 
 		/**
 		 * @param name Statement name.
@@ -90,18 +113,174 @@ namespace StormByte::Database::Postgres {
 		PreparedSTMT(std::string&& name, std::string&& query, std::shared_ptr<Logger::Log> logger) noexcept;
 
 		/**
-		 * Stores a bound value at @p index.
+		 * Stores a bound value at @p index, dispatching to the native binders.
+		 * Text / blob views are sent in place; owned payloads, which die with
+		 * @p value, are copied into the parameter buffer.
 		 * @param index Parameter index.
 		 * @param value Value to bind.
 		 */
 		void Binder(const int& index, Value&& value) noexcept override;
 
+		/**
+		 * @name Native binders
+		 * Encode straight into the parameter buffer: binary when the parameter
+		 * OID has a binary encoder for the argument, text otherwise. Blobs, and
+		 * text for text-typed parameters (whose binary form is the raw bytes),
+		 * are not copied: libpq reads them from the caller's buffer.
+		 * @{
+		 */
+		void BindInt64(int index, std::int64_t value) noexcept override;
+		void BindDouble(int index, double value) noexcept override;
+		void BindBool(int index, bool value) noexcept override;
+		void BindText(int index, std::string_view value) noexcept override;
+		void BindBlob(int index, std::span<const std::byte> value) noexcept override;
+		void BindNull(int index) noexcept override;
+		/** @} */
+
+		/**
+		 * @param index Parameter index.
+		 * @return Parameter type OID (0 if unknown).
+		 */
+		inline unsigned int ParamType(int index) const noexcept {
+			return static_cast<std::size_t>(index) < m_param_types.size() ? m_param_types[index] : 0;
+		}
+
+		/**
+		 * Grows the parameter arrays to hold parameter @p index.
+		 * @param index Parameter index.
+		 */
+		void ReserveParam(int index);
+
+		/**
+		 * Reserves room for the value of parameter @p index in the buffer.
+		 * @param index Parameter index.
+		 * @param size Bytes to reserve.
+		 * @param format 0 = text (NUL-terminated), 1 = binary.
+		 * @return Where to write the value (valid until the next reservation).
+		 */
+		char* AppendParam(int index, std::size_t size, int format);
+
+		/**
+		 * Sends @p size bytes at @p data in binary format without copying them.
+		 * @param index Parameter index.
+		 * @param data Caller-owned value, valid until the statement is sent.
+		 * @param size Value length.
+		 */
+		void BorrowParam(int index, const void* data, std::size_t size);
+
+		/**
+		 * Copies @p value into the buffer as a text-format parameter.
+		 * @param index Parameter index.
+		 * @param value Text to copy.
+		 */
+		void CopyText(int index, std::string_view value);
+
+		/**
+		 * Copies @p value into the buffer as a binary-format parameter.
+		 * @param index Parameter index.
+		 * @param value Bytes to copy.
+		 */
+		void CopyBlob(int index, std::span<const std::byte> value);
+
+		/**
+		 * Encodes @p value as text at parameter @p index.
+		 * @param index Parameter index.
+		 * @param value Number to encode.
+		 */
+		template<typename T>
+		void AppendNumber(int index, T value);
+
+		/**
+		 * Binds @p args natively, replacing any previous bindings.
+		 * @param args Positional bind values.
+		 */
+		template<typename... Args>
+		void BindAll(const Args&... args) noexcept {
+			Reset();
+			int index = 0;
+			(BindNative(index++, args), ...);
+		}
+
+		/**
+		 * Queues the bound statement with PQsendQueryPrepared (pipeline mode) and clears the bindings.
+		 * @return false if libpq refused to queue it.
+		 */
+		bool SendBound() noexcept;
+
+		/**
+		 * Points m_param_values into the (now stable) parameter buffer or at
+		 * the borrowed caller values.
+		 */
+		void ResolveParams() noexcept;
+
+		/**
+		 * @return resultFormat argument for PQexecPrepared / PQsendQueryPrepared.
+		 */
+		inline int ResultFormatCode() const noexcept {
+			return m_result_format == ResultFormat::Binary ? 1 : 0;
+		}
+
 		/**
 		 * Executes via PQexecPrepared.
 		 * @return Result rows or an error.
 		 */
 		ExpectedRows DoExecute() override;
 
+		/**
+		 * Executes the statement and decodes the result into columns.
+		 * @return Columnar result or an error.
+		 */
+		ExpectedColumnarRows DoExecuteColumnar() override;
+
+		/**
+		 * Sends via PQsendQueryPrepared and streams the rows.
+		 * @return Cursor over the result rows or an error.
+		 */
+		ExpectedCursor DoExecuteStream() override;
+
+		/**
+		 * Non-blocking execution: PQsendQueryPrepared when started, then the
+		 * reply is read as the socket becomes readable.
+		 * @return Operation (not started yet).
+		 */
+		std::unique_ptr<AsyncResult<ExpectedRows>> DoExecuteAsync() override;
+
+		/**
+		 * Executes via PQexecPrepared and reads the PGresult cells in place.
+		 * @return Reader (null if there is no result set) or an error.
+		 */
+		ExpectedRowReader DoExecuteReader() override;
+
+		/**
+		 * Enters pipeline mode.
+		 * @return Error if the connection cannot enter pipeline mode (e.g. busy).
+		 */
+		Expected<void, QueryException> DoBeginBatch() override;
+
+		/**
+		 * Queues the bound row with PQsendQueryPrepared; every few hundred rows
+		 * asks the server to flush and reads the queued results, so neither side
+		 * blocks on a full socket buffer.
+		 * @param result Batch result.
+		 * @return BatchError for a failing row.
+		 */
+		Expected<void, QueryException> DoBatchRow(BatchResult& result) override;
+
+		/**
+		 * Sends the pipeline sync (ending the implicit transaction), reads the
+		 * remaining results and leaves pipeline mode.
+		 * @param result Result so far.
+		 * @return Final result.
+		 */
+		ExpectedBatch DoEndBatch(ExpectedBatch&& result) override;
+
+		/**
+		 * Reads the result of the next queued batch row.
+		 * @param result Batch result to append the affected count to.
+		 * @return BatchError if the row failed or was aborted.
+		 */
+		Expected<void, QueryException> ReadBatchResult(BatchResult& result);
+
 		/**
 		 * Clears all bind storage.
 		 */
@@ -1,5 +1,6 @@
 #include <StormByte/database/sqlite/prepared_stmt.hxx>
 #include <StormByte/database/sqlite/result_fetch.hxx>
+#include <StormByte/database/sqlite/executor.hxx>
 
 using namespace StormByte::Database::SQLite;
 
@@ -46,17 +47,23 @@ void PreparedSTMT::Binder(const int& index, Value&& value) noexcept {
 			sqlite3_bind_int(m_stmt, col, value.Get<bool>() ? 1 : 0);
 			break;
 		case Value::Type::Text: {
-			const std::string& s = value.Get<std::string>();
-			sqlite3_bind_text(m_stmt, col, s.c_str(), -1, SQLITE_TRANSIENT);
+			// Views point at caller storage: bind in place. Owned payloads die
+			// with @p value, so SQLite takes its own copy
+			const auto text = value.Get<std::string_view>();
+			if (value.IsView())
+				BindText(index, text);
+			else
+				sqlite3_bind_text64(m_stmt, col, text.data(), text.size(), SQLITE_TRANSIENT, SQLITE_UTF8);
 			break;
 		}
 		case Value::Type::Blob: {
-			auto bv = value.Get<std::vector<std::byte>>();
-			if (bv.empty()) {
+			const auto blob = value.Get<std::span<const std::byte>>();
+			if (value.IsView())
+				BindBlob(index, blob);
+			else if (blob.empty())
 				sqlite3_bind_blob(m_stmt, col, nullptr, 0, SQLITE_TRANSIENT);
-			} else {
-				sqlite3_bind_blob(m_stmt, col, reinterpret_cast<const void*>(bv.data()), static_cast<int>(bv.size()), SQLITE_TRANSIENT);
-			}
+			else
+				sqlite3_bind_blob64(m_stmt, col, blob.data(), blob.size(), SQLITE_TRANSIENT);
 			break;
 		}
 		default:
@@ -65,6 +72,34 @@ void PreparedSTMT::Binder(const int& index, Value&& value) noexcept {
 	}
 }
 
+void PreparedSTMT::BindInt64(int index, std::int64_t value) noexcept {
+	if (m_stmt) sqlite3_bind_int64(m_stmt, index + 1, value);
+}
+
+void PreparedSTMT::BindDouble(int index, double value) noexcept {
+	if (m_stmt) sqlite3_bind_double(m_stmt, index + 1, value);
+}
+
+void PreparedSTMT::BindBool(int index, bool value) noexcept {
+	if (m_stmt) sqlite3_bind_int(m_stmt, index + 1, value ? 1 : 0);
+}
+
+void PreparedSTMT::BindText(int index, std::string_view value) noexcept {
+	if (m_stmt) sqlite3_bind_text64(m_stmt, index + 1, value.data(), value.size(), SQLITE_STATIC, SQLITE_UTF8);
+}
+
+void PreparedSTMT::BindBlob(int index, std::span<const std::byte> value) noexcept {
+	if (!m_stmt) return;
+	if (value.empty())
+		sqlite3_bind_zeroblob(m_stmt, index + 1, 0);
+	else
+		sqlite3_bind_blob64(m_stmt, index + 1, value.data(), value.size(), SQLITE_STATIC);
+}
+
+void PreparedSTMT::BindNull(int index) noexcept {
+	if (m_stmt) sqlite3_bind_null(m_stmt, index + 1);
+}
+
 void PreparedSTMT::Reset() noexcept {
 	if (m_stmt) {
 		sqlite3_clear_bindings(m_stmt);
@@ -72,6 +107,79 @@ void PreparedSTMT::Reset() noexcept {
 	}
 }
 
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBeginBatch() {
+	if (!m_stmt)
+		return Unexpected<ExecuteError>("Invalid SQLite statement provided.");
+
+	sqlite3* db = sqlite3_db_handle(m_stmt);
+	m_batch_transaction = sqlite3_get_autocommit(db) != 0;
+	if (m_batch_transaction && sqlite3_exec(db, "BEGIN;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+		m_batch_transaction = false;
+		return Unexpected<ExecuteError>(sqlite3_errmsg(db));
+	}
+	return {};
+}
+
+StormByte::Expected<void, StormByte::Database::QueryException> PreparedSTMT::DoBatchRow(BatchResult& result) {
+	sqlite3* db = sqlite3_db_handle(m_stmt);
+	int rc;
+	while ((rc = sqlite3_step(m_stmt)) == SQLITE_ROW) {}
+	if (rc != SQLITE_DONE) {
+		const std::string error = sqlite3_errmsg(db);
+		sqlite3_reset(m_stmt);
+		return Unexpected<BatchError>(result.rows, error);
+	}
+
+	const auto changes = static_cast<std::uint64_t>(sqlite3_changes64(db));
+	result.affected.push_back(changes);
+	result.total_affected += changes;
+	// Every parameter is rebound for the next row, so the bindings need no clearing
+	sqlite3_reset(m_stmt);
+	return {};
+}
+
+StormByte::Database::ExpectedBatch PreparedSTMT::DoEndBatch(ExpectedBatch&& result) {
+	if (!m_batch_transaction)
+		return std::move(result);
+
+	m_batch_transaction = false;
+	sqlite3* db = sqlite3_db_handle(m_stmt);
+	if (!result) {
+		sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+		return std::move(result);
+	}
+	if (sqlite3_exec(db, "COMMIT;", nullptr, nullptr, nullptr) != SQLITE_OK) {
+		const std::string error = sqlite3_errmsg(db);
+		sqlite3_exec(db, "ROLLBACK;", nullptr, nullptr, nullptr);
+		return Unexpected<ExecuteError>(error);
+	}
+	return std::move(result);
+}
+
 StormByte::Database::ExpectedRows PreparedSTMT::DoExecute() {
-	return StepResults(m_stmt);
+	return StepResults(m_stmt, m_result_storage);
+}
+
+StormByte::Database::ExpectedColumnarRows PreparedSTMT::DoExecuteColumnar() {
+	return StepColumnar(m_stmt);
+}
+
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> PreparedSTMT::DoExecuteAsync() {
+	return std::make_unique<OffloadedQuery>(*m_executor, [this] {
+		ExpectedRows result = DoExecute();
+		Reset();
+		return result;
+	});
+}
+
+StormByte::Database::ExpectedCursor PreparedSTMT::DoExecuteStream() {
+	if (!m_stmt)
+		return Unexpected<ExecuteError>("Invalid SQLite statement provided.");
+	return Cursor(std::make_unique<StatementSource>(m_stmt, false));
+}
+
+StormByte::Database::ExpectedRowReader PreparedSTMT::DoExecuteReader() {
+	if (!m_stmt)
+		return Unexpected<ExecuteError>("Invalid SQLite statement provided.");
+	return std::make_unique<StatementReader>(m_stmt);
 }
@@ -29,6 +29,8 @@ class sqlite3_stmt;
  * @brief SQLite backend for StormByte::Database.
  */
 namespace StormByte::Database::SQLite {
+	class Executor;
+
 	/**
 	 * @class PreparedSTMT
 	 * @brief SQLite prepared statement.
@@ -63,6 +65,8 @@ namespace StormByte::Database::SQLite {
 
 	private:
 		sqlite3_stmt* m_stmt;	///< SQLite statement handle
+		bool m_batch_transaction = false;	///< ExecuteBatch() opened its own transaction
+		Executor* m_executor = nullptr;		///< Owning connection's executor (ExecuteAsync())
 
 		/**
 		 * @param name Statement name.
@@ -80,17 +84,77 @@ namespace StormByte::Database::SQLite {
 
 		/**
 		 * Binds a value at @p index (0-based; SQLite uses 1-based internally).
+		 * Text / blob views are bound SQLITE_STATIC like the native binders;
+		 * owned payloads are copied once, by SQLite (SQLITE_TRANSIENT).
 		 * @param index Parameter index.
 		 * @param value Value to bind.
 		 */
 		void Binder(const int& index, Value&& value) noexcept override;
 
+		/**
+		 * @name Native binders
+		 * sqlite3_bind_* straight from the argument; text and blobs are bound
+		 * SQLITE_STATIC (the caller's buffer outlives the step).
+		 * @{
+		 */
+		void BindInt64(int index, std::int64_t value) noexcept override;
+		void BindDouble(int index, double value) noexcept override;
+		void BindBool(int index, bool value) noexcept override;
+		void BindText(int index, std::string_view value) noexcept override;
+		void BindBlob(int index, std::span<const std::byte> value) noexcept override;
+		void BindNull(int index) noexcept override;
+		/** @} */
+
 		/**
 		 * Steps the statement and builds Rows.
 		 * @return Result rows or an error.
 		 */
 		ExpectedRows DoExecute() override;
 
+		/**
+		 * Steps the statement, decoding into columns.
+		 * @return Columnar result or an error.
+		 */
+		ExpectedColumnarRows DoExecuteColumnar() override;
+
+		/**
+		 * Returns a cursor stepping the statement on demand.
+		 * @return Cursor over the result rows or an error.
+		 */
+		ExpectedCursor DoExecuteStream() override;
+
+		/**
+		 * Runs the bound statement on the connection's executor thread.
+		 * @return Offloaded operation.
+		 */
+		std::unique_ptr<AsyncResult<ExpectedRows>> DoExecuteAsync() override;
+
+		/**
+		 * Returns a reader over sqlite3_column_* of the stepped statement.
+		 * @return Reader (null if there is no result set) or an error.
+		 */
+		ExpectedRowReader DoExecuteReader() override;
+
+		/**
+		 * Opens a transaction for the batch unless one is already active.
+		 * @return Error if BEGIN failed.
+		 */
+		Expected<void, QueryException> DoBeginBatch() override;
+
+		/**
+		 * Steps the bound row and records sqlite3_changes64().
+		 * @param result Batch result.
+		 * @return BatchError if the step failed.
+		 */
+		Expected<void, QueryException> DoBatchRow(BatchResult& result) override;
+
+		/**
+		 * Commits the batch transaction, or rolls it back on failure.
+		 * @param result Result so far.
+		 * @return Final result.
+		 */
+		ExpectedBatch DoEndBatch(ExpectedBatch&& result) override;
+
 		/**
 		 * Clears bindings and resets the statement.
 		 */
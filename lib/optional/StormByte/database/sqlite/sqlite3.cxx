@@ -1,10 +1,14 @@
 #include <StormByte/database/sqlite/sqlite3.hxx>
+#include <StormByte/database/sqlite/blob_stream.hxx>
 #include <StormByte/database/sqlite/result_fetch.hxx>
 #include <StormByte/database/sqlite/prepared_stmt.hxx>
+#include <StormByte/database/sqlite/executor.hxx>
 
 #include <sqlite3.h>
 #include <atomic>
+#include <limits>
 #include <mutex>
+#include <unordered_map>
 
 using namespace StormByte::Database::SQLite;
 
@@ -17,14 +21,16 @@ SQLite3::SQLite3(std::shared_ptr<Logger::Log> logger) noexcept
 	: SQLite3(":memory:", logger) {}
 
 SQLite3::SQLite3(const std::filesystem::path& dbfile, std::shared_ptr<Logger::Log> logger)
-	: Database(logger), m_database_file(dbfile), m_database(nullptr) {}
+	: Database(logger), m_database_file(dbfile), m_database(nullptr), m_executor(std::make_shared<Executor>()) {}
 
 SQLite3::SQLite3(std::filesystem::path&& dbfile, std::shared_ptr<Logger::Log>&& logger)
-	: Database(std::move(logger)), m_database_file(std::move(dbfile)), m_database(nullptr) {}
+	: Database(std::move(logger)), m_database_file(std::move(dbfile)), m_database(nullptr), m_executor(std::make_shared<Executor>()) {}
 
 SQLite3::~SQLite3() noexcept {
 	if (m_logger)
 		*m_logger << Logger::Level::LowLevel << "SQLite3 dtor" << std::endl;
+	// Let in-flight async work finish before the handle goes away
+	m_executor.reset();
 	Disconnect();
 }
 
@@ -89,7 +95,7 @@ void SQLite3::DoPostDisconnect() noexcept {
 	}
 }
 
-StormByte::Database::ExpectedRows SQLite3::Query(const std::string& query) noexcept {
+StormByte::Database::ExpectedRows SQLite3::DoQuery(const std::string& query) noexcept {
 	if (m_logger)
 		*m_logger << Logger::Level::Debug << "Executing query: " << query << std::endl;
 
@@ -105,11 +111,132 @@ StormByte::Database::ExpectedRows SQLite3::Query(const std::string& query) noexc
 		return Unexpected<ExecuteError>(errorStr);
 	}
 
-	ExpectedRows result = StepResults(stmt);
+	ExpectedRows result = StepResults(stmt, m_result_storage);
 	sqlite3_finalize(stmt);
 	return result;
 }
 
+StormByte::Database::ExpectedColumnarRows SQLite3::DoQueryColumnar(const std::string& query) {
+	sqlite3_stmt* stmt = nullptr;
+	int rc = sqlite3_prepare_v2(m_database, query.c_str(), -1, &stmt, nullptr);
+	if (rc != SQLITE_OK) {
+		const std::string errorStr = sqlite3_errmsg(m_database);
+		if (stmt)
+			sqlite3_finalize(stmt);
+		return Unexpected<ExecuteError>(errorStr);
+	}
+
+	ExpectedColumnarRows result = StepColumnar(stmt);
+	sqlite3_finalize(stmt);
+	return result;
+}
+
+std::unique_ptr<StormByte::Database::AsyncResult<StormByte::Database::ExpectedRows>> SQLite3::DoQueryAsync(const std::string& query) {
+	return std::make_unique<OffloadedQuery>(*m_executor, [this, query] {
+		return DoQuery(query);
+	});
+}
+
+StormByte::Database::ExpectedCursor SQLite3::DoQueryStream(const std::string& query) {
+	sqlite3_stmt* stmt = nullptr;
+	int rc = sqlite3_prepare_v2(m_database, query.c_str(), -1, &stmt, nullptr);
+	if (rc != SQLITE_OK) {
+		const std::string errorStr = sqlite3_errmsg(m_database);
+		if (stmt)
+			sqlite3_finalize(stmt);
+		return Unexpected<ExecuteError>(errorStr);
+	}
+
+	return Cursor(std::make_unique<StatementSource>(stmt, true));
+}
+
+StormByte::Database::ExpectedBlobStream SQLite3::DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) {
+	if (mode == BlobMode::Write && size > static_cast<std::uint64_t>(std::numeric_limits<int>::max()))
+		return Unexpected<ExecuteError>("SQLite blobs are limited to " + std::to_string(std::numeric_limits<int>::max()) + " bytes");
+
+	// sqlite3_blob_open() addresses rows by rowid only
+	sqlite3_int64 rowid = location.key;
+	if (!location.key_column.empty() && location.key_column != "rowid") {
+		const std::string query = "SELECT rowid FROM " + location.table + " WHERE " + location.key_column + " = ?";
+		sqlite3_stmt* stmt = nullptr;
+		if (sqlite3_prepare_v2(m_database, query.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+			return Unexpected<ExecuteError>(sqlite3_errmsg(m_database));
+		sqlite3_bind_int64(stmt, 1, location.key);
+		const int rc = sqlite3_step(stmt);
+		if (rc == SQLITE_ROW)
+			rowid = sqlite3_column_int64(stmt, 0);
+		sqlite3_finalize(stmt);
+		if (rc != SQLITE_ROW)
+			return Unexpected<ExecuteError>(rc == SQLITE_DONE ? "No row in " + location.table + " where " + location.key_column + " = " + std::to_string(location.key) : std::string(sqlite3_errmsg(m_database)));
+	}
+
+	std::string savepoint;
+	if (mode == BlobMode::Write) {
+		// Unique per stream: concurrent write streams must not share a savepoint
+		savepoint = IncrementalBlob::SavepointPrefix + std::to_string(++m_blob_savepoints);
+		if (sqlite3_exec(m_database, ("SAVEPOINT " + savepoint).c_str(), nullptr, nullptr, nullptr) != SQLITE_OK)
+			return Unexpected<ExecuteError>(sqlite3_errmsg(m_database));
+		const std::string query = "UPDATE " + location.table + " SET " + location.column + " = zeroblob(?) WHERE rowid = ?";
+		sqlite3_stmt* stmt = nullptr;
+		int rc = sqlite3_prepare_v2(m_database, query.c_str(), -1, &stmt, nullptr);
+		if (rc == SQLITE_OK) {
+			sqlite3_bind_int64(stmt, 1, static_cast<sqlite3_int64>(size));
+			sqlite3_bind_int64(stmt, 2, rowid);
+			rc = sqlite3_step(stmt);
+		}
+		sqlite3_finalize(stmt);
+		std::string error;
+		if (rc != SQLITE_DONE)
+			error = sqlite3_errmsg(m_database);
+		else if (sqlite3_changes(m_database) == 0)
+			error = "No row in " + location.table + " with rowid " + std::to_string(rowid);
+		if (!error.empty()) {
+			sqlite3_exec(m_database, ("ROLLBACK TO " + savepoint + "; RELEASE " + savepoint).c_str(), nullptr, nullptr, nullptr);
+			return Unexpected<ExecuteError>(error);
+		}
+	}
+
+	sqlite3_blob* blob = nullptr;
+	if (sqlite3_blob_open(m_database, "main", location.table.c_str(), location.column.c_str(), rowid, mode == BlobMode::Write ? 1 : 0, &blob) != SQLITE_OK) {
+		const std::string error = sqlite3_errmsg(m_database);
+		sqlite3_blob_close(blob);
+		if (mode == BlobMode::Write)
+			sqlite3_exec(m_database, ("ROLLBACK TO " + savepoint + "; RELEASE " + savepoint).c_str(), nullptr, nullptr, nullptr);
+		return Unexpected<ExecuteError>(error);
+	}
+	const std::uint64_t bytes = mode == BlobMode::Write ? size : static_cast<std::uint64_t>(sqlite3_blob_bytes(blob));
+	return std::make_unique<IncrementalBlob>(m_database, blob, bytes, mode, std::move(savepoint));
+}
+
+StormByte::Database::SlowQueryLog::Explainer SQLite3::DoExplainer() noexcept {
+	return [database = m_database](const std::string& sql, std::span<const Value> parameters) -> SlowQueryLog::ExpectedPlan {
+		PreparedSTMT explain("explain", "EXPLAIN QUERY PLAN " + sql, nullptr);
+		if (sqlite3_prepare_v2(database, explain.Query().c_str(), static_cast<int>(explain.Query().length()), &explain.m_stmt, nullptr) != SQLITE_OK)
+			return Unexpected<ExecuteError>(sqlite3_errmsg(database));
+		for (std::size_t i = 0; i < parameters.size(); ++i)
+			explain.Binder(static_cast<int>(i), Value(parameters[i]));
+
+		// Rows are (id, parent, notused, detail); parents come before their children
+		std::unordered_map<int, std::size_t> depth;
+		std::string plan;
+		int rc;
+		while ((rc = sqlite3_step(explain.m_stmt)) == SQLITE_ROW) {
+			const int id = sqlite3_column_int(explain.m_stmt, 0);
+			const auto parent = depth.find(sqlite3_column_int(explain.m_stmt, 1));
+			const std::size_t level = parent == depth.end() ? 0 : parent->second + 1;
+			depth[id] = level;
+			const unsigned char* detail = sqlite3_column_text(explain.m_stmt, 3);
+			if (!plan.empty())
+				plan += '\n';
+			plan.append(level * 2, ' ');
+			plan += detail ? reinterpret_cast<const char*>(detail) : "";
+		}
+		if (rc != SQLITE_DONE)
+			return Unexpected<ExecuteError>(sqlite3_errmsg(database));
+		return plan;
+	};
+}
+
 bool SQLite3::SilentQuery(const std::string& query) noexcept {
 	return DoSilentQuery(query);
 }
@@ -152,6 +279,7 @@ SQLite3::CreatePreparedSTMT(std::string&& name, std::string&& query) noexcept {
 			*m_logger << Logger::Level::Error << "Failed to prepare statement" << std::endl;
 		return nullptr;
 	}
+	stmt->m_executor = m_executor.get();
 	return stmt;
 }
 
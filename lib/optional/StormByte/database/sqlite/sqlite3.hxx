@@ -22,6 +22,7 @@
 #include <StormByte/database/database.hxx>
 #include <StormByte/database/sqlite/prepared_stmt.hxx>
 
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 
@@ -70,13 +71,6 @@ namespace StormByte::Database::SQLite {
 			 */
 			~SQLite3() noexcept override;
 
-			/**
-			 * Executes a query and returns rows.
-			 * @param query SQL text.
-			 * @return Result rows or an error.
-			 */
-			ExpectedRows Query(const std::string& query) noexcept override;
-
 			/**
 			 * Executes a query that does not return rows.
 			 * @param query SQL text.
@@ -120,6 +114,8 @@ namespace StormByte::Database::SQLite {
 		private:
 			std::filesystem::path m_database_file;	///< Database file path
 			sqlite3* m_database;					///< SQLite handle (incomplete type)
+			std::shared_ptr<Executor> m_executor;	///< Thread running QueryAsync() / ExecuteAsync()
+			std::uint64_t m_blob_savepoints = 0;	///< Names each write BlobStream's savepoint
 
 			/**
 			 * Opens the database and initializes SQLite if needed.
@@ -150,6 +146,52 @@ namespace StormByte::Database::SQLite {
 			 */
 			std::unique_ptr<StormByte::Database::PreparedSTMT> CreatePreparedSTMT(std::string&& name, std::string&& query) noexcept override;
 
+			/**
+			 * Prepares and steps @p query, decoding into rows.
+			 * @param query SQL text.
+			 * @return Result rows or an error.
+			 */
+			ExpectedRows DoQuery(const std::string& query) noexcept override;
+
+			/**
+			 * Prepares and steps @p query, decoding into columns.
+			 * @param query SQL text.
+			 * @return Columnar result or an error.
+			 */
+			ExpectedColumnarRows DoQueryColumnar(const std::string& query) override;
+
+			/**
+			 * Prepares @p query and returns a cursor that steps it on demand.
+			 * @param query SQL text.
+			 * @return Cursor over the result rows or an error.
+			 */
+			ExpectedCursor DoQueryStream(const std::string& query) override;
+
+			/**
+			 * Runs DoQuery() on the connection's executor thread.
+			 * @param query SQL text.
+			 * @return Offloaded operation.
+			 */
+			std::unique_ptr<AsyncResult<ExpectedRows>> DoQueryAsync(const std::string& query) override;
+
+			/**
+			 * Opens the cell with sqlite3_blob_open(), resolving the rowid through
+			 * the key column first. Writes store a zeroblob of @p size inside a
+			 * savepoint and fill it in place.
+			 * @param location Table, column and row of the value.
+			 * @param mode Stream direction.
+			 * @param size Size of the new value (BlobMode::Write only).
+			 * @return IncrementalBlob or an error.
+			 */
+			ExpectedBlobStream DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) override;
+
+			/**
+			 * Explains slow statements with EXPLAIN QUERY PLAN, one indented line
+			 * per plan node.
+			 * @return Explainer bound to the database handle.
+			 */
+			SlowQueryLog::Explainer DoExplainer() noexcept override;
+
 			/**
 			 * Maps IsolationLevel to BEGIN DEFERRED/IMMEDIATE/EXCLUSIVE.
 			 * @param level Isolation level.
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/async.hxx>
+#include <StormByte/database/mariadb/result_fetch.hxx>
+#include <mysql.h>
+
+#include <optional>
+#include <string>
+
+namespace StormByte::Database::MariaDB {
+	/**
+	 * Maps the wait flags of a Connector/C *_start / *_cont call.
+	 * @param wait MYSQL_WAIT_* flags (non-zero).
+	 * @return What to wait for.
+	 */
+	inline AsyncStatus WaitStatus(int wait) noexcept {
+		return (wait & MYSQL_WAIT_WRITE) ? AsyncStatus::WantWrite : AsyncStatus::WantRead;
+	}
+
+	/**
+	 * Flags handed back to a *_cont call once the socket is ready. The timeout
+	 * flag is dropped: reporting it would make the call fail as timed out.
+	 * @param wait Flags returned by the previous call.
+	 * @return Flags for *_cont.
+	 */
+	inline int ReadyFlags(int wait) noexcept {
+		return wait & ~MYSQL_WAIT_TIMEOUT;
+	}
+
+	/**
+	 * @class AsyncQuery
+	 * @brief Query run on Connector/C's non-blocking API (mysql_real_query_start /
+	 * mysql_store_result_start and their _cont calls).
+	 *
+	 * Needs a connection opened with MYSQL_OPT_NONBLOCK.
+	 */
+	class AsyncQuery final: public AsyncResult<ExpectedRows> {
+		public:
+			/**
+			 * @param conn Connection (idle).
+			 * @param query SQL text.
+			 * @param storage Result storage for the returned Rows.
+			 */
+			AsyncQuery(MYSQL* conn, std::string query, ResultStorage storage)
+				: m_conn(conn), m_query(std::move(query)), m_storage(storage) {}
+
+			AsyncStatus Start() override {
+				if (!m_conn) {
+					m_result = Unexpected<ExecuteError>("Database not connected");
+					return AsyncStatus::Done;
+				}
+				m_wait = mysql_real_query_start(&m_error, m_conn, m_query.c_str(), static_cast<unsigned long>(m_query.size()));
+				return Step();
+			}
+
+			AsyncStatus Resume() override {
+				if (m_storing)
+					m_wait = mysql_store_result_cont(&m_res, m_conn, ReadyFlags(m_wait));
+				else
+					m_wait = mysql_real_query_cont(&m_error, m_conn, ReadyFlags(m_wait));
+				return Step();
+			}
+
+			std::intptr_t Handle() const noexcept override {
+				return m_conn ? static_cast<std::intptr_t>(mysql_get_socket(m_conn)) : -1;
+			}
+
+			ExpectedRows Result() override {
+				return std::move(*m_result);
+			}
+
+		private:
+			MYSQL* m_conn;							///< Connection
+			std::string m_query;					///< SQL text (must outlive the query)
+			ResultStorage m_storage;				///< Rows payload storage
+			int m_wait = 0;							///< Pending MYSQL_WAIT_* flags
+			int m_error = 0;						///< mysql_real_query result
+			MYSQL_RES* m_res = nullptr;				///< Stored result
+			bool m_storing = false;					///< Query sent, storing its result
+			std::optional<ExpectedRows> m_result;	///< Result once done
+
+			AsyncStatus Step() {
+				if (m_wait)
+					return WaitStatus(m_wait);
+				if (!m_storing) {
+					if (m_error != 0)
+						return Fail();
+					m_storing = true;
+					m_wait = mysql_store_result_start(&m_res, m_conn);
+					if (m_wait)
+						return WaitStatus(m_wait);
+				}
+
+				if (!m_res) {
+					if (mysql_field_count(m_conn) != 0)
+						return Fail();
+					m_result = Rows();
+					return AsyncStatus::Done;
+				}
+				m_result = StepResults(m_res, m_storage);
+				mysql_free_result(m_res);
+				m_res = nullptr;
+				return AsyncStatus::Done;
+			}
+
+			AsyncStatus Fail() {
+				m_result = Unexpected<ExecuteError>(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error");
+				return AsyncStatus::Done;
+			}
+	};
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/blob_stream.hxx>
+
+#include <mysql.h>
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace StormByte::Database::MariaDB {
+	/**
+	 * Prepares @p query on a fresh statement handle.
+	 * @param conn Connection.
+	 * @param query SQL text.
+	 * @param error Receives the error message on failure.
+	 * @return Statement, or nullptr on failure.
+	 */
+	inline MYSQL_STMT* PrepareBlobSTMT(MYSQL* conn, const std::string& query, std::string& error) {
+		MYSQL_STMT* stmt = mysql_stmt_init(conn);
+		if (!stmt) {
+			error = mysql_error(conn);
+			return nullptr;
+		}
+		if (mysql_stmt_prepare(stmt, query.c_str(), static_cast<unsigned long>(query.size())) != 0) {
+			error = mysql_stmt_error(stmt);
+			mysql_stmt_close(stmt);
+			return nullptr;
+		}
+		return stmt;
+	}
+
+	/**
+	 * @class SubstringBlob
+	 * @brief Read BlobStream running SUBSTRING() once per chunk.
+	 *
+	 * The chunk is fetched straight into the caller's buffer (it is the
+	 * statement's output bind), so nothing but the current chunk is held.
+	 */
+	class SubstringBlob final: public BlobStream {
+		public:
+			/**
+			 * @param stmt Prepared SELECT SUBSTRING(column, ?, ?) ... WHERE key = ? (ownership taken).
+			 * @param key Row key.
+			 * @param size Size of the value.
+			 */
+			SubstringBlob(MYSQL_STMT* stmt, std::int64_t key, std::uint64_t size) noexcept
+				:BlobStream(size, BlobMode::Read), m_stmt(stmt), m_key(key) {}
+
+			~SubstringBlob() noexcept override {
+				mysql_stmt_close(m_stmt);
+			}
+
+		private:
+			MYSQL_STMT* m_stmt;			///< Chunk statement
+			std::int64_t m_key;			///< Row key
+
+			Expected<void, QueryException> DoRead(std::uint64_t offset, std::span<std::byte> buffer) override {
+				long long params[3] = { static_cast<long long>(offset + 1), static_cast<long long>(buffer.size()), m_key };
+				MYSQL_BIND in[3];
+				memset(in, 0, sizeof(in));
+				for (int i = 0; i < 3; ++i) {
+					in[i].buffer_type = MYSQL_TYPE_LONGLONG;
+					in[i].buffer = &params[i];
+				}
+
+				unsigned long length = 0;
+				my_bool is_null = 0;
+				MYSQL_BIND out;
+				memset(&out, 0, sizeof(out));
+				out.buffer_type = MYSQL_TYPE_BLOB;
+				out.buffer = buffer.data();
+				out.buffer_length = static_cast<unsigned long>(buffer.size());
+				out.length = &length;
+				out.is_null = &is_null;
+
+				if (mysql_stmt_bind_param(m_stmt, in) != 0 || mysql_stmt_execute(m_stmt) != 0 || mysql_stmt_bind_result(m_stmt, &out) != 0)
+					return Unexpected<ExecuteError>(mysql_stmt_error(m_stmt));
+				const int rc = mysql_stmt_fetch(m_stmt);
+				const std::string error = rc == 1 ? mysql_stmt_error(m_stmt) : "";
+				mysql_stmt_free_result(m_stmt);
+				if (!error.empty())
+					return Unexpected<ExecuteError>(error);
+				if (rc != 0 || is_null || length != buffer.size())
+					return Unexpected<ExecuteError>("Blob value changed while it was being read");
+				return {};
+			}
+
+			Expected<void, QueryException> DoWrite(std::uint64_t, std::span<const std::byte>) override {
+				return Unexpected<ExecuteError>("Blob stream is not writable");
+			}
+
+			Expected<void, QueryException> DoClose(bool) override {
+				return {};
+			}
+	};
+
+	/**
+	 * @class LongDataBlob
+	 * @brief Write BlobStream sending the new value as long data.
+	 *
+	 * Each chunk goes to the server with mysql_stmt_send_long_data(), which
+	 * accumulates the parameter of a prepared UPDATE; Close() executes it.
+	 * The server bounds the value by max_allowed_packet. Nothing is changed
+	 * if the stream is not completed.
+	 */
+	class LongDataBlob final: public BlobStream {
+		public:
+			/**
+			 * @param stmt Prepared UPDATE ... SET column = ? WHERE key = ? (ownership taken).
+			 * @param key Row key.
+			 * @param size Size of the new value.
+			 */
+			LongDataBlob(MYSQL_STMT* stmt, std::int64_t key, std::uint64_t size) noexcept
+				:BlobStream(size, BlobMode::Write), m_stmt(stmt), m_key(key), m_length(0) {
+				memset(m_binds, 0, sizeof(m_binds));
+				m_binds[0].buffer_type = MYSQL_TYPE_LONG_BLOB;
+				m_binds[0].length = &m_length;
+				m_binds[1].buffer_type = MYSQL_TYPE_LONGLONG;
+				m_binds[1].buffer = &m_key;
+			}
+
+			~LongDataBlob() noexcept override {
+				if (m_stmt)
+					DoClose(false);
+			}
+
+			/**
+			 * Binds the parameters; must succeed before the first chunk is sent.
+			 * @return true on success.
+			 */
+			bool Bind() noexcept {
+				return mysql_stmt_bind_param(m_stmt, m_binds) == 0;
+			}
+
+			/**
+			 * @return Statement error message.
+			 */
+			std::string Error() const {
+				return mysql_stmt_error(m_stmt);
+			}
+
+		private:
+			MYSQL_STMT* m_stmt;			///< UPDATE statement (null once closed)
+			long long m_key;			///< Row key
+			unsigned long m_length;		///< Inline length of the value parameter (unused: long data)
+			MYSQL_BIND m_binds[2];		///< Value and key parameters
+
+			Expected<void, QueryException> DoRead(std::uint64_t, std::span<std::byte>) override {
+				return Unexpected<ExecuteError>("Blob stream is not readable");
+			}
+
+			Expected<void, QueryException> DoWrite(std::uint64_t, std::span<const std::byte> data) override {
+				while (!data.empty()) {
+					const std::size_t piece = std::min<std::size_t>(data.size(), 1UL << 30);
+					if (mysql_stmt_send_long_data(m_stmt, 0, reinterpret_cast<const char*>(data.data()), static_cast<unsigned long>(piece)) != 0)
+						return Unexpected<ExecuteError>(mysql_stmt_error(m_stmt));
+					data = data.subspan(piece);
+				}
+				return {};
+			}
+
+			Expected<void, QueryException> DoClose(bool apply) override {
+				std::string error;
+				if (apply && mysql_stmt_execute(m_stmt) != 0)
+					error = mysql_stmt_error(m_stmt);
+				mysql_stmt_close(m_stmt);
+				m_stmt = nullptr;
+				if (!error.empty())
+					return Unexpected<ExecuteError>(error);
+				return {};
+			}
+	};
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/value.hxx>
+#include <mysql.h>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace StormByte::Database::MariaDB {
+	/**
+	 * @struct ParamBinds
+	 * @brief Reusable input bind buffers of a prepared statement.
+	 *
+	 * Buffers only grow, so once sized for the statement's parameter count
+	 * binding allocates nothing. Text and blob binds point straight at the
+	 * Value payloads, which must stay alive until mysql_stmt_execute returns.
+	 */
+	struct ParamBinds {
+		std::vector<MYSQL_BIND> bind;			///< Input binds
+		std::vector<std::int64_t> ints;			///< Integer buffers (any width or sign)
+		std::vector<double> doubles;			///< Floating point buffers
+		std::vector<char> bools;				///< Boolean buffers
+		std::vector<unsigned long> lengths;		///< Text / blob lengths
+		std::vector<my_bool> is_null;			///< NULL indicators
+
+		ParamBinds() = default;
+
+		/**
+		 * @param count Parameter count of the statement (buffers are presized).
+		 */
+		explicit ParamBinds(std::size_t count) {
+			Reserve(count);
+		}
+
+		/**
+		 * Grows the buffers to hold at least @p count parameters.
+		 * @param count Parameter count.
+		 */
+		void Reserve(std::size_t count) {
+			if (bind.size() >= count)
+				return;
+			bind.resize(count);
+			ints.resize(count);
+			doubles.resize(count);
+			bools.resize(count);
+			lengths.resize(count);
+			is_null.resize(count);
+		}
+
+		/**
+		 * Fills the buffers from @p params and binds them to @p stmt.
+		 * @param stmt Prepared statement.
+		 * @param params Parameter values.
+		 * @return true on success.
+		 */
+		bool Bind(MYSQL_STMT* stmt, const std::vector<Value>& params) {
+			Reserve(params.size());
+			for (std::size_t i = 0; i < params.size(); ++i) {
+				MYSQL_BIND& b = bind[i];
+				memset(&b, 0, sizeof(MYSQL_BIND));
+				const Value& p = params[i];
+				is_null[i] = 0;
+				b.is_null = &is_null[i];
+
+				switch (p.Type()) {
+					case Value::Type::Integer:
+						ints[i] = p.Get<int>();
+						b.buffer_type = MYSQL_TYPE_LONGLONG;
+						b.buffer = &ints[i];
+						break;
+					case Value::Type::UnsignedInteger:
+						ints[i] = static_cast<std::int64_t>(p.Get<unsigned int>());
+						b.buffer_type = MYSQL_TYPE_LONGLONG;
+						b.buffer = &ints[i];
+						b.is_unsigned = 1;
+						break;
+					case Value::Type::LongInteger:
+						ints[i] = p.Get<long int>();
+						b.buffer_type = MYSQL_TYPE_LONGLONG;
+						b.buffer = &ints[i];
+						break;
+					case Value::Type::UnsignedLongInteger:
+						ints[i] = static_cast<std::int64_t>(p.Get<unsigned long int>());
+						b.buffer_type = MYSQL_TYPE_LONGLONG;
+						b.buffer = &ints[i];
+						b.is_unsigned = 1;
+						break;
+					case Value::Type::Double:
+						doubles[i] = p.Get<double>();
+						b.buffer_type = MYSQL_TYPE_DOUBLE;
+						b.buffer = &doubles[i];
+						break;
+					case Value::Type::Boolean:
+						bools[i] = p.Get<bool>() ? 1 : 0;
+						b.buffer_type = MYSQL_TYPE_TINY;
+						b.buffer = &bools[i];
+						break;
+					case Value::Type::Text: {
+						const auto text = p.Get<std::string_view>();
+						b.buffer_type = MYSQL_TYPE_STRING;
+						b.buffer = const_cast<char*>(text.data());
+						b.buffer_length = static_cast<unsigned long>(text.size());
+						lengths[i] = b.buffer_length;
+						b.length = &lengths[i];
+						break;
+					}
+					case Value::Type::Blob: {
+						const auto blob = p.Get<std::span<const std::byte>>();
+						b.buffer_type = MYSQL_TYPE_BLOB;
+						b.buffer = reinterpret_cast<char*>(const_cast<std::byte*>(blob.data()));
+						b.buffer_length = static_cast<unsigned long>(blob.size());
+						lengths[i] = b.buffer_length;
+						b.length = &lengths[i];
+						break;
+					}
+					case Value::Type::Null:
+					default:
+						b.buffer_type = MYSQL_TYPE_NULL;
+						is_null[i] = 1;
+						break;
+				}
+			}
+
+			// Local call: copies the binds into the statement, no server round trip
+			return params.empty() || mysql_stmt_bind_param(stmt, bind.data()) == 0;
+		}
+	};
+}
@@ -19,75 +19,245 @@
 
 #pragma once
 
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/cursor.hxx>
+#include <StormByte/database/row_reader.hxx>
 #include <StormByte/database/rows.hxx>
+#include <StormByte/database/statement_stats.hxx>
 #include <mysql.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace StormByte::Database::MariaDB {
+	/**
+	 * Maps a field type to its SQL type name.
+	 * @param type Field type.
+	 * @return Type name.
+	 */
+	inline std::string TypeName(enum_field_types type) {
+		switch (type) {
+			case MYSQL_TYPE_TINY:			return "TINYINT";
+			case MYSQL_TYPE_SHORT:			return "SMALLINT";
+			case MYSQL_TYPE_INT24:			return "MEDIUMINT";
+			case MYSQL_TYPE_LONG:			return "INT";
+			case MYSQL_TYPE_LONGLONG:		return "BIGINT";
+			case MYSQL_TYPE_FLOAT:			return "FLOAT";
+			case MYSQL_TYPE_DOUBLE:			return "DOUBLE";
+			case MYSQL_TYPE_DECIMAL:
+			case MYSQL_TYPE_NEWDECIMAL:		return "DECIMAL";
+			case MYSQL_TYPE_TINY_BLOB:
+			case MYSQL_TYPE_MEDIUM_BLOB:
+			case MYSQL_TYPE_LONG_BLOB:
+			case MYSQL_TYPE_BLOB:			return "BLOB";
+			case MYSQL_TYPE_VARCHAR:
+			case MYSQL_TYPE_VAR_STRING:		return "VARCHAR";
+			case MYSQL_TYPE_STRING:			return "CHAR";
+			default:						return "";
+		}
+	}
+
+	/**
+	 * Builds the schema (names and declared types) from result metadata.
+	 * @param res Result set or statement result metadata.
+	 * @return Schema shared by every row of the result.
+	 */
+	inline SharedResultSchema BuildSchema(MYSQL_RES* res) {
+		auto schema = std::make_shared<ResultSchema>();
+		const unsigned int nfields = mysql_num_fields(res);
+		schema->Reserve(nfields);
+		for (unsigned int c = 0; c < nfields; ++c) {
+			MYSQL_FIELD* field = mysql_fetch_field_direct(res, c);
+			schema->AddColumn(field && field->name ? field->name : "", field ? TypeName(field->type) : "");
+		}
+		return schema;
+	}
+
+	/**
+	 * Builds a Row from a text-protocol result row.
+	 * @param res Result set the row belongs to (for field metadata).
+	 * @param row Row returned by mysql_fetch_row.
+	 * @param lengths Column lengths returned by mysql_fetch_lengths.
+	 * @param schema Schema of the result (from BuildSchema).
+	 * @param arena Arena receiving text / blob payloads, or nullptr for owning values.
+	 * @param decoded Incremented by the Value::PayloadSize() of the row's cells (may be null).
+	 * @return Row with one Value per column.
+	 */
+	inline Row FetchRow(MYSQL_RES* res, MYSQL_ROW row, const unsigned long* lengths, const SharedResultSchema& schema, Arena* arena = nullptr, std::uint64_t* decoded = nullptr) {
+		const int nfields = mysql_num_fields(res);
+		Row prow(schema);
+		std::uint64_t payload = 0;
+		const auto append = [&prow, &payload](Value&& value) {
+			payload += value.PayloadSize();
+			prow.add(std::move(value));
+		};
+
+		for (int c = 0; c < nfields; ++c) {
+			MYSQL_FIELD* field = mysql_fetch_field_direct(res, c);
+
+			if (!row[c]) {
+				append(Value());
+				continue;
+			}
+
+			const unsigned long len = lengths ? lengths[c] : 0;
+			const enum_field_types ftype = field ? field->type : MYSQL_TYPE_STRING;
+
+			switch (ftype) {
+				case MYSQL_TYPE_TINY: {
+					if (field && (field->flags & UNSIGNED_FLAG) == 0 && field->length == 1) {
+						const bool b = (row[c][0] != '0');
+						append(b);
+					} else {
+						long long v = 0;
+						try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
+						if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
+							append(static_cast<long int>(v));
+						else
+							append(static_cast<int>(v));
+					}
+					break;
+				}
+
+				case MYSQL_TYPE_SHORT:
+				case MYSQL_TYPE_LONG:
+				case MYSQL_TYPE_INT24: {
+					long long v = 0;
+					try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
+					if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
+						append(static_cast<long int>(v));
+					else
+						append(static_cast<int>(v));
+					break;
+				}
+
+				case MYSQL_TYPE_LONGLONG: {
+					long long v = 0;
+					try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
+					append(static_cast<long int>(v));
+					break;
+				}
+
+				case MYSQL_TYPE_FLOAT:
+				case MYSQL_TYPE_DOUBLE:
+				case MYSQL_TYPE_DECIMAL:
+				case MYSQL_TYPE_NEWDECIMAL: {
+					double d = 0.0;
+					try { d = std::stod(std::string(row[c], len)); } catch (...) { d = 0.0; }
+					append(d);
+					break;
+				}
+
+				case MYSQL_TYPE_TINY_BLOB:
+				case MYSQL_TYPE_MEDIUM_BLOB:
+				case MYSQL_TYPE_LONG_BLOB:
+				case MYSQL_TYPE_BLOB: {
+					const bool is_binary = field && field->charsetnr == 63;
+					if (arena) {
+						if (is_binary)
+							append(Value(arena->Store(std::span<const std::byte>(reinterpret_cast<const std::byte*>(row[c]), len))));
+						else
+							append(Value(arena->Store(std::string_view(row[c], len))));
+					} else if (is_binary) {
+						append(Value::CopyBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(row[c]), len)));
+					} else {
+						append(Value::CopyText(std::string_view(row[c], len)));
+					}
+					break;
+				}
+
+				case MYSQL_TYPE_VAR_STRING:
+				case MYSQL_TYPE_STRING:
+				case MYSQL_TYPE_VARCHAR:
+				default: {
+					if (arena) {
+						append(Value(arena->Store(std::string_view(row[c] ? row[c] : "", len))));
+						break;
+					}
+					append(Value::CopyText(std::string_view(row[c] ? row[c] : "", len)));
+					break;
+				}
+			}
+		}
+		if (decoded)
+			*decoded += payload;
+		return prow;
+	}
+
 	/**
 	 * Converts a MYSQL_RES into Rows (all rows stored client-side).
 	 * @param res Result set (must not be null).
+	 * @param storage Where text / blob payloads are kept (Borrowed behaves as Arena).
 	 * @return Result rows or a QueryException.
 	 */
-	inline ExpectedRows StepResults(MYSQL_RES* res) noexcept {
+	inline ExpectedRows StepResults(MYSQL_RES* res, ResultStorage storage = ResultStorage::Owned) noexcept {
 		if (!res)
 			return Unexpected<QueryException>(ExecuteError("Invalid MYSQL_RES provided."));
 
+		StatementMetrics::BeginDecode();
 		Rows rows;
 		const int nrows = static_cast<int>(mysql_num_rows(res));
+		const SharedResultSchema schema = BuildSchema(res);
+		Arena* arena = storage != ResultStorage::Owned ? &rows.UseArena() : nullptr;
+
+		std::uint64_t decoded = 0;
+		for (int r = 0; r < nrows; ++r) {
+			MYSQL_ROW row = mysql_fetch_row(res);
+			rows.add(FetchRow(res, row, mysql_fetch_lengths(res), schema, arena, &decoded));
+		}
+
+		StatementMetrics::AddDecodedBytes(decoded);
+		return rows;
+	}
+
+	/**
+	 * Converts a stored MYSQL_RES into a columnar result.
+	 * @param res Result set (must not be null).
+	 * @return Columnar result or a QueryException.
+	 */
+	inline ExpectedColumnarRows StepColumnar(MYSQL_RES* res) noexcept {
+		if (!res)
+			return Unexpected<QueryException>(ExecuteError("Invalid MYSQL_RES provided."));
+
+		ColumnarRows result(BuildSchema(res));
+		const int nrows = static_cast<int>(mysql_num_rows(res));
 		const int nfields = mysql_num_fields(res);
+		for (int c = 0; c < nfields; ++c)
+			result[c].Reserve(nrows);
 
 		for (int r = 0; r < nrows; ++r) {
 			MYSQL_ROW row = mysql_fetch_row(res);
 			unsigned long* lengths = mysql_fetch_lengths(res);
-			Row prow;
 
 			for (int c = 0; c < nfields; ++c) {
-				MYSQL_FIELD* field = mysql_fetch_field_direct(res, c);
-				const char* colName = field ? field->name : nullptr;
-
+				Column& column = result[c];
 				if (!row[c]) {
-					prow.add(std::string(colName ? colName : ""), Value());
+					column.AppendNull();
 					continue;
 				}
 
+				MYSQL_FIELD* field = mysql_fetch_field_direct(res, c);
 				const unsigned long len = lengths ? lengths[c] : 0;
-				const enum_field_types ftype = field ? field->type : MYSQL_TYPE_STRING;
-
-				switch (ftype) {
-					case MYSQL_TYPE_TINY: {
-						if (field && (field->flags & UNSIGNED_FLAG) == 0 && field->length == 1) {
-							const bool b = (row[c][0] != '0');
-							prow.add(std::string(colName ? colName : ""), b);
-						} else {
-							long long v = 0;
-							try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
-							if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
-								prow.add(std::string(colName ? colName : ""), static_cast<long int>(v));
-							else
-								prow.add(std::string(colName ? colName : ""), static_cast<int>(v));
-						}
-						break;
-					}
 
+				switch (field ? field->type : MYSQL_TYPE_STRING) {
+					case MYSQL_TYPE_TINY:
 					case MYSQL_TYPE_SHORT:
 					case MYSQL_TYPE_LONG:
-					case MYSQL_TYPE_INT24: {
-						long long v = 0;
-						try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
-						if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
-							prow.add(std::string(colName ? colName : ""), static_cast<long int>(v));
-						else
-							prow.add(std::string(colName ? colName : ""), static_cast<int>(v));
-						break;
-					}
-
+					case MYSQL_TYPE_INT24:
 					case MYSQL_TYPE_LONGLONG: {
-						long long v = 0;
-						try { v = std::stoll(std::string(row[c], len)); } catch (...) { v = 0; }
-						prow.add(std::string(colName ? colName : ""), static_cast<long int>(v));
+						if (field->type == MYSQL_TYPE_TINY && (field->flags & UNSIGNED_FLAG) == 0 && field->length == 1) {
+							column.AppendBool(row[c][0] != '0');
+							break;
+						}
+						std::int64_t v = 0;
+						std::from_chars(row[c], row[c] + len, v);
+						column.AppendInt64(v);
 						break;
 					}
 
@@ -97,42 +267,667 @@ namespace StormByte::Database::MariaDB {
 					case MYSQL_TYPE_NEWDECIMAL: {
 						double d = 0.0;
 						try { d = std::stod(std::string(row[c], len)); } catch (...) { d = 0.0; }
-						prow.add(std::string(colName ? colName : ""), d);
+						column.AppendDouble(d);
 						break;
 					}
 
 					case MYSQL_TYPE_TINY_BLOB:
 					case MYSQL_TYPE_MEDIUM_BLOB:
 					case MYSQL_TYPE_LONG_BLOB:
-					case MYSQL_TYPE_BLOB: {
-						const bool is_binary = field && field->charsetnr == 63;
-						if (is_binary) {
-							std::vector<std::byte> blob;
-							if (len > 0) {
-								blob.assign(
-									reinterpret_cast<const std::byte*>(row[c]),
-									reinterpret_cast<const std::byte*>(row[c]) + len
-								);
+					case MYSQL_TYPE_BLOB:
+						if (field->charsetnr == 63)
+							column.AppendBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(row[c]), len));
+						else
+							column.AppendText(std::string_view(row[c], len));
+						break;
+
+					default:
+						column.AppendText(std::string_view(row[c], len));
+						break;
+				}
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	 * @class UseResultSource
+	 * @brief Cursor source over an unbuffered (mysql_use_result) result set.
+	 *
+	 * Rows are read from the socket as the cursor advances; mysql_free_result
+	 * on destruction discards whatever the server has not delivered yet.
+	 */
+	class UseResultSource final: public Cursor::Source {
+		public:
+			/**
+			 * @param conn Connection owning the result.
+			 * @param res Result from mysql_use_result (ownership taken).
+			 */
+			UseResultSource(MYSQL* conn, MYSQL_RES* res)
+				:m_conn(conn), m_res(res), m_schema(BuildSchema(res)) {}
+
+			UseResultSource(const UseResultSource&) = delete;
+			UseResultSource& operator=(const UseResultSource&) = delete;
+
+			~UseResultSource() noexcept override {
+				mysql_free_result(m_res);
+			}
+
+			ExpectedRow Fetch() override {
+				MYSQL_ROW row = mysql_fetch_row(m_res);
+				if (row)
+					return std::optional<Row>(FetchRow(m_res, row, mysql_fetch_lengths(m_res), m_schema));
+				if (mysql_errno(m_conn) != 0)
+					return Unexpected<QueryException>(ExecuteError(mysql_error(m_conn) ? mysql_error(m_conn) : "Unknown MySQL error"));
+				return std::optional<Row>();
+			}
+
+		private:
+			MYSQL* m_conn;			///< Connection owning the result
+			MYSQL_RES* m_res;		///< Unbuffered result set
+			SharedResultSchema m_schema;	///< Column names and types
+	};
+
+	/**
+	 * @class StmtResult
+	 * @brief Output bind buffers for a prepared statement result set.
+	 *
+	 * Owns the result metadata, decoded once into per-column info so rows are
+	 * converted without querying field metadata again. Buffers live in
+	 * heap-backed vectors, so the pointers handed to mysql_stmt_bind_result
+	 * survive a move and the same object can be bound to every execution of
+	 * its statement.
+	 *
+	 * String and blob buffers start at the declared column length capped to
+	 * InitialLength, are fitted to the observed maximum of stored results
+	 * (STMT_ATTR_UPDATE_MAX_LENGTH) and grow on truncation up to
+	 * MaxBindLength. Longer values never enlarge the bind buffer: they are read
+	 * in ChunkLength pieces with mysql_stmt_fetch_column into per-row overflow
+	 * storage released on the next fetch.
+	 */
+	class StmtResult {
+		public:
+			static constexpr unsigned long InitialLength	= 4096;			///< Largest initial string buffer
+			static constexpr unsigned long MaxBindLength	= 256 * 1024;	///< Largest string buffer kept bound
+			static constexpr unsigned long ChunkLength		= 64 * 1024;	///< Piece size for oversized values
+
+			/**
+			 * @param meta Result metadata from mysql_stmt_result_metadata (ownership taken).
+			 */
+			explicit StmtResult(MYSQL_RES* meta)
+				:m_meta(meta), m_nfields(mysql_num_fields(meta)), m_schema(BuildSchema(meta)),
+				m_columns(m_nfields), m_bind(m_nfields), m_len(m_nfields), m_is_null(m_nfields), m_str(m_nfields),
+				m_overflow(m_nfields), m_oversized(m_nfields),
+				m_int(m_nfields), m_uint(m_nfields), m_ll(m_nfields), m_ull(m_nfields),
+				m_dbl(m_nfields), m_bool(m_nfields) {
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					MYSQL_FIELD* f = mysql_fetch_field_direct(m_meta, i);
+					ColumnInfo& column = m_columns[i];
+					if (!f)
+						continue;
+					column.type = f->type;
+					column.is_unsigned = (f->flags & UNSIGNED_FLAG) != 0;
+					column.is_bool = f->type == MYSQL_TYPE_TINY && !column.is_unsigned && f->length == 1;
+					// 63 = binary charset; otherwise treat as text (TEXT/VARCHAR)
+					column.is_binary = f->charsetnr == 63;
+					column.length = f->length;
+				}
+				Layout();
+			}
+
+			StmtResult(const StmtResult&) = delete;
+
+			StmtResult(StmtResult&& other) noexcept
+				:m_meta(other.m_meta), m_nfields(other.m_nfields), m_schema(std::move(other.m_schema)),
+				m_columns(std::move(other.m_columns)),
+				m_bind(std::move(other.m_bind)), m_len(std::move(other.m_len)),
+				m_is_null(std::move(other.m_is_null)), m_str(std::move(other.m_str)),
+				m_overflow(std::move(other.m_overflow)), m_oversized(std::move(other.m_oversized)),
+				m_int(std::move(other.m_int)), m_uint(std::move(other.m_uint)),
+				m_ll(std::move(other.m_ll)), m_ull(std::move(other.m_ull)),
+				m_dbl(std::move(other.m_dbl)), m_bool(std::move(other.m_bool)) {
+				other.m_meta = nullptr;
+			}
+
+			~StmtResult() noexcept {
+				if (m_meta)
+					mysql_free_result(m_meta);
+			}
+
+			StmtResult& operator=(const StmtResult&) = delete;
+			StmtResult& operator=(StmtResult&&) = delete;
+
+			/**
+			 * Binds the output buffers to an executed statement (no server round trip).
+			 * @param stmt Executed statement.
+			 * @return true on success.
+			 */
+			bool Bind(MYSQL_STMT* stmt) {
+				return mysql_stmt_bind_result(stmt, m_bind.data()) == 0;
+			}
+
+			/**
+			 * Fits the string buffers to the longest values of a stored result,
+			 * as reported with STMT_ATTR_UPDATE_MAX_LENGTH, so fetching it does not
+			 * truncate. Buffers much larger than needed are shrunk back.
+			 * @param stmt Executed statement whose result was stored.
+			 * @return true on success.
+			 */
+			bool Fit(MYSQL_STMT* stmt) {
+				bool changed = false;
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					if (m_bind[i].buffer_type != MYSQL_TYPE_STRING)
+						continue;
+					const MYSQL_FIELD* f = mysql_fetch_field_direct(m_meta, i);
+					if (!f || f->max_length == 0)
+						continue;
+					const std::size_t want = std::min(f->max_length, MaxBindLength) + 1;
+					const std::size_t have = m_str[i].size();
+					if (want > have || (have > InitialLength + 1 && have / 4 > want)) {
+						Resize(i, want);
+						changed = true;
+					}
+				}
+				return !changed || Bind(stmt);
+			}
+
+			/**
+			 * Fetches the next row into the buffers. Truncated columns are grown
+			 * (up to MaxBindLength) and re-fetched; longer ones are read in chunks.
+			 * @param stmt Executed statement with bound results.
+			 * @return 0 on success, MYSQL_NO_DATA when exhausted, 1 on error.
+			 */
+			int Fetch(MYSQL_STMT* stmt) {
+				ReleaseOverflow();
+				int rc = mysql_stmt_fetch(stmt);
+				if (rc == 0 || rc == MYSQL_NO_DATA) return rc;
+				if (rc != MYSQL_DATA_TRUNCATED) return 1;
+
+				bool grown = false;
+				for (unsigned int ci = 0; ci < m_nfields; ++ci) {
+					if (m_is_null[ci] || m_bind[ci].buffer_type != MYSQL_TYPE_STRING) continue;
+					if (m_len[ci] <= m_bind[ci].buffer_length) continue;
+					if (m_len[ci] < MaxBindLength) {
+						// Double rather than fit exactly: fewer refetches on slowly growing values
+						Resize(ci, std::min<std::size_t>(std::max<std::size_t>(m_len[ci] + 1, m_str[ci].size() * 2), MaxBindLength));
+						if (mysql_stmt_fetch_column(stmt, &m_bind[ci], ci, 0) != 0)
+							return 1;
+						grown = true;
+					}
+					else if (!FetchChunked(stmt, ci))
+						return 1;
+				}
+				// The library keeps its own copy of the binds: point it at the grown buffers
+				return !grown || Bind(stmt) ? 0 : 1;
+			}
+
+			/**
+			 * Builds a Row from the buffers filled by the last successful Fetch().
+			 * @param arena Arena receiving text / blob payloads, or nullptr for owning values.
+			 * @param decoded Incremented by the Value::PayloadSize() of the row's cells (may be null).
+			 * @return Row with one Value per column.
+			 */
+			Row ToRow(Arena* arena = nullptr, std::uint64_t* decoded = nullptr) const {
+				Row prow(m_schema);
+				std::uint64_t payload = 0;
+				const auto append = [&prow, &payload](Value&& value) {
+					payload += value.PayloadSize();
+					prow.add(std::move(value));
+				};
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					const ColumnInfo& column = m_columns[i];
+
+					if (m_is_null[i]) {
+						append(Value());
+						continue;
+					}
+
+					switch (column.type) {
+						case MYSQL_TYPE_TINY: {
+							if (column.is_bool) {
+								append(static_cast<bool>(m_bool[i] != 0));
+							} else if (column.is_unsigned) {
+								append(static_cast<unsigned int>(m_uint[i]));
+							} else {
+								append(static_cast<int>(m_int[i]));
 							}
-							prow.add(std::string(colName ? colName : ""), std::move(blob));
-						} else {
-							prow.add(std::string(colName ? colName : ""), std::string(row[c], len));
+							break;
 						}
-						break;
+
+						case MYSQL_TYPE_SHORT:
+						case MYSQL_TYPE_LONG:
+							if (column.is_unsigned)
+								append(static_cast<unsigned int>(m_uint[i]));
+							else
+								append(static_cast<int>(m_int[i]));
+							break;
+
+						case MYSQL_TYPE_LONGLONG:
+							if (column.is_unsigned)
+								append(static_cast<unsigned long int>(m_ull[i]));
+							else
+								append(static_cast<long int>(m_ll[i]));
+							break;
+
+						case MYSQL_TYPE_FLOAT:
+						case MYSQL_TYPE_DOUBLE:
+							append(m_dbl[i]);
+							break;
+
+						case MYSQL_TYPE_BLOB: {
+							const std::string_view data = Text(i);
+							const std::span<const std::byte> bytes(reinterpret_cast<const std::byte*>(data.data()), data.size());
+							if (arena) {
+								if (column.is_binary)
+									append(Value(arena->Store(bytes)));
+								else
+									append(Value(arena->Store(data)));
+							} else if (column.is_binary) {
+								append(Value::CopyBlob(bytes));
+							} else {
+								append(Value::CopyText(data));
+							}
+							break;
+						}
+
+						case MYSQL_TYPE_VAR_STRING:
+						case MYSQL_TYPE_STRING:
+						default: {
+							if (arena) {
+								append(Value(arena->Store(Text(i))));
+								break;
+							}
+							append(Value::CopyText(Text(i)));
+							break;
+						}
+					}
+				}
+				if (decoded)
+					*decoded += payload;
+				return prow;
+			}
+
+			/**
+			 * Appends the buffers filled by the last successful Fetch() as one row of @p result.
+			 * @param result Columnar result built from the same metadata.
+			 */
+			void AppendTo(ColumnarRows& result) const {
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					Column& column = result[i];
+					if (m_is_null[i]) {
+						column.AppendNull();
+						continue;
+					}
+
+					const ColumnInfo& info = m_columns[i];
+					switch (info.type) {
+						case MYSQL_TYPE_TINY:
+							if (info.is_bool)
+								column.AppendBool(m_bool[i] != 0);
+							else if (info.is_unsigned)
+								column.AppendInt64(m_uint[i]);
+							else
+								column.AppendInt64(m_int[i]);
+							break;
+
+						case MYSQL_TYPE_SHORT:
+						case MYSQL_TYPE_LONG:
+							if (info.is_unsigned)
+								column.AppendInt64(m_uint[i]);
+							else
+								column.AppendInt64(m_int[i]);
+							break;
+
+						case MYSQL_TYPE_LONGLONG:
+							if (info.is_unsigned)
+								column.AppendInt64(static_cast<std::int64_t>(m_ull[i]));
+							else
+								column.AppendInt64(m_ll[i]);
+							break;
+
+						case MYSQL_TYPE_FLOAT:
+						case MYSQL_TYPE_DOUBLE:
+							column.AppendDouble(m_dbl[i]);
+							break;
+
+						case MYSQL_TYPE_BLOB:
+							if (info.is_binary) {
+								const std::string_view data = Text(i);
+								column.AppendBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(data.data()), data.size()));
+							}
+							else
+								column.AppendText(Text(i));
+							break;
+
+						default:
+							column.AppendText(Text(i));
+							break;
 					}
+				}
+			}
+
+			/**
+			 * @return Schema built from the result metadata.
+			 */
+			inline const SharedResultSchema& Schema() const noexcept {
+				return m_schema;
+			}
+
+			/**
+			 * @return Number of result columns.
+			 */
+			inline unsigned int FieldCount() const noexcept {
+				return m_nfields;
+			}
+
+			/**
+			 * @param i Column index.
+			 * @return true if the last fetched cell is NULL.
+			 */
+			inline bool IsNull(unsigned int i) const noexcept {
+				return m_is_null[i] != 0;
+			}
 
-					case MYSQL_TYPE_VAR_STRING:
-					case MYSQL_TYPE_STRING:
-					case MYSQL_TYPE_VARCHAR:
+			/**
+			 * @param i Column index.
+			 * @return Last fetched cell as a 64-bit integer (parsed for string columns).
+			 */
+			std::int64_t Int64(unsigned int i) const noexcept {
+				const ColumnInfo& column = m_columns[i];
+				const bool is_unsigned = column.is_unsigned;
+				switch (column.type) {
+					case MYSQL_TYPE_TINY:
+						if (column.is_bool)
+							return m_bool[i];
+						[[fallthrough]];
+					case MYSQL_TYPE_SHORT:
+					case MYSQL_TYPE_LONG:
+						return is_unsigned ? static_cast<std::int64_t>(m_uint[i]) : m_int[i];
+					case MYSQL_TYPE_LONGLONG:
+						return is_unsigned ? static_cast<std::int64_t>(m_ull[i]) : m_ll[i];
+					case MYSQL_TYPE_FLOAT:
+					case MYSQL_TYPE_DOUBLE:
+						return static_cast<std::int64_t>(m_dbl[i]);
 					default: {
-						prow.add(std::string(colName ? colName : ""), std::string(row[c] ? row[c] : "", len));
-						break;
+						std::int64_t v = 0;
+						const std::string_view data = Text(i);
+						std::from_chars(data.data(), data.data() + data.size(), v);
+						return v;
 					}
 				}
 			}
-			rows.add(std::move(prow));
-		}
 
-		return rows;
-	}
+			/**
+			 * @param i Column index.
+			 * @return Last fetched cell as a double (parsed for string columns).
+			 */
+			double Double(unsigned int i) const noexcept {
+				switch (m_columns[i].type) {
+					case MYSQL_TYPE_FLOAT:
+					case MYSQL_TYPE_DOUBLE:
+						return m_dbl[i];
+					case MYSQL_TYPE_TINY:
+					case MYSQL_TYPE_SHORT:
+					case MYSQL_TYPE_LONG:
+					case MYSQL_TYPE_LONGLONG:
+						return static_cast<double>(Int64(i));
+					default: {
+						double v = 0.0;
+						const std::string_view data = Text(i);
+						std::from_chars(data.data(), data.data() + data.size(), v);
+						return v;
+					}
+				}
+			}
+
+			/**
+			 * @param i Column index.
+			 * @return Last fetched string / blob cell (view into the bind buffer or
+			 * the overflow storage of an oversized value).
+			 */
+			inline std::string_view Text(unsigned int i) const noexcept {
+				if (m_oversized[i])
+					return m_overflow[i];
+				return std::string_view(m_str[i].data(), m_str[i].empty() ? 0 : m_len[i]);
+			}
+
+		private:
+			/**
+			 * @struct ColumnInfo
+			 * @brief Decode information of one result column.
+			 */
+			struct ColumnInfo {
+				enum_field_types type = MYSQL_TYPE_STRING;	///< Field type
+				bool is_unsigned = false;					///< UNSIGNED_FLAG set
+				bool is_bool = false;						///< TINYINT(1), decoded as bool
+				bool is_binary = false;						///< Binary charset (BLOB, not TEXT)
+				unsigned long length = 0;					///< Declared display length
+			};
+
+			MYSQL_RES* m_meta;							///< Result metadata (owned)
+			unsigned int m_nfields;						///< Column count
+			SharedResultSchema m_schema;				///< Column names and types
+			std::vector<ColumnInfo> m_columns;			///< Decode info per column
+			std::vector<MYSQL_BIND> m_bind;				///< Output binds
+			std::vector<unsigned long> m_len;			///< Fetched lengths
+			std::vector<my_bool> m_is_null;				///< NULL indicators
+			std::vector<std::vector<char>> m_str;		///< String and blob buffers
+			std::vector<std::string> m_overflow;		///< Oversized values of the current row
+			std::vector<char> m_oversized;				///< Cell lives in m_overflow
+			std::vector<int32_t> m_int;					///< Signed 32-bit buffers
+			std::vector<uint32_t> m_uint;				///< Unsigned 32-bit buffers
+			std::vector<int64_t> m_ll;					///< Signed 64-bit buffers
+			std::vector<uint64_t> m_ull;				///< Unsigned 64-bit buffers
+			std::vector<double> m_dbl;					///< Floating point buffers
+			std::vector<char> m_bool;					///< TINYINT(1) buffers
+
+			/**
+			 * Points each output bind at its buffer, sizing string buffers from
+			 * the declared column length.
+			 */
+			void Layout() {
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					const ColumnInfo& column = m_columns[i];
+					MYSQL_BIND& bind = m_bind[i];
+					memset(&bind, 0, sizeof(MYSQL_BIND));
+					bind.is_null = &m_is_null[i];
+					bind.length = &m_len[i];
+
+					switch (column.type) {
+						case MYSQL_TYPE_TINY:
+							if (column.is_bool) {
+								bind.buffer_type = MYSQL_TYPE_TINY;
+								bind.buffer = &m_bool[i];
+								break;
+							}
+							[[fallthrough]];
+						case MYSQL_TYPE_SHORT:
+						case MYSQL_TYPE_LONG:
+							bind.buffer_type = MYSQL_TYPE_LONG;
+							bind.buffer = column.is_unsigned ? static_cast<void*>(&m_uint[i]) : static_cast<void*>(&m_int[i]);
+							break;
+
+						case MYSQL_TYPE_LONGLONG:
+							bind.buffer_type = MYSQL_TYPE_LONGLONG;
+							bind.buffer = column.is_unsigned ? static_cast<void*>(&m_ull[i]) : static_cast<void*>(&m_ll[i]);
+							break;
+
+						case MYSQL_TYPE_FLOAT:
+						case MYSQL_TYPE_DOUBLE:
+							bind.buffer_type = MYSQL_TYPE_DOUBLE;
+							bind.buffer = &m_dbl[i];
+							break;
+
+						case MYSQL_TYPE_BLOB:
+						case MYSQL_TYPE_VAR_STRING:
+						case MYSQL_TYPE_STRING:
+						default:
+							bind.buffer_type = MYSQL_TYPE_STRING;
+							Resize(i, (column.length && column.length < InitialLength ? column.length : InitialLength) + 1);
+							break;
+					}
+				}
+			}
+
+			/**
+			 * Resizes the string buffer of column @p i and points its bind at it.
+			 * The caller re-binds the statement if it is already bound.
+			 * @param i Column index.
+			 * @param size New buffer size.
+			 */
+			void Resize(unsigned int i, std::size_t size) {
+				std::vector<char>& buffer = m_str[i];
+				if (size < buffer.size()) {
+					std::vector<char>(size).swap(buffer);
+				}
+				else
+					buffer.resize(size);
+				m_bind[i].buffer = buffer.data();
+				m_bind[i].buffer_length = static_cast<unsigned long>(buffer.size());
+			}
+
+			/**
+			 * Reads the oversized value of column @p i into its overflow storage,
+			 * ChunkLength bytes per mysql_stmt_fetch_column call.
+			 * @param stmt Statement positioned on the row.
+			 * @param i Column index.
+			 * @return true on success.
+			 */
+			bool FetchChunked(MYSQL_STMT* stmt, unsigned int i) {
+				const unsigned long total = m_len[i];
+				std::string& out = m_overflow[i];
+				out.resize(total);
+				for (unsigned long offset = 0; offset < total;) {
+					MYSQL_BIND chunk;
+					memset(&chunk, 0, sizeof(MYSQL_BIND));
+					unsigned long remaining = 0;
+					chunk.buffer_type = MYSQL_TYPE_STRING;
+					chunk.buffer = out.data() + offset;
+					chunk.buffer_length = std::min(total - offset, ChunkLength);
+					chunk.length = &remaining;
+					if (mysql_stmt_fetch_column(stmt, &chunk, i, offset) != 0)
+						return false;
+					offset += chunk.buffer_length;
+				}
+				m_oversized[i] = 1;
+				return true;
+			}
+
+			/**
+			 * Frees the overflow storage of the previous row.
+			 */
+			void ReleaseOverflow() noexcept {
+				for (unsigned int i = 0; i < m_nfields; ++i) {
+					if (!m_oversized[i])
+						continue;
+					m_oversized[i] = 0;
+					std::string().swap(m_overflow[i]);
+				}
+			}
+	};
+
+	/**
+	 * @class StmtSource
+	 * @brief Cursor source fetching an unbuffered prepared statement result.
+	 *
+	 * The statement is freed and reset on destruction, which also discards
+	 * any rows the server has not delivered yet.
+	 */
+	class StmtSource final: public Cursor::Source {
+		public:
+			/**
+			 * @param stmt Executed statement (results not stored).
+			 * @param result Bound output buffers.
+			 */
+			StmtSource(MYSQL_STMT* stmt, StmtResult&& result) noexcept
+				:m_stmt(stmt), m_result(std::move(result)) {}
+
+			StmtSource(const StmtSource&) = delete;
+			StmtSource& operator=(const StmtSource&) = delete;
+
+			~StmtSource() noexcept override {
+				mysql_stmt_free_result(m_stmt);
+				mysql_stmt_reset(m_stmt);
+			}
+
+			ExpectedRow Fetch() override {
+				const int rc = m_result.Fetch(m_stmt);
+				if (rc == 0)
+					return std::optional<Row>(m_result.ToRow());
+				if (rc == MYSQL_NO_DATA)
+					return std::optional<Row>();
+				return Unexpected<QueryException>(ExecuteError(mysql_stmt_error(m_stmt) ? mysql_stmt_error(m_stmt) : "Unknown MySQL stmt fetch error"));
+			}
+
+		private:
+			MYSQL_STMT* m_stmt;		///< Statement being fetched
+			StmtResult m_result;	///< Output buffers
+	};
+
+	/**
+	 * @class StmtReader
+	 * @brief RowReader over the output bind buffers of an unbuffered statement result.
+	 *
+	 * The statement's result is freed and the statement reset on destruction.
+	 */
+	class StmtReader final: public RowReader {
+		public:
+			/**
+			 * @param stmt Executed statement (results not stored).
+			 * @param result Bound output buffers.
+			 */
+			StmtReader(MYSQL_STMT* stmt, StmtResult&& result) noexcept
+				:m_stmt(stmt), m_result(std::move(result)) {}
+
+			StmtReader(const StmtReader&) = delete;
+			StmtReader& operator=(const StmtReader&) = delete;
+
+			~StmtReader() noexcept override {
+				mysql_stmt_free_result(m_stmt);
+				mysql_stmt_reset(m_stmt);
+			}
+
+			Expected<bool, QueryException> Next() override {
+				const int rc = m_result.Fetch(m_stmt);
+				if (rc == 0)
+					return true;
+				if (rc == MYSQL_NO_DATA)
+					return false;
+				return Unexpected<QueryException>(ExecuteError(mysql_stmt_error(m_stmt) ? mysql_stmt_error(m_stmt) : "Unknown MySQL stmt fetch error"));
+			}
+
+			std::size_t ColumnCount() const noexcept override {
+				return m_result.FieldCount();
+			}
+
+			bool IsNull(std::size_t column) noexcept override {
+				return m_result.IsNull(static_cast<unsigned int>(column));
+			}
+
+			std::int64_t Int64(std::size_t column) noexcept override {
+				return m_result.Int64(static_cast<unsigned int>(column));
+			}
+
+			double Double(std::size_t column) noexcept override {
+				return m_result.Double(static_cast<unsigned int>(column));
+			}
+
+			bool Bool(std::size_t column) noexcept override {
+				return m_result.Int64(static_cast<unsigned int>(column)) != 0;
+			}
+
+			std::string_view Text(std::size_t column) noexcept override {
+				return m_result.Text(static_cast<unsigned int>(column));
+			}
+
+			std::span<const std::byte> Blob(std::size_t column) override {
+				const std::string_view data = m_result.Text(static_cast<unsigned int>(column));
+				return std::span<const std::byte>(reinterpret_cast<const std::byte*>(data.data()), data.size());
+			}
+
+		private:
+			MYSQL_STMT* m_stmt;		///< Statement being fetched
+			StmtResult m_result;	///< Output buffers
+	};
 }
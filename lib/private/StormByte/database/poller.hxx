@@ -0,0 +1,228 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#if defined(WINDOWS)
+#include <unordered_map>
+#include <winsock2.h>
+#elif defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <unordered_map>
+#endif
+
+namespace StormByte::Database {
+	/**
+	 * @class Poller
+	 * @brief Socket readiness multiplexer used by Reactor.
+	 *
+	 * epoll on Linux (O(ready) waits, so idle connections cost nothing per
+	 * iteration), poll() on other POSIX systems and WSAPoll() on Windows. Wake()
+	 * interrupts a blocked Wait() from another thread; on Windows, which has no
+	 * wake descriptor, Wait() never blocks longer than 10 ms instead.
+	 */
+	class Poller {
+		public:
+			Poller() {
+#if defined(__linux__) && !defined(WINDOWS)
+				m_epoll = ::epoll_create1(EPOLL_CLOEXEC);
+				m_wake = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+				if (m_epoll >= 0 && m_wake >= 0) {
+					epoll_event event{};
+					event.events = EPOLLIN;
+					event.data.fd = m_wake;
+					::epoll_ctl(m_epoll, EPOLL_CTL_ADD, m_wake, &event);
+				}
+#elif !defined(WINDOWS)
+				if (::pipe(m_pipe) == 0) {
+					::fcntl(m_pipe[0], F_SETFL, O_NONBLOCK);
+					::fcntl(m_pipe[1], F_SETFL, O_NONBLOCK);
+				}
+#endif
+			}
+
+			Poller(const Poller&) = delete;
+			Poller& operator=(const Poller&) = delete;
+
+			~Poller() noexcept {
+#if defined(__linux__) && !defined(WINDOWS)
+				if (m_wake >= 0)
+					::close(m_wake);
+				if (m_epoll >= 0)
+					::close(m_epoll);
+#elif !defined(WINDOWS)
+				if (m_pipe[0] >= 0) {
+					::close(m_pipe[0]);
+					::close(m_pipe[1]);
+				}
+#endif
+			}
+
+			/**
+			 * Starts watching @p fd.
+			 * @param fd Socket.
+			 * @param write Also wake when writable.
+			 * @return false if the socket cannot be watched.
+			 */
+			bool Add(std::intptr_t fd, bool write) {
+				if (fd < 0)
+					return false;
+#if defined(__linux__) && !defined(WINDOWS)
+				return Control(EPOLL_CTL_ADD, fd, write);
+#else
+				return m_watched.emplace(fd, write).second;
+#endif
+			}
+
+			/**
+			 * Changes what @p fd is watched for.
+			 * @param fd Socket (already added).
+			 * @param write Also wake when writable.
+			 * @return false on failure.
+			 */
+			bool Modify(std::intptr_t fd, bool write) {
+#if defined(__linux__) && !defined(WINDOWS)
+				return Control(EPOLL_CTL_MOD, fd, write);
+#else
+				auto it = m_watched.find(fd);
+				if (it == m_watched.end())
+					return false;
+				it->second = write;
+				return true;
+#endif
+			}
+
+			/**
+			 * Stops watching @p fd.
+			 * @param fd Socket.
+			 */
+			void Remove(std::intptr_t fd) noexcept {
+#if defined(__linux__) && !defined(WINDOWS)
+				::epoll_ctl(m_epoll, EPOLL_CTL_DEL, static_cast<int>(fd), nullptr);
+#else
+				m_watched.erase(fd);
+#endif
+			}
+
+			/**
+			 * Waits until a watched socket is ready, Wake() is called or @p timeout expires.
+			 * @param timeout Maximum wait in milliseconds (-1: no limit).
+			 * @param ready Receives the ready sockets (cleared first).
+			 */
+			void Wait(int timeout, std::vector<std::intptr_t>& ready) {
+				ready.clear();
+#if defined(__linux__) && !defined(WINDOWS)
+				epoll_event events[256];
+				const int count = ::epoll_wait(m_epoll, events, 256, timeout);
+				for (int i = 0; i < count; ++i) {
+					if (events[i].data.fd == m_wake) {
+						std::uint64_t drain;
+						[[maybe_unused]] auto read = ::read(m_wake, &drain, sizeof(drain));
+					}
+					else
+						ready.push_back(events[i].data.fd);
+				}
+#else
+				m_fds.clear();
+#if !defined(WINDOWS)
+				m_fds.push_back({m_pipe[0], POLLIN, 0});
+#else
+				// No wake descriptor: re-check the caller's queues at least this often
+				if (timeout < 0 || timeout > 10)
+					timeout = 10;
+#endif
+				const std::size_t first = m_fds.size();
+				for (const auto& [fd, write] : m_watched) {
+					PollFd entry{};
+					entry.fd = static_cast<decltype(entry.fd)>(fd);
+					entry.events = write ? (POLLIN | POLLOUT) : POLLIN;
+					m_fds.push_back(entry);
+				}
+#if defined(WINDOWS)
+				if (m_fds.empty()) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+					return;
+				}
+				if (WSAPoll(m_fds.data(), static_cast<ULONG>(m_fds.size()), timeout) <= 0)
+					return;
+#else
+				if (::poll(m_fds.data(), static_cast<nfds_t>(m_fds.size()), timeout) <= 0)
+					return;
+				if (m_fds[0].revents) {
+					char drain[64];
+					while (::read(m_pipe[0], drain, sizeof(drain)) > 0) {}
+				}
+#endif
+				for (std::size_t i = first; i < m_fds.size(); ++i)
+					if (m_fds[i].revents)
+						ready.push_back(static_cast<std::intptr_t>(m_fds[i].fd));
+#endif
+			}
+
+			/**
+			 * Interrupts a blocked Wait(). Safe to call from any thread.
+			 */
+			void Wake() noexcept {
+#if defined(__linux__) && !defined(WINDOWS)
+				const std::uint64_t one = 1;
+				if (m_wake >= 0) {
+					[[maybe_unused]] auto written = ::write(m_wake, &one, sizeof(one));
+				}
+#elif !defined(WINDOWS)
+				const char byte = 0;
+				if (m_pipe[1] >= 0) {
+					[[maybe_unused]] auto written = ::write(m_pipe[1], &byte, 1);
+				}
+#endif
+			}
+
+		private:
+#if defined(__linux__) && !defined(WINDOWS)
+			int m_epoll = -1;											///< epoll instance
+			int m_wake = -1;											///< eventfd interrupting epoll_wait()
+
+			bool Control(int operation, std::intptr_t fd, bool write) {
+				epoll_event event{};
+				event.events = write ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+				event.data.fd = static_cast<int>(fd);
+				return ::epoll_ctl(m_epoll, operation, static_cast<int>(fd), &event) == 0;
+			}
+#else
+#if defined(WINDOWS)
+			using PollFd = WSAPOLLFD;
+#else
+			using PollFd = pollfd;
+			int m_pipe[2] = {-1, -1};									///< Self-pipe interrupting poll()
+#endif
+			std::unordered_map<std::intptr_t, bool> m_watched;			///< Socket -> also writable
+			std::vector<PollFd> m_fds;									///< poll() scratch array
+#endif
+	};
+}
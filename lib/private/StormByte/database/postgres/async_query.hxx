@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/async.hxx>
+#include <StormByte/database/postgres/result_fetch.hxx>
+#include <libpq-fe.h>
+
+#include <functional>
+#include <optional>
+
+namespace StormByte::Database::Postgres {
+	/**
+	 * @class AsyncQuery
+	 * @brief Query sent with libpq's asynchronous API (PQsendQuery / PQsendQueryPrepared).
+	 *
+	 * The connection is switched to non-blocking mode for the duration of the
+	 * operation: Start() sends the query and flushes what it can, Resume() keeps
+	 * flushing and feeds the socket to PQconsumeInput until PQisBusy() clears.
+	 * With several result sets the first error, or else the last result, is kept.
+	 */
+	class AsyncQuery final: public AsyncResult<ExpectedRows> {
+		public:
+			/**
+			 * @param conn Connection (idle).
+			 * @param send Sends the query (PQsendQuery*); returns false on failure.
+			 * @param storage Result storage for the returned Rows.
+			 */
+			AsyncQuery(PGconn* conn, std::function<bool(PGconn*)> send, ResultStorage storage)
+				: m_conn(conn), m_send(std::move(send)), m_storage(storage) {}
+
+			AsyncStatus Start() override {
+				if (!m_conn)
+					return Fail("Database not connected");
+				if (PQsetnonblocking(m_conn, 1) != 0 || !m_send(m_conn))
+					return Fail(PQerrorMessage(m_conn));
+				return Advance();
+			}
+
+			AsyncStatus Resume() override {
+				return Advance();
+			}
+
+			std::intptr_t Handle() const noexcept override {
+				return m_conn ? PQsocket(m_conn) : -1;
+			}
+
+			ExpectedRows Result() override {
+				return std::move(*m_result);
+			}
+
+		private:
+			PGconn* m_conn;								///< Connection
+			std::function<bool(PGconn*)> m_send;		///< Query sender
+			ResultStorage m_storage;					///< Rows payload storage
+			std::optional<ExpectedRows> m_result;		///< Result once done
+
+			AsyncStatus Advance() {
+				const int flushed = PQflush(m_conn);
+				if (flushed < 0 || PQconsumeInput(m_conn) == 0)
+					return Fail(PQerrorMessage(m_conn));
+				if (flushed == 1)
+					return AsyncStatus::WantWrite;
+
+				while (!PQisBusy(m_conn)) {
+					PGresult* res = PQgetResult(m_conn);
+					if (!res) {
+						PQsetnonblocking(m_conn, 0);
+						if (!m_result)
+							m_result = Rows();
+						return AsyncStatus::Done;
+					}
+					if (!m_result || m_result->has_value())
+						m_result = StepResults(MakeShared(res), m_storage);
+					else
+						PQclear(res);
+				}
+				return AsyncStatus::WantRead;
+			}
+
+			AsyncStatus Fail(const char* error) {
+				m_result = Unexpected<ExecuteError>(error && *error ? error : "Unknown Postgres error");
+				if (m_conn) {
+					// Leave the connection idle and blocking for the next call
+					while (PGresult* res = PQgetResult(m_conn))
+						PQclear(res);
+					PQsetnonblocking(m_conn, 0);
+				}
+				return AsyncStatus::Done;
+			}
+	};
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+/**
+ * Encoders / decoders for PostgreSQL binary-format parameters and cells.
+ * Payloads are big-endian; the layouts follow the server's *_send / *_recv functions.
+ */
+namespace StormByte::Database::Postgres::Binary {
+	/**
+	 * Reads a big-endian integer.
+	 * @param data Payload (at least sizeof(T) bytes).
+	 * @return Host-order value.
+	 */
+	template<typename T>
+	inline T ReadInt(const char* data) noexcept {
+		T v;
+		std::memcpy(&v, data, sizeof(T));
+		if constexpr (std::endian::native == std::endian::little && sizeof(T) > 1)
+			v = std::byteswap(v);
+		return v;
+	}
+
+	/**
+	 * Reads a big-endian IEEE float (float4 / float8).
+	 * @param data Payload (at least sizeof(F) bytes).
+	 * @return Host-order value.
+	 */
+	template<typename F>
+	inline F ReadFloat(const char* data) noexcept {
+		using Bits = std::conditional_t<sizeof(F) == 4, std::uint32_t, std::uint64_t>;
+		return std::bit_cast<F>(ReadInt<Bits>(data));
+	}
+
+	/**
+	 * Writes a big-endian integer.
+	 * @param dest Destination (at least sizeof(T) bytes).
+	 * @param v Host-order value.
+	 */
+	template<typename T>
+	inline void WriteInt(char* dest, T v) noexcept {
+		if constexpr (std::endian::native == std::endian::little && sizeof(T) > 1)
+			v = std::byteswap(v);
+		std::memcpy(dest, &v, sizeof(T));
+	}
+
+	/**
+	 * Writes a big-endian IEEE float (float4 / float8).
+	 * @param dest Destination (at least sizeof(F) bytes).
+	 * @param v Host-order value.
+	 */
+	template<typename F>
+	inline void WriteFloat(char* dest, F v) noexcept {
+		using Bits = std::conditional_t<sizeof(F) == 4, std::uint32_t, std::uint64_t>;
+		WriteInt<Bits>(dest, std::bit_cast<Bits>(v));
+	}
+
+	/**
+	 * Appends @p value zero-padded to @p width digits.
+	 * @param out Destination.
+	 * @param value Non-negative value.
+	 * @param width Minimum digit count.
+	 */
+	inline void AppendPadded(std::string& out, long long value, int width) {
+		char buf[24];
+		int len = 0;
+		do {
+			buf[len++] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		} while (value > 0);
+		for (; len < width; ++len)
+			buf[len] = '0';
+		while (len > 0)
+			out += buf[--len];
+	}
+
+	/**
+	 * Appends ".ffffff" for @p micros, without trailing zeros (as the text format does).
+	 * @param out Destination.
+	 * @param micros Microseconds (0 appends nothing).
+	 */
+	inline void AppendMicros(std::string& out, long long micros) {
+		if (micros == 0)
+			return;
+		int width = 6;
+		while (micros % 10 == 0) {
+			micros /= 10;
+			--width;
+		}
+		out += '.';
+		AppendPadded(out, micros, width);
+	}
+
+	/**
+	 * Formats a date as "YYYY-MM-DD".
+	 * @param days_since Days since 2000-01-01.
+	 * @return ISO date, or "infinity" / "-infinity".
+	 */
+	inline std::string FormatDate(std::int32_t days_since) {
+		using namespace std::chrono;
+		if (days_since == INT32_MAX) return "infinity";
+		if (days_since == INT32_MIN) return "-infinity";
+
+		const year_month_day ymd{sys_days{year{2000} / January / 1} + days{days_since}};
+		std::string out;
+		AppendPadded(out, static_cast<int>(ymd.year()), 4);
+		out += '-';
+		AppendPadded(out, static_cast<unsigned>(ymd.month()), 2);
+		out += '-';
+		AppendPadded(out, static_cast<unsigned>(ymd.day()), 2);
+		return out;
+	}
+
+	/**
+	 * Appends a time of day as "HH:MM:SS[.ffffff]".
+	 * @param out Destination.
+	 * @param us Microseconds since midnight.
+	 */
+	inline void AppendTime(std::string& out, std::int64_t us) {
+		AppendPadded(out, us / 3600000000LL, 2);
+		us %= 3600000000LL;
+		out += ':';
+		AppendPadded(out, us / 60000000LL, 2);
+		us %= 60000000LL;
+		out += ':';
+		AppendPadded(out, us / 1000000LL, 2);
+		AppendMicros(out, us % 1000000LL);
+	}
+
+	/**
+	 * Decodes a date (int32 days since 2000-01-01).
+	 * @param data Payload (4 bytes).
+	 * @return See FormatDate().
+	 */
+	inline std::string DecodeDate(const char* data) {
+		return FormatDate(ReadInt<std::int32_t>(data));
+	}
+
+	/**
+	 * Decodes a time (int64 microseconds since midnight) as "HH:MM:SS[.ffffff]".
+	 * @param data Payload (8 bytes).
+	 * @return Time of day.
+	 */
+	inline std::string DecodeTime(const char* data) {
+		std::string out;
+		AppendTime(out, ReadInt<std::int64_t>(data));
+		return out;
+	}
+
+	/**
+	 * Decodes a timestamp / timestamptz (int64 microseconds since 2000-01-01 00:00:00).
+	 * @param data Payload (8 bytes).
+	 * @param with_zone Append "+00" (timestamptz payloads are UTC).
+	 * @return "YYYY-MM-DD HH:MM:SS[.ffffff][+00]", or "infinity" / "-infinity".
+	 */
+	inline std::string DecodeTimestamp(const char* data, bool with_zone) {
+		const std::int64_t us = ReadInt<std::int64_t>(data);
+		if (us == INT64_MAX) return "infinity";
+		if (us == INT64_MIN) return "-infinity";
+
+		constexpr std::int64_t us_per_day = 86400000000LL;
+		std::int64_t days_since = us / us_per_day;
+		std::int64_t time_of_day = us % us_per_day;
+		if (time_of_day < 0) {
+			time_of_day += us_per_day;
+			--days_since;
+		}
+
+		std::string out = FormatDate(static_cast<std::int32_t>(days_since));
+		out += ' ';
+		AppendTime(out, time_of_day);
+		if (with_zone)
+			out += "+00";
+		return out;
+	}
+
+	/**
+	 * Decodes a numeric (base-10000 digit groups) to its canonical text form.
+	 * @param data Payload.
+	 * @param len Payload length.
+	 * @return Decimal text ("NaN", "Infinity", "-Infinity" for specials), or empty if malformed.
+	 */
+	inline std::string DecodeNumeric(const char* data, int len) {
+		if (len < 8)
+			return {};
+		const int ndigits = ReadInt<std::int16_t>(data);
+		const int weight = ReadInt<std::int16_t>(data + 2);
+		const std::uint16_t sign = ReadInt<std::uint16_t>(data + 4);
+		const int dscale = ReadInt<std::int16_t>(data + 6);
+		if (sign == 0xC000) return "NaN";
+		if (sign == 0xD000) return "Infinity";
+		if (sign == 0xF000) return "-Infinity";
+		if (ndigits < 0 || len < 8 + 2 * ndigits)
+			return {};
+
+		auto digit = [&](int i) -> int {
+			return i >= 0 && i < ndigits ? ReadInt<std::int16_t>(data + 8 + 2 * i) : 0;
+		};
+
+		std::string out;
+		if (sign == 0x4000)
+			out += '-';
+		if (weight < 0) {
+			out += '0';
+		} else {
+			for (int i = 0; i <= weight; ++i)
+				AppendPadded(out, digit(i), i == 0 ? 1 : 4);
+		}
+		if (dscale > 0) {
+			out += '.';
+			const std::size_t frac_start = out.size();
+			for (int i = weight + 1; static_cast<int>(out.size() - frac_start) < dscale; ++i)
+				AppendPadded(out, digit(i), 4);
+			out.resize(frac_start + dscale);
+		}
+		return out;
+	}
+
+	/**
+	 * Decodes a uuid (16 raw bytes) as "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx".
+	 * @param data Payload (16 bytes).
+	 * @return Lower-case canonical form.
+	 */
+	inline std::string DecodeUuid(const char* data) {
+		static constexpr char hex[] = "0123456789abcdef";
+		std::string out;
+		out.reserve(36);
+		for (int i = 0; i < 16; ++i) {
+			if (i == 4 || i == 6 || i == 8 || i == 10)
+				out += '-';
+			const unsigned char b = static_cast<unsigned char>(data[i]);
+			out += hex[b >> 4];
+			out += hex[b & 0x0F];
+		}
+		return out;
+	}
+}
@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/blob_stream.hxx>
+#include <StormByte/database/postgres/result_fetch.hxx>
+
+#include <libpq-fe.h>
+#include <libpq/libpq-fs.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <string>
+
+namespace StormByte::Database::Postgres {
+	/**
+	 * Runs @p query with text parameters and a binary result.
+	 * @param conn Connection.
+	 * @param query SQL text with $n placeholders.
+	 * @param params Parameter values.
+	 * @return Result (may be null or failed).
+	 */
+	template<std::size_t N>
+	inline SharedPGresult ExecText(PGconn* conn, const std::string& query, const std::string (&params)[N]) {
+		const char* values[N];
+		for (std::size_t i = 0; i < N; ++i)
+			values[i] = params[i].c_str();
+		return MakeShared(PQexecParams(conn, query.c_str(), static_cast<int>(N), nullptr, values, nullptr, nullptr, 1));
+	}
+
+	/**
+	 * @return Error message of @p res, or of @p conn if @p res is null.
+	 */
+	inline std::string ResultError(PGconn* conn, const SharedPGresult& res) {
+		const char* message = res ? PQresultErrorMessage(res.get()) : PQerrorMessage(conn);
+		return message && *message ? message : "Unknown PG error";
+	}
+
+	/**
+	 * @class SubstringBlob
+	 * @brief Read BlobStream over a bytea cell, one substring() query per chunk.
+	 *
+	 * Chunks come back in binary format, so only the requested bytes cross the
+	 * wire. Reading is cheapest with uncompressed storage
+	 * (ALTER TABLE ... ALTER COLUMN ... SET STORAGE EXTERNAL), which lets the
+	 * server fetch only the TOAST chunks covering the slice.
+	 */
+	class SubstringBlob final: public BlobStream {
+		public:
+			/**
+			 * @param conn Connection.
+			 * @param location Cell to read.
+			 * @param size Size of the value.
+			 */
+			SubstringBlob(PGconn* conn, const BlobLocation& location, std::uint64_t size)
+				:BlobStream(size, BlobMode::Read), m_conn(conn), m_key(std::to_string(location.key)),
+				m_query("SELECT substring(" + location.column + " FROM $2 FOR $3) FROM " + location.table + " WHERE " + location.key_column + " = $1") {}
+
+			~SubstringBlob() noexcept override = default;
+
+		private:
+			PGconn* m_conn;				///< Connection
+			std::string m_key;			///< Row key, as a text parameter
+			std::string m_query;		///< Chunk query
+
+			Expected<void, QueryException> DoRead(std::uint64_t offset, std::span<std::byte> buffer) override {
+				const std::string params[] = { m_key, std::to_string(offset + 1), std::to_string(buffer.size()) };
+				SharedPGresult res = ExecText(m_conn, m_query, params);
+				if (!res || PQresultStatus(res.get()) != PGRES_TUPLES_OK)
+					return Unexpected<ExecuteError>(ResultError(m_conn, res));
+				if (PQntuples(res.get()) != 1 || PQgetisnull(res.get(), 0, 0) || static_cast<std::size_t>(PQgetlength(res.get(), 0, 0)) != buffer.size())
+					return Unexpected<ExecuteError>("Blob value changed while it was being read");
+				std::memcpy(buffer.data(), PQgetvalue(res.get(), 0, 0), buffer.size());
+				return {};
+			}
+
+			Expected<void, QueryException> DoWrite(std::uint64_t, std::span<const std::byte>) override {
+				return Unexpected<ExecuteError>("Blob stream is not writable");
+			}
+
+			Expected<void, QueryException> DoClose(bool) override {
+				return {};
+			}
+	};
+
+	/**
+	 * @class LargeObjectBlob
+	 * @brief Write BlobStream staging the new bytea value in a large object.
+	 *
+	 * Chunks go to the server with lo_write(); Close() copies the large object
+	 * into the cell with lo_get() and unlinks it, so client memory stays at one
+	 * chunk. Everything happens in a transaction (or a savepoint of the
+	 * caller's one), rolled back if the stream is not completed. A connection
+	 * has at most one open write stream (see OpenToken()).
+	 */
+	class LargeObjectBlob final: public BlobStream {
+		public:
+			/**
+			 * Prefix of the savepoint used inside a caller's transaction; a
+			 * per-connection counter makes each name unique.
+			 */
+			static constexpr const char* SavepointPrefix = "stormbyte_blob_";
+
+			/**
+			 * @param conn Connection, inside the stream's transaction or savepoint.
+			 * @param location Cell to replace.
+			 * @param size Size of the new value.
+			 * @param oid Staging large object.
+			 * @param fd Descriptor of @p oid opened for writing.
+			 * @param savepoint Savepoint the stream opened, empty if it began the transaction.
+			 */
+			LargeObjectBlob(PGconn* conn, const BlobLocation& location, std::uint64_t size, Oid oid, int fd, std::string&& savepoint)
+				:BlobStream(size, BlobMode::Write), m_conn(conn), m_key(std::to_string(location.key)),
+				m_row(location.table + " where " + location.key_column + " = " + m_key),
+				m_update("UPDATE " + location.table + " SET " + location.column + " = lo_get($1::oid) WHERE " + location.key_column + " = $2"),
+				m_oid(oid), m_fd(fd), m_savepoint(std::move(savepoint)), m_open(std::make_shared<bool>(true)) {}
+
+			~LargeObjectBlob() noexcept override {
+				if (m_fd >= 0)
+					DoClose(false);
+			}
+
+			/**
+			 * @return Token that expires once the stream is closed.
+			 */
+			std::weak_ptr<const bool> OpenToken() const noexcept {
+				return m_open;
+			}
+
+			/**
+			 * Ends the stream's transaction or savepoint.
+			 * @param conn Connection.
+			 * @param savepoint Savepoint to release / roll back, empty for the transaction.
+			 * @param commit true to commit / release, false to roll back.
+			 * @return true on success.
+			 */
+			static bool Finish(PGconn* conn, const std::string& savepoint, bool commit) {
+				std::string query;
+				if (savepoint.empty())
+					query = commit ? "COMMIT" : "ROLLBACK";
+				else
+					query = commit ? "RELEASE SAVEPOINT " + savepoint : "ROLLBACK TO SAVEPOINT " + savepoint + "; RELEASE SAVEPOINT " + savepoint;
+				SharedPGresult res = MakeShared(PQexec(conn, query.c_str()));
+				return res && PQresultStatus(res.get()) == PGRES_COMMAND_OK;
+			}
+
+		private:
+			PGconn* m_conn;				///< Connection
+			std::string m_key;			///< Row key, as a text parameter
+			std::string m_row;			///< Row description for errors
+			std::string m_update;		///< Final UPDATE
+			Oid m_oid;					///< Staging large object
+			int m_fd;					///< Large object descriptor (-1 once closed)
+			std::string m_savepoint;	///< Savepoint, empty if the stream issued BEGIN
+			std::shared_ptr<bool> m_open;	///< Released on close (see OpenToken())
+
+			Expected<void, QueryException> DoRead(std::uint64_t, std::span<std::byte>) override {
+				return Unexpected<ExecuteError>("Blob stream is not readable");
+			}
+
+			Expected<void, QueryException> DoWrite(std::uint64_t, std::span<const std::byte> data) override {
+				while (!data.empty()) {
+					// lo_write() reports the written size as an int
+					const std::size_t piece = std::min<std::size_t>(data.size(), INT_MAX / 2);
+					if (lo_write(m_conn, m_fd, reinterpret_cast<const char*>(data.data()), piece) != static_cast<int>(piece))
+						return Unexpected<ExecuteError>(PQerrorMessage(m_conn));
+					data = data.subspan(piece);
+				}
+				return {};
+			}
+
+			Expected<void, QueryException> DoClose(bool apply) override {
+				std::string error;
+				if (lo_close(m_conn, m_fd) < 0)
+					error = PQerrorMessage(m_conn);
+				m_fd = -1;
+				m_open.reset();
+
+				if (apply && error.empty()) {
+					const std::string params[] = { std::to_string(m_oid), m_key };
+					SharedPGresult res = ExecText(m_conn, m_update, params);
+					if (!res || PQresultStatus(res.get()) != PGRES_COMMAND_OK)
+						error = ResultError(m_conn, res);
+					else if (std::strcmp(PQcmdTuples(res.get()), "1") != 0)
+						error = "No row in " + m_row;
+					else if (lo_unlink(m_conn, m_oid) < 0)
+						error = PQerrorMessage(m_conn);
+				}
+
+				// Rolling back also drops the staging large object
+				const bool commit = apply && error.empty();
+				if (!Finish(m_conn, m_savepoint, commit) && error.empty())
+					error = PQerrorMessage(m_conn);
+				if (!error.empty())
+					return Unexpected<ExecuteError>(error);
+				return {};
+			}
+	};
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/postgres/result_fetch.hxx>
+#include <libpq-fe.h>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace StormByte::Database::Postgres {
+	/**
+	 * @class CopySource
+	 * @brief Cursor source decoding a COPY ... TO STDOUT (FORMAT binary) stream.
+	 *
+	 * Each Fetch() reads one CopyData message with PQgetCopyData, so only the
+	 * current row is held in memory. Cells are decoded by the column type OIDs
+	 * taken from the described query, like binary-format results. Destroying
+	 * the source before the end cancels the COPY and drains the connection.
+	 */
+	class CopySource final: public Cursor::Source {
+		public:
+			/**
+			 * @param conn Connection in COPY OUT state.
+			 * @param schema Column names and declared types.
+			 * @param types Column type OIDs.
+			 */
+			CopySource(PGconn* conn, SharedResultSchema schema, std::vector<Oid>&& types) noexcept
+				: m_conn(conn), m_schema(std::move(schema)), m_types(std::move(types)), m_header(false), m_done(false) {}
+
+			CopySource(const CopySource&) = delete;
+			CopySource& operator=(const CopySource&) = delete;
+
+			~CopySource() noexcept override {
+				if (m_done)
+					return;
+				if (PGcancel* cancel = PQgetCancel(m_conn)) {
+					char errbuf[256];
+					PQcancel(cancel, errbuf, sizeof(errbuf));
+					PQfreeCancel(cancel);
+				}
+				char* data = nullptr;
+				while (PQgetCopyData(m_conn, &data, 0) >= 0) {
+					PQfreemem(data);
+					data = nullptr;
+				}
+				while (PGresult* res = PQgetResult(m_conn))
+					PQclear(res);
+			}
+
+			ExpectedRow Fetch() override {
+				while (!m_done) {
+					char* data = nullptr;
+					const int length = PQgetCopyData(m_conn, &data, 0);
+					if (length < 0)
+						return Finish(length == -2);
+
+					std::optional<Row> row;
+					const bool valid = Decode(data, length, row);
+					PQfreemem(data);
+					if (!valid) {
+						Finish(false);
+						return Unexpected<ExecuteError>("Malformed binary COPY data");
+					}
+					if (row)
+						return row;
+				}
+				return std::optional<Row>();
+			}
+
+		private:
+			PGconn* m_conn;				///< Connection in COPY OUT state
+			SharedResultSchema m_schema;	///< Shared by every row
+			std::vector<Oid> m_types;	///< Column type OIDs
+			bool m_header;				///< File header consumed
+			bool m_done;				///< COPY finished (or failed)
+
+			/**
+			 * Ends the stream and reads the final command status.
+			 * @param failed PQgetCopyData reported an error.
+			 * @return End of rows, or the error.
+			 */
+			ExpectedRow Finish(bool failed) {
+				m_done = true;
+				std::string error = failed ? PQerrorMessage(m_conn) : "";
+				while (PGresult* res = PQgetResult(m_conn)) {
+					if (PQresultStatus(res) != PGRES_COMMAND_OK && error.empty())
+						error = PQresultErrorMessage(res) ? PQresultErrorMessage(res) : "Unknown PG error";
+					PQclear(res);
+				}
+				if (!error.empty())
+					return Unexpected<ExecuteError>(error);
+				return std::optional<Row>();
+			}
+
+			/**
+			 * Decodes one CopyData message: the file header, a tuple or the trailer.
+			 * @param data Message payload.
+			 * @param length Payload length.
+			 * @param row Receives the tuple, if the message holds one.
+			 * @return false if the message is malformed.
+			 */
+			bool Decode(const char* data, int length, std::optional<Row>& row) {
+				using namespace Binary;
+				const char* end = data + length;
+				if (!m_header) {
+					// Signature (11), flags (4), extension length (4) + extension
+					if (length < 19 || std::memcmp(data, "PGCOPY\n\377\r\n\0", 11) != 0)
+						return false;
+					const std::int32_t extension = ReadInt<std::int32_t>(data + 15);
+					if (extension < 0 || extension > end - data - 19)
+						return false;
+					data += 19 + extension;
+					m_header = true;
+					if (data == end)
+						return true;
+				}
+
+				if (end - data < 2)
+					return false;
+				const std::int16_t fields = ReadInt<std::int16_t>(data);
+				data += 2;
+				if (fields == -1)	// Trailer
+					return true;
+				if (fields != static_cast<std::int16_t>(m_types.size()))
+					return false;
+
+				Row decoded(m_schema);
+				for (std::int16_t c = 0; c < fields; ++c) {
+					if (end - data < 4)
+						return false;
+					const std::int32_t size = ReadInt<std::int32_t>(data);
+					data += 4;
+					if (size < 0) {
+						decoded.add(Value());
+						continue;
+					}
+					if (size > end - data)
+						return false;
+					decoded.add(DecodeBinary(m_types[c], data, size, nullptr, false));
+					data += size;
+				}
+				row = std::move(decoded);
+				return true;
+			}
+	};
+}
@@ -19,20 +19,309 @@
 
 #pragma once
 
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/cursor.hxx>
+#include <StormByte/database/row_reader.hxx>
 #include <StormByte/database/rows.hxx>
+#include <StormByte/database/statement_stats.hxx>
+#include <StormByte/database/postgres/binary.hxx>
 #include <libpq-fe.h>
+#include <charconv>
+#include <cstdint>
 #include <limits>
+#include <optional>
 #include <string>
+#include <system_error>
 #include <vector>
 #include <cctype>
+#include <memory>
 
 namespace StormByte::Database::Postgres {
+	/**
+	 * Maps a built-in type OID to its catalog name.
+	 * @param oid Type OID (PQftype).
+	 * @return Type name, or the numeric OID for types not listed here.
+	 */
+	inline std::string TypeName(Oid oid) {
+		switch (oid) {
+			case 16:	return "bool";
+			case 17:	return "bytea";
+			case 18:	return "char";
+			case 20:	return "int8";
+			case 21:	return "int2";
+			case 23:	return "int4";
+			case 25:	return "text";
+			case 114:	return "json";
+			case 700:	return "float4";
+			case 701:	return "float8";
+			case 1042:	return "bpchar";
+			case 1043:	return "varchar";
+			case 1082:	return "date";
+			case 1083:	return "time";
+			case 1114:	return "timestamp";
+			case 1184:	return "timestamptz";
+			case 1700:	return "numeric";
+			case 2950:	return "uuid";
+			case 3802:	return "jsonb";
+			default:	return std::to_string(oid);
+		}
+	}
+
+	/**
+	 * Builds the schema (names and declared types) of @p res's columns.
+	 * @param res Result (its tuples are not read).
+	 * @return Schema shared by every row of the result.
+	 */
+	inline SharedResultSchema BuildSchema(const PGresult* res) {
+		auto schema = std::make_shared<ResultSchema>();
+		const int nfields = PQnfields(res);
+		schema->Reserve(nfields);
+		for (int c = 0; c < nfields; ++c) {
+			const char* colName = PQfname(res, c);
+			schema->AddColumn(colName ? colName : "", TypeName(PQftype(res, c)));
+		}
+		return schema;
+	}
+
+	/**
+	 * PGresult shared between a Rows and the values viewing its buffer.
+	 */
+	using SharedPGresult = std::shared_ptr<PGresult>;
+
+	/**
+	 * Takes ownership of @p res (released with PQclear).
+	 * @param res Result (may be null).
+	 * @return Shared owner.
+	 */
+	inline SharedPGresult MakeShared(PGresult* res) {
+		return SharedPGresult(res, PQclear);
+	}
+
+	/**
+	 * Parses a text-format number in place (no temporary string).
+	 * @param val Cell text.
+	 * @param vall Cell length.
+	 * @return Parsed value, or std::nullopt if the whole text is not a number.
+	 */
+	template<typename T>
+	inline std::optional<T> TryParseNumber(const char* val, int vall) noexcept {
+		T v{};
+		if (!val)
+			return std::nullopt;
+		const auto [end, ec] = std::from_chars(val, val + vall, v);
+		if (ec != std::errc() || end != val + vall)
+			return std::nullopt;
+		return v;
+	}
+
+	/**
+	 * Parses a text-format number in place (no temporary string).
+	 * @param val Cell text.
+	 * @param vall Cell length.
+	 * @return Parsed value, or 0 if the text is not a number.
+	 */
+	template<typename T>
+	inline T ParseNumber(const char* val, int vall) noexcept {
+		return TryParseNumber<T>(val, vall).value_or(T{});
+	}
+
+	/**
+	 * Wraps a text payload according to the storage mode.
+	 * @param text Payload (inside the PGresult).
+	 * @param arena Arena, or nullptr for an owning value.
+	 * @param borrow View @p text directly.
+	 * @return Text Value.
+	 */
+	inline Value MakeText(std::string_view text, Arena* arena, bool borrow) {
+		if (borrow)
+			return Value(text);
+		if (arena)
+			return Value(arena->Store(text));
+		return Value::CopyText(text);
+	}
+
+	/**
+	 * Wraps a blob payload according to the storage mode.
+	 * @param data Payload (inside the PGresult).
+	 * @param arena Arena, or nullptr for an owning value.
+	 * @param borrow View @p data directly.
+	 * @return Blob Value.
+	 */
+	inline Value MakeBlob(std::span<const std::byte> data, Arena* arena, bool borrow) {
+		if (borrow)
+			return Value(data);
+		if (arena)
+			return Value(arena->Store(data));
+		return Value::CopyBlob(data);
+	}
+
+	/**
+	 * Decodes one binary-format cell by its type OID.
+	 *
+	 * Numbers and bools become native values; date / time / timestamp / numeric
+	 * / uuid are rendered to the same text the text format produces (timestamptz
+	 * in UTC); text-like types and bytea are used as is. Other types have no
+	 * decoder and are returned as their raw binary payload (Blob).
+	 * @param ftype Column type OID.
+	 * @param val Payload.
+	 * @param vall Payload length.
+	 * @param arena Arena, or nullptr for owning values.
+	 * @param borrow View text / bytea payloads directly.
+	 * @return Decoded Value.
+	 */
+	inline Value DecodeBinary(Oid ftype, const char* val, int vall, Arena* arena, bool borrow) {
+		using namespace Binary;
+		switch (ftype) {
+			case 16:	return Value(vall > 0 && val[0] != 0);
+			case 21:	return Value(static_cast<int>(ReadInt<std::int16_t>(val)));
+			case 23:	return Value(static_cast<int>(ReadInt<std::int32_t>(val)));
+			case 20: {
+				const std::int64_t v = ReadInt<std::int64_t>(val);
+				if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
+					return Value(static_cast<long int>(v));
+				return Value(static_cast<int>(v));
+			}
+			case 700:	return Value(static_cast<double>(ReadFloat<float>(val)));
+			case 701:	return Value(ReadFloat<double>(val));
+			case 1082:	return Value(DecodeDate(val));
+			case 1083:	return Value(DecodeTime(val));
+			case 1114:	return Value(DecodeTimestamp(val, false));
+			case 1184:	return Value(DecodeTimestamp(val, true));
+			case 1700:	return Value(DecodeNumeric(val, vall));
+			case 2950:	return Value(DecodeUuid(val));
+			case 18: case 19: case 25: case 114: case 142: case 705: case 1042: case 1043:
+				return MakeText(std::string_view(val, vall), arena, borrow);
+			case 3802:	// jsonb: version byte, then the JSON text
+				return MakeText(vall > 0 ? std::string_view(val + 1, vall - 1) : std::string_view(), arena, borrow);
+			default:	// bytea, and types without a decoder
+				return MakeBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(val), vall), arena, borrow);
+		}
+	}
+
+	/**
+	 * Builds a Row from row @p r of a PGresult (text or binary format).
+	 * @param res Result holding tuples.
+	 * @param r Row number.
+	 * @param schema Schema of the result (from BuildSchema).
+	 * @param arena Arena receiving text / blob payloads, or nullptr for owning values.
+	 * @param borrow If true, text values view @p res's buffer directly (the caller
+	 * keeps @p res alive); text-format blobs still need unescaping and go to @p arena.
+	 * @param decoded Incremented by the Value::PayloadSize() of the row's cells (may be null).
+	 * @return Row with one Value per column.
+	 */
+	inline Row FetchRow(const PGresult* res, int r, const SharedResultSchema& schema, Arena* arena = nullptr, bool borrow = false, std::uint64_t* decoded = nullptr) {
+		const int nfields = PQnfields(res);
+		Row row(schema);
+		std::uint64_t payload = 0;
+		const auto append = [&row, &payload](Value&& value) {
+			payload += value.PayloadSize();
+			row.add(std::move(value));
+		};
+		for (int c = 0; c < nfields; ++c) {
+			if (PQgetisnull(res, r, c)) {
+				append(Value());
+				continue;
+			}
+
+			const Oid ftype = PQftype(res, c);
+			const char* val = PQgetvalue(res, r, c);
+			const int vall = PQgetlength(res, r, c);
+
+			if (PQfformat(res, c) == 1) {
+				append(DecodeBinary(ftype, val, vall, arena, borrow));
+				continue;
+			}
+
+			switch (ftype) {
+				case 16: {
+					bool b = false;
+					if (val && vall > 0) {
+						const char first = static_cast<char>(std::tolower(static_cast<unsigned char>(val[0])));
+						b = first == 't' || first == '1';
+					}
+					append(b);
+					break;
+				}
+
+				case 20:
+				case 21:
+				case 23: {
+					const long long v = ParseNumber<long long>(val, vall);
+					if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
+						append(static_cast<long int>(v));
+					else
+						append(static_cast<int>(v));
+					break;
+				}
+
+				case 700:
+				case 701: {
+					append(ParseNumber<double>(val, vall));
+					break;
+				}
+
+				case 17: {
+					size_t outlen = 0;
+					unsigned char* out = PQunescapeBytea(reinterpret_cast<const unsigned char*>(val), &outlen);
+					// The unescaped copy is freed below, so it is never borrowed
+					append(MakeBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(out), out ? outlen : 0), arena, false));
+					if (out) PQfreemem(out);
+					break;
+				}
+
+				default: {
+					append(MakeText(std::string_view(val ? val : "", vall), arena, borrow));
+					break;
+				}
+			}
+		}
+		if (decoded)
+			*decoded += payload;
+		return row;
+	}
+
 	/**
 	 * Converts a PGresult into Rows.
-	 * @param res Result (must not be null).
+	 * @param res Result (must not be null). With ResultStorage::Borrowed the
+	 * returned Rows shares its ownership; otherwise it is not referenced after return.
+	 * @param storage Where text / blob payloads are kept.
 	 * @return Result rows or a QueryException.
 	 */
-	inline ExpectedRows StepResults(PGresult* res) noexcept {
+	inline ExpectedRows StepResults(const SharedPGresult& res, ResultStorage storage = ResultStorage::Owned) noexcept {
+		if (!res)
+			return Unexpected<QueryException>(ExecuteError("Invalid PGresult provided."));
+
+		const ExecStatusType st = PQresultStatus(res.get());
+		if (st != PGRES_TUPLES_OK && st != PGRES_COMMAND_OK) {
+			return Unexpected<QueryException>(ExecuteError(
+				PQresultErrorMessage(res.get()) ? PQresultErrorMessage(res.get()) : "Unknown PG error"));
+		}
+
+		StatementMetrics::BeginDecode();
+		Rows rows;
+		const int nrows = PQntuples(res.get());
+		if (nrows == 0)
+			return rows;
+
+		const bool borrow = storage == ResultStorage::Borrowed;
+		if (borrow)
+			rows.KeepAlive(res);
+		Arena* arena = storage != ResultStorage::Owned ? &rows.UseArena() : nullptr;
+		const SharedResultSchema schema = BuildSchema(res.get());
+		std::uint64_t decoded = 0;
+		for (int r = 0; r < nrows; ++r)
+			rows.add(FetchRow(res.get(), r, schema, arena, borrow, &decoded));
+
+		StatementMetrics::AddDecodedBytes(decoded);
+		return rows;
+	}
+
+	/**
+	 * Converts a PGresult (text format) into a columnar result.
+	 * @param res Result (must not be null).
+	 * @return Columnar result or a QueryException.
+	 */
+	inline ExpectedColumnarRows StepColumnar(PGresult* res) noexcept {
 		if (!res)
 			return Unexpected<QueryException>(ExecuteError("Invalid PGresult provided."));
 
@@ -42,87 +331,252 @@ namespace StormByte::Database::Postgres {
 				PQresultErrorMessage(res) ? PQresultErrorMessage(res) : "Unknown PG error"));
 		}
 
-		Rows rows;
+		ColumnarRows result(BuildSchema(res));
 		const int nrows = PQntuples(res);
 		const int nfields = PQnfields(res);
 
-		for (int r = 0; r < nrows; ++r) {
-			Row row;
-			for (int c = 0; c < nfields; ++c) {
-				const char* colName = PQfname(res, c);
+		// Column-major: each column's buffers are filled in one pass
+		for (int c = 0; c < nfields; ++c) {
+			Column& column = result[c];
+			column.Reserve(nrows);
+			const Oid ftype = PQftype(res, c);
 
+			for (int r = 0; r < nrows; ++r) {
 				if (PQgetisnull(res, r, c)) {
-					row.add(std::string(colName ? colName : ""), Value());
+					column.AppendNull();
 					continue;
 				}
 
-				const Oid ftype = PQftype(res, c);
 				const char* val = PQgetvalue(res, r, c);
 				const int vall = PQgetlength(res, r, c);
 
 				switch (ftype) {
-					case 16: {
-						bool b = false;
-						if (val) {
-							if (val[0] == 't' || val[0] == '1') {
-								b = true;
-							} else {
-								std::string s(val);
-								for (auto& ch : s) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-								if (s == "true") b = true;
-							}
-						}
-						row.add(std::string(colName ? colName : ""), b);
+					case 16:
+						column.AppendBool(val[0] == 't' || val[0] == '1');
 						break;
-					}
 
 					case 20:
 					case 21:
 					case 23: {
-						long long v = 0;
-						try { v = std::stoll(std::string(val, vall)); } catch (...) { v = 0; }
-						if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
-							row.add(std::string(colName ? colName : ""), static_cast<long int>(v));
-						else
-							row.add(std::string(colName ? colName : ""), static_cast<int>(v));
+						const auto v = TryParseNumber<std::int64_t>(val, vall);
+						if (!v)
+							return Unexpected<QueryException>(ExecuteError(
+								"Malformed integer '" + std::string(val, vall) + "' in column '" + PQfname(res, c) + "'"));
+						column.AppendInt64(*v);
 						break;
 					}
 
 					case 700:
 					case 701: {
-						double d = 0.0;
-						try { d = std::stod(std::string(val, vall)); } catch (...) { d = 0.0; }
-						row.add(std::string(colName ? colName : ""), d);
+						const auto d = TryParseNumber<double>(val, vall);
+						if (!d)
+							return Unexpected<QueryException>(ExecuteError(
+								"Malformed number '" + std::string(val, vall) + "' in column '" + PQfname(res, c) + "'"));
+						column.AppendDouble(*d);
 						break;
 					}
 
 					case 17: {
-						unsigned char* out = nullptr;
 						size_t outlen = 0;
-						out = PQunescapeBytea(reinterpret_cast<const unsigned char*>(val), &outlen);
-
-						std::vector<std::byte> blob;
-						if (out && outlen > 0) {
-							blob.assign(
-								reinterpret_cast<std::byte*>(out),
-								reinterpret_cast<std::byte*>(out) + outlen
-							);
-						}
+						unsigned char* out = PQunescapeBytea(reinterpret_cast<const unsigned char*>(val), &outlen);
+						column.AppendBlob(std::span<const std::byte>(reinterpret_cast<const std::byte*>(out), out ? outlen : 0));
 						if (out) PQfreemem(out);
-
-						row.add(std::string(colName ? colName : ""), std::move(blob));
 						break;
 					}
 
-					default: {
-						row.add(std::string(colName ? colName : ""), std::string(val ? val : "", vall));
+					default:
+						column.AppendText(std::string_view(val, vall));
 						break;
-					}
 				}
 			}
-			rows.add(std::move(row));
 		}
 
-		return rows;
+		return result;
 	}
+
+	/**
+	 * @class StreamSource
+	 * @brief Cursor source reading an in-flight query in single-row / chunked mode.
+	 *
+	 * The query must already have been sent (PQsendQuery / PQsendQueryPrepared).
+	 * Rows are pulled with PQgetResult as the cursor advances, so at most one
+	 * chunk is held in memory. Destroying the source before the end cancels the
+	 * query and drains the connection so it is usable again.
+	 */
+	class StreamSource final: public Cursor::Source {
+		public:
+			/**
+			 * @param conn Connection with a query in flight.
+			 */
+			explicit StreamSource(PGconn* conn) noexcept
+				: m_conn(conn), m_res(nullptr), m_row(0), m_done(false) {}
+
+			StreamSource(const StreamSource&) = delete;
+			StreamSource& operator=(const StreamSource&) = delete;
+
+			~StreamSource() noexcept override {
+				if (m_res)
+					PQclear(m_res);
+				if (m_done)
+					return;
+				if (PGcancel* cancel = PQgetCancel(m_conn)) {
+					char errbuf[256];
+					PQcancel(cancel, errbuf, sizeof(errbuf));
+					PQfreeCancel(cancel);
+				}
+				while (PGresult* res = PQgetResult(m_conn))
+					PQclear(res);
+			}
+
+			ExpectedRow Fetch() override {
+				while (!m_res || m_row >= PQntuples(m_res)) {
+					if (m_res) {
+						PQclear(m_res);
+						m_res = nullptr;
+					}
+					if (m_done)
+						return std::optional<Row>();
+
+					m_res = PQgetResult(m_conn);
+					m_row = 0;
+					if (!m_res) {
+						m_done = true;
+						return std::optional<Row>();
+					}
+
+					const ExecStatusType st = PQresultStatus(m_res);
+					if (st == PGRES_FATAL_ERROR || st == PGRES_BAD_RESPONSE || st == PGRES_NONFATAL_ERROR) {
+						const std::string err = PQresultErrorMessage(m_res) ? PQresultErrorMessage(m_res) : "Unknown PG error";
+						PQclear(m_res);
+						m_res = nullptr;
+						while (PGresult* res = PQgetResult(m_conn))
+							PQclear(res);
+						m_done = true;
+						return Unexpected<QueryException>(ExecuteError(err));
+					}
+				}
+				// Every single-row / chunk result carries the same columns
+				if (!m_schema)
+					m_schema = BuildSchema(m_res);
+				return std::optional<Row>(FetchRow(m_res, m_row++, m_schema));
+			}
+
+		private:
+			PGconn* m_conn;		///< Connection with the query in flight
+			PGresult* m_res;	///< Current single-row / chunk result
+			int m_row;			///< Next row within m_res
+			bool m_done;		///< PQgetResult returned null
+			SharedResultSchema m_schema;	///< Built from the first chunk
+	};
+
+	/**
+	 * Switches the just-sent query to row-at-a-time delivery and wraps it in a Cursor.
+	 * Uses chunked rows mode when libpq provides it (17+), single-row mode otherwise.
+	 * @param conn Connection on which a query was just sent successfully.
+	 * @return Cursor over the result rows.
+	 */
+	inline Cursor StreamResults(PGconn* conn) {
+#ifdef LIBPQ_HAS_CHUNK_MODE
+		PQsetChunkedRowsMode(conn, 256);
+#else
+		PQsetSingleRowMode(conn);
+#endif
+		return Cursor(std::make_unique<StreamSource>(conn));
+	}
+
+	/**
+	 * @class ResultReader
+	 * @brief RowReader over the cells of a PGresult, in text or binary format.
+	 */
+	class ResultReader final: public RowReader {
+		public:
+			/**
+			 * @param res Result holding tuples.
+			 */
+			explicit ResultReader(SharedPGresult res) noexcept
+				: m_res(std::move(res)), m_rows(PQntuples(m_res.get())), m_row(-1) {}
+
+			Expected<bool, QueryException> Next() override {
+				return ++m_row < m_rows;
+			}
+
+			std::size_t ColumnCount() const noexcept override {
+				return static_cast<std::size_t>(PQnfields(m_res.get()));
+			}
+
+			bool IsNull(std::size_t column) noexcept override {
+				return PQgetisnull(m_res.get(), m_row, static_cast<int>(column));
+			}
+
+			std::int64_t Int64(std::size_t column) noexcept override {
+				const int c = static_cast<int>(column);
+				const char* val = PQgetvalue(m_res.get(), m_row, c);
+				const int vall = PQgetlength(m_res.get(), m_row, c);
+				if (PQfformat(m_res.get(), c) == 0)
+					return ParseNumber<long long>(val, vall);
+				switch (PQftype(m_res.get(), c)) {
+					case 16:	return vall > 0 && val[0] != 0;
+					case 21:	return Binary::ReadInt<std::int16_t>(val);
+					case 23:	return Binary::ReadInt<std::int32_t>(val);
+					case 20:	return Binary::ReadInt<std::int64_t>(val);
+					case 700:	return static_cast<std::int64_t>(Binary::ReadFloat<float>(val));
+					case 701:	return static_cast<std::int64_t>(Binary::ReadFloat<double>(val));
+					default:	return 0;
+				}
+			}
+
+			double Double(std::size_t column) noexcept override {
+				const int c = static_cast<int>(column);
+				const char* val = PQgetvalue(m_res.get(), m_row, c);
+				const int vall = PQgetlength(m_res.get(), m_row, c);
+				if (PQfformat(m_res.get(), c) == 0)
+					return ParseNumber<double>(val, vall);
+				switch (PQftype(m_res.get(), c)) {
+					case 700:	return Binary::ReadFloat<float>(val);
+					case 701:	return Binary::ReadFloat<double>(val);
+					default:	return static_cast<double>(Int64(column));
+				}
+			}
+
+			bool Bool(std::size_t column) noexcept override {
+				const int c = static_cast<int>(column);
+				const char* val = PQgetvalue(m_res.get(), m_row, c);
+				if (PQfformat(m_res.get(), c) == 1 && PQftype(m_res.get(), c) == 16)
+					return PQgetlength(m_res.get(), m_row, c) > 0 && val[0] != 0;
+				if (PQftype(m_res.get(), c) == 16)
+					return val[0] == 't' || val[0] == 'T' || val[0] == '1';
+				return Int64(column) != 0;
+			}
+
+			std::string_view Text(std::size_t column) noexcept override {
+				const int c = static_cast<int>(column);
+				const char* val = PQgetvalue(m_res.get(), m_row, c);
+				const int vall = PQgetlength(m_res.get(), m_row, c);
+				// Binary jsonb starts with a format version byte
+				if (PQfformat(m_res.get(), c) == 1 && PQftype(m_res.get(), c) == 3802 && vall > 0)
+					return std::string_view(val + 1, vall - 1);
+				return std::string_view(val, vall);
+			}
+
+			std::span<const std::byte> Blob(std::size_t column) override {
+				const int c = static_cast<int>(column);
+				const char* val = PQgetvalue(m_res.get(), m_row, c);
+				const int vall = PQgetlength(m_res.get(), m_row, c);
+				if (PQfformat(m_res.get(), c) == 1 || PQftype(m_res.get(), c) != 17)
+					return std::span<const std::byte>(reinterpret_cast<const std::byte*>(val), vall);
+
+				// Text-format bytea is escaped; unescape into a buffer reused across cells
+				size_t outlen = 0;
+				unsigned char* out = PQunescapeBytea(reinterpret_cast<const unsigned char*>(val), &outlen);
+				m_scratch.assign(reinterpret_cast<const std::byte*>(out), reinterpret_cast<const std::byte*>(out) + (out ? outlen : 0));
+				if (out) PQfreemem(out);
+				return m_scratch;
+			}
+
+		private:
+			SharedPGresult m_res;				///< Result being read
+			int m_rows;							///< Tuple count
+			int m_row;							///< Current tuple (-1 before the first Next())
+			std::vector<std::byte> m_scratch;	///< Unescaped text-format bytea
+	};
 }
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/blob_stream.hxx>
+
+#include <sqlite3.h>
+#include <string>
+
+/**
+ * @namespace SQLite
+ * @brief SQLite backend for StormByte::Database.
+ */
+namespace StormByte::Database::SQLite {
+	/**
+	 * @class IncrementalBlob
+	 * @brief BlobStream over SQLite's incremental blob I/O (sqlite3_blob_*).
+	 *
+	 * A write stream fills the zeroblob SQLite3::DoOpenBlob() stored inside
+	 * its own savepoint, released on a complete Close() and rolled back otherwise.
+	 */
+	class IncrementalBlob final: public BlobStream {
+		public:
+			/**
+			 * @param db Connection owning the blob.
+			 * @param blob Open blob handle (ownership taken).
+			 * @param size Size of the value.
+			 * @param mode Stream direction.
+			 * @param savepoint Savepoint wrapping a write stream (empty for reads).
+			 */
+			IncrementalBlob(sqlite3* db, sqlite3_blob* blob, std::uint64_t size, BlobMode mode, std::string&& savepoint) noexcept
+				:BlobStream(size, mode), m_db(db), m_blob(blob), m_savepoint(std::move(savepoint)) {}
+
+			~IncrementalBlob() noexcept override {
+				if (m_blob)
+					DoClose(false);
+			}
+
+			/**
+			 * Prefix of write-stream savepoints; a per-connection counter makes each name unique.
+			 */
+			static constexpr const char* SavepointPrefix = "stormbyte_blob_";
+
+		private:
+			sqlite3* m_db;				///< Connection
+			sqlite3_blob* m_blob;		///< Blob handle (null once closed)
+			std::string m_savepoint;	///< Savepoint of a write stream
+
+			Expected<void, QueryException> DoRead(std::uint64_t offset, std::span<std::byte> buffer) override {
+				if (sqlite3_blob_read(m_blob, buffer.data(), static_cast<int>(buffer.size()), static_cast<int>(offset)) != SQLITE_OK)
+					return Unexpected<ExecuteError>(sqlite3_errmsg(m_db));
+				return {};
+			}
+
+			Expected<void, QueryException> DoWrite(std::uint64_t offset, std::span<const std::byte> data) override {
+				if (sqlite3_blob_write(m_blob, data.data(), static_cast<int>(data.size()), static_cast<int>(offset)) != SQLITE_OK)
+					return Unexpected<ExecuteError>(sqlite3_errmsg(m_db));
+				return {};
+			}
+
+			Expected<void, QueryException> DoClose(bool apply) override {
+				std::string error;
+				if (sqlite3_blob_close(m_blob) != SQLITE_OK)
+					error = sqlite3_errmsg(m_db);
+				m_blob = nullptr;
+
+				if (Mode() == BlobMode::Write) {
+					if (!apply || !error.empty())
+						sqlite3_exec(m_db, ("ROLLBACK TO " + m_savepoint).c_str(), nullptr, nullptr, nullptr);
+					if (sqlite3_exec(m_db, ("RELEASE " + m_savepoint).c_str(), nullptr, nullptr, nullptr) != SQLITE_OK && error.empty())
+						error = sqlite3_errmsg(m_db);
+				}
+				if (!error.empty())
+					return Unexpected<ExecuteError>(error);
+				return {};
+			}
+	};
+}
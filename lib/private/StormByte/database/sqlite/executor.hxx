@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/async.hxx>
+#include <StormByte/database/typedefs.hxx>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace StormByte::Database::SQLite {
+	/**
+	 * @class Executor
+	 * @brief Dedicated thread running one connection's asynchronous work in order.
+	 *
+	 * SQLite has no socket to wait on, so QueryAsync() / ExecuteAsync() run the
+	 * blocking call here and resume the awaiting coroutine on this thread. The
+	 * thread starts with the first job. Jobs still queued on destruction run
+	 * before the thread exits.
+	 */
+	class Executor {
+		public:
+			Executor()
+				: m_state(std::make_shared<State>()) {}
+
+			Executor(const Executor&) = delete;
+			Executor& operator=(const Executor&) = delete;
+
+			~Executor() noexcept {
+				{
+					std::lock_guard lock(m_state->mutex);
+					m_state->stop = true;
+				}
+				m_state->ready.notify_one();
+				if (!m_thread.joinable())
+					return;
+				// A job may destroy the connection that owns this executor
+				if (m_thread.get_id() == std::this_thread::get_id())
+					m_thread.detach();
+				else
+					m_thread.join();
+			}
+
+			/**
+			 * Queues @p job.
+			 * @param job Work to run on the executor thread.
+			 */
+			void Post(std::function<void()> job) {
+				{
+					std::lock_guard lock(m_state->mutex);
+					m_state->jobs.push_back(std::move(job));
+					if (!m_thread.joinable())
+						m_thread = std::thread(Run, m_state);
+				}
+				m_state->ready.notify_one();
+			}
+
+		private:
+			/**
+			 * @struct State
+			 * @brief Queue shared with the thread, so a detached thread outlives the Executor safely.
+			 */
+			struct State {
+				std::mutex mutex;							///< Guards jobs and stop
+				std::condition_variable ready;				///< Signals a job or stop
+				std::deque<std::function<void()>> jobs;		///< Pending jobs
+				bool stop = false;							///< Exit once jobs is empty
+			};
+
+			std::shared_ptr<State> m_state;		///< Shared queue
+			std::thread m_thread;				///< Worker (started lazily)
+
+			static void Run(std::shared_ptr<State> state) {
+				std::unique_lock lock(state->mutex);
+				while (true) {
+					state->ready.wait(lock, [&] { return state->stop || !state->jobs.empty(); });
+					if (state->jobs.empty())
+						return;
+					auto job = std::move(state->jobs.front());
+					state->jobs.pop_front();
+					lock.unlock();
+					job();
+					lock.lock();
+				}
+			}
+	};
+
+	/**
+	 * @class OffloadedQuery
+	 * @brief AsyncResult running a blocking query on an Executor.
+	 */
+	class OffloadedQuery final: public AsyncResult<ExpectedRows> {
+		public:
+			/**
+			 * @param executor Connection's executor.
+			 * @param work Blocking call producing the result.
+			 */
+			OffloadedQuery(Executor& executor, std::function<ExpectedRows()> work)
+				: m_executor(executor), m_work(std::move(work)) {}
+
+			AsyncStatus Start() override {
+				return AsyncStatus::Offloaded;
+			}
+
+			void Offload(std::function<void()> done) override {
+				m_executor.Post([this, done = std::move(done)] {
+					m_result = m_work();
+					done();
+				});
+			}
+
+			ExpectedRows Result() override {
+				return std::move(*m_result);
+			}
+
+		private:
+			Executor& m_executor;					///< Runs m_work
+			std::function<ExpectedRows()> m_work;	///< Blocking call
+			std::optional<ExpectedRows> m_result;	///< Result once done
+	};
+}
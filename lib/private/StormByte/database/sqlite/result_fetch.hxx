@@ -19,77 +19,297 @@
 
 #pragma once
 
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/cursor.hxx>
+#include <StormByte/database/row_reader.hxx>
 #include <StormByte/database/rows.hxx>
+#include <StormByte/database/statement_stats.hxx>
 
 #include <sqlite3.h>
+#include <cstdint>
 #include <limits>
+#include <memory>
 
 /**
  * @namespace SQLite
  * @brief SQLite backend for StormByte::Database.
  */
 namespace StormByte::Database::SQLite {
+	/**
+	 * Builds the schema (names and declared types) of @p stmt's result columns.
+	 * @param stmt Prepared statement.
+	 * @return Schema shared by every row of the result.
+	 */
+	inline SharedResultSchema BuildSchema(sqlite3_stmt* stmt) {
+		auto schema = std::make_shared<ResultSchema>();
+		const int colCount = sqlite3_column_count(stmt);
+		schema->Reserve(colCount);
+		for (int i = 0; i < colCount; i++) {
+			const char* colName = sqlite3_column_name(stmt, i);
+			const char* declType = sqlite3_column_decltype(stmt, i);
+			schema->AddColumn(colName ? colName : "", declType ? declType : "");
+		}
+		return schema;
+	}
+
+	/**
+	 * Builds a Row from the statement's current result row.
+	 * @param stmt Statement positioned on a row (last step returned SQLITE_ROW).
+	 * @param schema Schema of the result (from BuildSchema).
+	 * @param arena Arena receiving text / blob payloads, or nullptr for owning values.
+	 * @param decoded Incremented by the Value::PayloadSize() of the row's cells (may be null).
+	 * @return Row with one Value per column.
+	 */
+	inline Row FetchRow(sqlite3_stmt* stmt, const SharedResultSchema& schema, Arena* arena = nullptr, std::uint64_t* decoded = nullptr) {
+		Row row(schema);
+		std::uint64_t payload = 0;
+		const auto append = [&row, &payload](Value&& value) {
+			payload += value.PayloadSize();
+			row.add(std::move(value));
+		};
+		int colCount = sqlite3_column_count(stmt);
+		for (int i = 0; i < colCount; i++) {
+			switch (sqlite3_column_type(stmt, i)) {
+				case SQLITE_INTEGER: {
+					sqlite3_int64 v = sqlite3_column_int64(stmt, i);
+					if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
+						append(static_cast<long int>(v));
+					else
+						append(static_cast<int>(v));
+					break;
+				}
+				case SQLITE_FLOAT:
+					append(sqlite3_column_double(stmt, i));
+					break;
+				case SQLITE_TEXT: {
+					const unsigned char* text = sqlite3_column_text(stmt, i);
+					if (arena) {
+						append(Value(arena->Store(std::string_view(reinterpret_cast<const char*>(text ? text : (const unsigned char*)""), sqlite3_column_bytes(stmt, i)))));
+						break;
+					}
+					append(Value::CopyText(std::string_view(reinterpret_cast<const char*>(text ? text : (const unsigned char*)""), sqlite3_column_bytes(stmt, i))));
+					break;
+				}
+				case SQLITE_BLOB: {
+					const std::byte* blobData = reinterpret_cast<const std::byte*>(sqlite3_column_blob(stmt, i));
+					int blobSize = sqlite3_column_bytes(stmt, i);
+					if (arena) {
+						append(Value(arena->Store(std::span<const std::byte>(blobData, blobData ? blobSize : 0))));
+						break;
+					}
+					append(Value::CopyBlob(std::span<const std::byte>(blobData, blobData ? blobSize : 0)));
+					break;
+				}
+				case SQLITE_NULL:
+				default:
+					append(Value());
+					break;
+			}
+		}
+		if (decoded)
+			*decoded += payload;
+		return row;
+	}
+
+	/**
+	 * Builds the error returned when stepping @p stmt fails.
+	 * @param stmt Statement that failed.
+	 * @return QueryException wrapping sqlite3_errmsg.
+	 */
+	inline auto StepError(sqlite3_stmt* stmt) {
+		const char* errMsg = "Unknown SQLite error";
+		if (sqlite3_db_handle(stmt))
+			errMsg = sqlite3_errmsg(sqlite3_db_handle(stmt));
+		return Unexpected<QueryException>(ExecuteError(errMsg ? errMsg : "Unknown SQLite error"));
+	}
+
 	/**
 	 * Steps through an SQLite statement and builds Rows.
 	 * @param stmt Prepared statement (must not be null).
+	 * @param storage Where text / blob payloads are kept (Borrowed behaves as Arena).
 	 * @return Result rows or a QueryException.
 	 *
 	 * @note Inline and public-visible on Windows even though it lives under private/.
 	 */
-	inline ExpectedRows StepResults(sqlite3_stmt* stmt) noexcept {
+	inline ExpectedRows StepResults(sqlite3_stmt* stmt, ResultStorage storage = ResultStorage::Owned) noexcept {
 		if (!stmt) {
 			return Unexpected<QueryException>(ExecuteError("Invalid SQLite statement provided."));
 		}
 
 		Rows rows;
+		Arena* arena = storage != ResultStorage::Owned ? &rows.UseArena() : nullptr;
+		const SharedResultSchema schema = BuildSchema(stmt);
+		// SQLite produces rows lazily: only the first step counts as execution
+		int rc = sqlite3_step(stmt);
+		StatementMetrics::BeginDecode();
+		std::uint64_t decoded = 0;
+		for (; rc == SQLITE_ROW; rc = sqlite3_step(stmt))
+			rows.add(FetchRow(stmt, schema, arena, &decoded));
+
+		if (rc == SQLITE_DONE) {
+			StatementMetrics::AddDecodedBytes(decoded);
+			return rows;
+		}
+
+		return StepError(stmt);
+	}
+
+	/**
+	 * Steps through an SQLite statement, decoding each cell straight into its column.
+	 * @param stmt Prepared statement (must not be null).
+	 * @return Columnar result or a QueryException.
+	 */
+	inline ExpectedColumnarRows StepColumnar(sqlite3_stmt* stmt) noexcept {
+		if (!stmt) {
+			return Unexpected<QueryException>(ExecuteError("Invalid SQLite statement provided."));
+		}
+
+		ColumnarRows result(BuildSchema(stmt));
+		const int colCount = static_cast<int>(result.ColumnCount());
 		int rc;
 		while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
-			Row row;
-			int colCount = sqlite3_column_count(stmt);
 			for (int i = 0; i < colCount; i++) {
-				const char* colName = sqlite3_column_name(stmt, i);
+				Column& column = result[i];
+				bool ok = true;
 				switch (sqlite3_column_type(stmt, i)) {
-					case SQLITE_INTEGER: {
-						sqlite3_int64 v = sqlite3_column_int64(stmt, i);
-						if (v > std::numeric_limits<int>::max() || v < std::numeric_limits<int>::min())
-							row.add(std::string(colName ? colName : ""), static_cast<long int>(v));
-						else
-							row.add(std::string(colName ? colName : ""), static_cast<int>(v));
+					case SQLITE_INTEGER:
+						ok = column.AppendInt64(sqlite3_column_int64(stmt, i));
 						break;
-					}
 					case SQLITE_FLOAT:
-						row.add(std::string(colName ? colName : ""), sqlite3_column_double(stmt, i));
+						ok = column.AppendDouble(sqlite3_column_double(stmt, i));
 						break;
 					case SQLITE_TEXT: {
 						const unsigned char* text = sqlite3_column_text(stmt, i);
-						row.add(std::string(colName ? colName : ""), std::string(reinterpret_cast<const char*>(text ? text : (const unsigned char*)"")));
+						ok = column.AppendText(std::string_view(reinterpret_cast<const char*>(text ? text : (const unsigned char*)""), sqlite3_column_bytes(stmt, i)));
 						break;
 					}
 					case SQLITE_BLOB: {
 						const std::byte* blobData = reinterpret_cast<const std::byte*>(sqlite3_column_blob(stmt, i));
-						int blobSize = sqlite3_column_bytes(stmt, i);
-						std::vector<std::byte> blobVec;
-						if (blobData && blobSize > 0)
-							blobVec.assign(blobData, blobData + blobSize);
-						row.add(std::string(colName ? colName : ""), std::move(blobVec));
+						const int blobSize = sqlite3_column_bytes(stmt, i);
+						ok = column.AppendBlob(std::span<const std::byte>(blobData, blobData ? blobSize : 0));
 						break;
 					}
 					case SQLITE_NULL:
 					default:
-						row.add(std::string(colName ? colName : ""), Value());
+						column.AppendNull();
 						break;
 				}
+				if (!ok)
+					return Unexpected<QueryException>(ExecuteError("Column '" + result.Schema()->Name(i) + "' mixes incompatible types"));
 			}
-			rows.add(std::move(row));
 		}
 
 		if (rc == SQLITE_DONE) {
-			return rows;
+			return result;
 		}
 
-		const char* errMsg = "Unknown SQLite error";
-		if (sqlite3_db_handle(stmt))
-			errMsg = sqlite3_errmsg(sqlite3_db_handle(stmt));
-		return Unexpected<QueryException>(ExecuteError(errMsg ? errMsg : "Unknown SQLite error"));
+		return StepError(stmt);
 	}
+
+	/**
+	 * @class StatementSource
+	 * @brief Cursor source stepping an SQLite statement on demand.
+	 *
+	 * Owned statements (ad-hoc queries) are finalized on destruction; borrowed
+	 * ones (prepared statements) are reset and have their bindings cleared.
+	 */
+	class StatementSource final: public Cursor::Source {
+		public:
+			/**
+			 * @param stmt Statement with parameters already bound.
+			 * @param owned true to finalize @p stmt when done.
+			 */
+			StatementSource(sqlite3_stmt* stmt, bool owned) noexcept
+				: m_stmt(stmt), m_owned(owned) {}
+
+			StatementSource(const StatementSource&) = delete;
+			StatementSource& operator=(const StatementSource&) = delete;
+
+			~StatementSource() noexcept override {
+				if (!m_stmt)
+					return;
+				if (m_owned) {
+					sqlite3_finalize(m_stmt);
+				} else {
+					sqlite3_reset(m_stmt);
+					sqlite3_clear_bindings(m_stmt);
+				}
+			}
+
+			ExpectedRow Fetch() override {
+				const int rc = sqlite3_step(m_stmt);
+				if (rc == SQLITE_ROW) {
+					if (!m_schema)
+						m_schema = BuildSchema(m_stmt);
+					return std::optional<Row>(FetchRow(m_stmt, m_schema));
+				}
+				if (rc == SQLITE_DONE)
+					return std::optional<Row>();
+				return StepError(m_stmt);
+			}
+
+		private:
+			sqlite3_stmt* m_stmt;	///< Statement being stepped
+			bool m_owned;			///< Finalize (true) or reset (false) on destruction
+			SharedResultSchema m_schema;	///< Built on the first row
+	};
+
+	/**
+	 * @class StatementReader
+	 * @brief RowReader over sqlite3_column_* of a prepared statement.
+	 *
+	 * The statement is borrowed; its owner resets it after reading.
+	 */
+	class StatementReader final: public RowReader {
+		public:
+			/**
+			 * @param stmt Statement with parameters already bound.
+			 */
+			explicit StatementReader(sqlite3_stmt* stmt) noexcept
+				: m_stmt(stmt) {}
+
+			Expected<bool, QueryException> Next() override {
+				const int rc = sqlite3_step(m_stmt);
+				if (rc == SQLITE_ROW)
+					return true;
+				if (rc == SQLITE_DONE)
+					return false;
+				return StepError(m_stmt);
+			}
+
+			std::size_t ColumnCount() const noexcept override {
+				return static_cast<std::size_t>(sqlite3_column_count(m_stmt));
+			}
+
+			bool IsNull(std::size_t column) noexcept override {
+				return sqlite3_column_type(m_stmt, static_cast<int>(column)) == SQLITE_NULL;
+			}
+
+			std::int64_t Int64(std::size_t column) noexcept override {
+				return sqlite3_column_int64(m_stmt, static_cast<int>(column));
+			}
+
+			double Double(std::size_t column) noexcept override {
+				return sqlite3_column_double(m_stmt, static_cast<int>(column));
+			}
+
+			bool Bool(std::size_t column) noexcept override {
+				return sqlite3_column_int64(m_stmt, static_cast<int>(column)) != 0;
+			}
+
+			std::string_view Text(std::size_t column) noexcept override {
+				const char* text = reinterpret_cast<const char*>(sqlite3_column_text(m_stmt, static_cast<int>(column)));
+				const int bytes = sqlite3_column_bytes(m_stmt, static_cast<int>(column));
+				return text ? std::string_view(text, bytes) : std::string_view();
+			}
+
+			std::span<const std::byte> Blob(std::size_t column) override {
+				const void* data = sqlite3_column_blob(m_stmt, static_cast<int>(column));
+				const int bytes = sqlite3_column_bytes(m_stmt, static_cast<int>(column));
+				return data ? std::span<const std::byte>(static_cast<const std::byte*>(data), bytes) : std::span<const std::byte>();
+			}
+
+		private:
+			sqlite3_stmt* m_stmt;	///< Statement being stepped
+	};
 }
@@ -0,0 +1,47 @@
+#include <StormByte/database/arena.hxx>
+
+#include <cstring>
+
+using namespace StormByte::Database;
+
+Arena::Arena(std::size_t block_size) noexcept
+	: m_cursor(nullptr), m_remaining(0), m_block_size(block_size ? block_size : DefaultBlockSize), m_used(0) {}
+
+std::byte* Arena::Allocate(std::size_t size) {
+	if (size > m_block_size / 4) {
+		// Oversized payload: dedicated block, the current one stays in use
+		m_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+		return m_blocks.back().get();
+	}
+
+	if (size > m_remaining) {
+		m_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(m_block_size));
+		m_cursor = m_blocks.back().get();
+		m_remaining = m_block_size;
+	}
+
+	std::byte* result = m_cursor;
+	m_cursor += size;
+	m_remaining -= size;
+	return result;
+}
+
+std::string_view Arena::Store(std::string_view text) {
+	if (text.empty())
+		return {};
+
+	std::byte* dest = Allocate(text.size());
+	std::memcpy(dest, text.data(), text.size());
+	m_used += text.size();
+	return std::string_view(reinterpret_cast<const char*>(dest), text.size());
+}
+
+std::span<const std::byte> Arena::Store(std::span<const std::byte> data) {
+	if (data.empty())
+		return {};
+
+	std::byte* dest = Allocate(data.size());
+	std::memcpy(dest, data.data(), data.size());
+	m_used += data.size();
+	return std::span<const std::byte>(dest, data.size());
+}
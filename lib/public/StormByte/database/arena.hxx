@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/visibility.h>
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class Arena
+	 * @brief Bump allocator packing the text and blob payloads of one result set.
+	 *
+	 * Payloads are copied into large blocks and handed out as views; nothing is
+	 * freed individually, the blocks are released together when the arena is
+	 * destroyed. Payloads larger than a quarter of the block size get a block
+	 * of their own so they do not waste the current one.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Arena {
+		public:
+			static constexpr std::size_t DefaultBlockSize = 64 * 1024;	///< Default block size in bytes
+
+			/**
+			 * @param block_size Size of each block in bytes.
+			 */
+			explicit Arena(std::size_t block_size = DefaultBlockSize) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Arena(const Arena&) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			Arena(Arena&&) noexcept = default;
+
+			/**
+			 * Destructor. Invalidates every view handed out.
+			 */
+			~Arena() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Arena& operator=(const Arena&) = delete;
+
+			/**
+			 * Move assignment.
+			 */
+			Arena& operator=(Arena&&) noexcept = default;
+
+			/**
+			 * Copies @p text into the arena.
+			 * @param text Text to copy.
+			 * @return View of the copy, valid for the arena's lifetime.
+			 */
+			std::string_view Store(std::string_view text);
+
+			/**
+			 * Copies @p data into the arena.
+			 * @param data Bytes to copy.
+			 * @return View of the copy, valid for the arena's lifetime.
+			 */
+			std::span<const std::byte> Store(std::span<const std::byte> data);
+
+			/**
+			 * @return Payload bytes stored so far.
+			 */
+			inline std::size_t Used() const noexcept {
+				return m_used;
+			}
+
+			/**
+			 * @return Number of blocks allocated.
+			 */
+			inline std::size_t BlockCount() const noexcept {
+				return m_blocks.size();
+			}
+
+		private:
+			std::vector<std::unique_ptr<std::byte[]>> m_blocks;	///< Owned blocks
+			std::byte* m_cursor;								///< Next free byte in the current block
+			std::size_t m_remaining;							///< Free bytes in the current block
+			std::size_t m_block_size;							///< Regular block size
+			std::size_t m_used;									///< Payload bytes stored
+
+			/**
+			 * Reserves @p size bytes.
+			 * @param size Byte count (> 0).
+			 * @return Start of the reserved range.
+			 */
+			std::byte* Allocate(std::size_t size);
+	};
+}
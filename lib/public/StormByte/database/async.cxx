@@ -0,0 +1,186 @@
+#include <StormByte/database/async.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef WINDOWS
+#include <winsock2.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+using namespace StormByte::Database;
+
+namespace {
+#ifdef WINDOWS
+	using PollFd = WSAPOLLFD;
+	// No wake descriptor: the loop re-reads its queue at least this often (ms)
+	constexpr int poll_timeout = 10;
+	inline int PollSockets(PollFd* fds, std::size_t count, int timeout) {
+		return WSAPoll(fds, static_cast<ULONG>(count), timeout);
+	}
+#else
+	using PollFd = pollfd;
+	// The wake pipe interrupts poll(), so it can block indefinitely
+	constexpr int poll_timeout = -1;
+	inline int PollSockets(PollFd* fds, std::size_t count, int timeout) {
+		return ::poll(fds, static_cast<nfds_t>(count), timeout);
+	}
+#endif
+
+	/**
+	 * @class PollLoop
+	 * @brief EventLoop::Default(): one thread poll()ing every watched socket.
+	 */
+	class PollLoop final: public EventLoop {
+		public:
+			PollLoop() {
+#ifndef WINDOWS
+				if (::pipe(m_wake) == 0) {
+					::fcntl(m_wake[0], F_SETFL, O_NONBLOCK);
+					::fcntl(m_wake[1], F_SETFL, O_NONBLOCK);
+				}
+#endif
+			}
+
+			~PollLoop() noexcept override {
+				m_stop = true;
+				Wake();
+				if (m_thread.joinable())
+					m_thread.join();
+#ifndef WINDOWS
+				if (m_wake[0] >= 0) {
+					::close(m_wake[0]);
+					::close(m_wake[1]);
+				}
+#endif
+			}
+
+			void Watch(AsyncOperation& operation, AsyncStatus status, std::function<void()> done) override {
+				{
+					std::lock_guard lock(m_mutex);
+					m_incoming.push_back({&operation, status, std::move(done)});
+					if (!m_thread.joinable())
+						m_thread = std::thread([this] { Run(); });
+				}
+				Wake();
+			}
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief A suspended operation.
+			 */
+			struct Entry {
+				AsyncOperation* operation;		///< Operation being driven
+				AsyncStatus status;				///< What it waits for
+				std::function<void()> done;		///< Completion callback
+			};
+
+			std::mutex m_mutex;					///< Guards m_incoming and m_thread
+			std::vector<Entry> m_incoming;		///< Watched since the last poll
+			std::thread m_thread;				///< Polling thread
+			std::atomic<bool> m_stop{false};	///< Set on destruction
+			int m_wake[2] = {-1, -1};			///< Self-pipe interrupting poll() (POSIX)
+
+			void Wake() noexcept {
+#ifndef WINDOWS
+				const char byte = 0;
+				if (m_wake[1] >= 0) {
+					[[maybe_unused]] auto written = ::write(m_wake[1], &byte, 1);
+				}
+#endif
+			}
+
+			void Run() {
+				// Slot of an operation without a socket: resumed on every iteration
+				constexpr std::size_t unpolled = static_cast<std::size_t>(-1);
+				std::vector<Entry> active;
+				std::vector<PollFd> fds;
+				std::vector<std::size_t> slots;
+				std::vector<std::function<void()>> finished;
+				while (!m_stop) {
+					{
+						std::lock_guard lock(m_mutex);
+						for (auto& entry : m_incoming)
+							active.push_back(std::move(entry));
+						m_incoming.clear();
+					}
+
+					fds.clear();
+					slots.clear();
+#ifndef WINDOWS
+					fds.push_back({m_wake[0], POLLIN, 0});
+#endif
+					bool unwatchable = false;
+					for (const auto& entry : active) {
+						const std::intptr_t handle = entry.operation->Handle();
+						if (handle < 0) {
+							// poll() never reports these (same as Reactor's unwatchable list)
+							slots.push_back(unpolled);
+							unwatchable = true;
+							continue;
+						}
+						slots.push_back(fds.size());
+						PollFd fd{};
+						fd.fd = static_cast<decltype(fd.fd)>(handle);
+						fd.events = entry.status == AsyncStatus::WantWrite ? (POLLIN | POLLOUT) : POLLIN;
+						fds.push_back(fd);
+					}
+					const int timeout = unwatchable ? 1 : poll_timeout;
+
+					int polled = 0;
+#ifdef WINDOWS
+					if (fds.empty())
+						std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+					else
+						polled = PollSockets(fds.data(), fds.size(), timeout);
+#else
+					polled = PollSockets(fds.data(), fds.size(), timeout);
+#endif
+					if (polled < 0 && !unwatchable)
+						continue;
+
+#ifndef WINDOWS
+					if (polled > 0 && fds[0].revents) {
+						char drain[64];
+						while (::read(m_wake[0], drain, sizeof(drain)) > 0) {}
+					}
+#endif
+					// Walk backwards so completed entries can be erased in place
+					for (std::size_t i = active.size(); i-- > 0;) {
+						const bool ready = slots[i] == unpolled || (polled > 0 && fds[slots[i]].revents);
+						if (!ready)
+							continue;
+						AsyncStatus status;
+						try {
+							status = active[i].operation->Resume();
+						} catch (...) {
+							status = AsyncStatus::Done;
+						}
+						if (status == AsyncStatus::Done) {
+							finished.push_back(std::move(active[i].done));
+							active.erase(active.begin() + static_cast<std::ptrdiff_t>(i));
+						}
+						else
+							active[i].status = status;
+					}
+					// Resumed coroutines may Watch() again; no lock is held here
+					for (auto& done : finished)
+						done();
+					finished.clear();
+				}
+			}
+	};
+}
+
+EventLoop& EventLoop::Default() {
+	static PollLoop loop;
+	return loop;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/visibility.h>
+
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @enum AsyncStatus
+	 * @brief Progress of an AsyncOperation.
+	 */
+	enum class AsyncStatus {
+		Done,		///< Finished; the result is available
+		WantRead,	///< Waiting for the socket to become readable
+		WantWrite,	///< Waiting for the socket to become writable (or readable)
+		Offloaded	///< Runs elsewhere to completion (see AsyncOperation::Offload)
+	};
+
+	/**
+	 * @class AsyncOperation
+	 * @brief Non-blocking backend operation, advanced as its socket becomes ready.
+	 *
+	 * Network backends send the query in Start() and read the reply in
+	 * Resume(), each call returning what the operation waits for next. Backends
+	 * without a socket (SQLite) return AsyncStatus::Offloaded and run the work
+	 * on their own thread through Offload().
+	 */
+	class STORMBYTE_DATABASE_PUBLIC AsyncOperation {
+		public:
+			/**
+			 * Destructor.
+			 */
+			virtual ~AsyncOperation() noexcept = default;
+
+			/**
+			 * Starts the operation without blocking.
+			 * @return AsyncStatus::Done if it already finished, otherwise what it waits for.
+			 */
+			virtual AsyncStatus Start() = 0;
+
+			/**
+			 * Advances the operation once the awaited socket condition is met.
+			 * @return AsyncStatus::Done once finished, otherwise what it waits for.
+			 */
+			virtual AsyncStatus Resume() {
+				return AsyncStatus::Done;
+			}
+
+			/**
+			 * @return Socket to wait on (a POSIX descriptor or a Windows SOCKET), -1 if none.
+			 */
+			virtual std::intptr_t Handle() const noexcept {
+				return -1;
+			}
+
+			/**
+			 * Runs an AsyncStatus::Offloaded operation to completion and then calls
+			 * @p done, possibly on another thread. The default runs nothing.
+			 * @param done Completion callback.
+			 */
+			virtual void Offload(std::function<void()> done) {
+				done();
+			}
+	};
+
+	/**
+	 * @class AsyncResult
+	 * @brief AsyncOperation producing a @p T.
+	 */
+	template<typename T>
+	class AsyncResult: public AsyncOperation {
+		public:
+			/**
+			 * @return The result; valid once the operation is AsyncStatus::Done.
+			 */
+			virtual T Result() = 0;
+	};
+
+	/**
+	 * @class EventLoop
+	 * @brief Waits on the sockets of suspended operations and completes them.
+	 *
+	 * Default() is a process-wide loop: one background thread polling every
+	 * watched socket. Coroutines awaiting a network query are resumed on that
+	 * thread. Database::SetEventLoop() selects another implementation.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC EventLoop {
+		public:
+			/**
+			 * Destructor.
+			 */
+			virtual ~EventLoop() noexcept = default;
+
+			/**
+			 * Takes over @p operation: waits for @p status, calls Resume() until it
+			 * returns AsyncStatus::Done, then calls @p done.
+			 * @param operation Operation (outlives the call to @p done).
+			 * @param status What the operation waits for (WantRead or WantWrite).
+			 * @param done Completion callback, called on the loop's thread.
+			 */
+			virtual void Watch(AsyncOperation& operation, AsyncStatus status, std::function<void()> done) = 0;
+
+			/**
+			 * @return Process-wide polling loop (its thread starts on first use).
+			 */
+			static EventLoop& Default();
+	};
+
+	/**
+	 * @class Awaitable
+	 * @brief co_await-able result of QueryAsync() / ExecuteAsync().
+	 *
+	 * The operation starts when awaited. If it completes at once the coroutine
+	 * is not suspended; otherwise it is resumed by the EventLoop (network
+	 * backends) or by the backend's executor thread (SQLite). Await it directly:
+	 * bound arguments are only guaranteed to live until the end of the
+	 * co_await expression.
+	 */
+	template<typename T>
+	class Awaitable {
+		public:
+			/**
+			 * Already completed awaitable (e.g. an error detected before starting).
+			 * @param result Result to hand out.
+			 */
+			Awaitable(T&& result)
+				: m_result(std::move(result)) {}
+
+			/**
+			 * @param operation Operation to run.
+			 * @param loop Loop driving it (nullptr: EventLoop::Default()).
+			 */
+			Awaitable(std::unique_ptr<AsyncResult<T>> operation, EventLoop* loop) noexcept
+				: m_operation(std::move(operation)), m_loop(loop) {}
+
+			/**
+			 * Starts the operation.
+			 * @return true if it already completed.
+			 */
+			bool await_ready() {
+				if (!m_operation)
+					return true;
+				m_status = m_operation->Start();
+				return m_status == AsyncStatus::Done;
+			}
+
+			/**
+			 * Hands the operation to its loop or executor.
+			 * @param handle Coroutine to resume on completion.
+			 */
+			void await_suspend(std::coroutine_handle<> handle) {
+				auto resume = [handle] { handle.resume(); };
+				if (m_status == AsyncStatus::Offloaded)
+					m_operation->Offload(std::move(resume));
+				else
+					(m_loop ? *m_loop : EventLoop::Default()).Watch(*m_operation, m_status, std::move(resume));
+			}
+
+			/**
+			 * @return The operation's result.
+			 */
+			T await_resume() {
+				return m_operation ? m_operation->Result() : std::move(*m_result);
+			}
+
+		private:
+			std::unique_ptr<AsyncResult<T>> m_operation;	///< Operation (null when m_result is set)
+			EventLoop* m_loop = nullptr;					///< Driving loop (null: default)
+			AsyncStatus m_status = AsyncStatus::Done;		///< Last reported status
+			std::optional<T> m_result;						///< Immediate result
+	};
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct BatchResult
+	 * @brief Outcome of a successful ExecuteBatch().
+	 */
+	struct BatchResult {
+		std::size_t rows = 0;					///< Rows executed
+		std::uint64_t total_affected = 0;		///< Sum of affected rows
+		std::vector<std::uint64_t> affected;	///< Affected rows per batch row (empty when only a total is reported: MariaDB array execution)
+	};
+}
@@ -0,0 +1,41 @@
+#include <StormByte/database/bitmap.hxx>
+
+#include <algorithm>
+#include <bit>
+
+using namespace StormByte::Database;
+
+Bitmap::Bitmap(std::size_t size, bool value)
+	: m_words((size + 63) / 64, value ? ~std::uint64_t{0} : 0), m_size(size) {
+	if (value && (size & 63))
+		m_words.back() &= (std::uint64_t{1} << (size & 63)) - 1;
+}
+
+Bitmap::Bitmap(std::vector<std::uint64_t>&& words, std::size_t size)
+	: m_words(std::move(words)), m_size(size) {
+	m_words.resize((size + 63) / 64);
+	if (size & 63)
+		m_words.back() &= (std::uint64_t{1} << (size & 63)) - 1;
+}
+
+std::size_t Bitmap::Count() const noexcept {
+	std::size_t count = 0;
+	for (std::uint64_t word : m_words)
+		count += static_cast<std::size_t>(std::popcount(word));
+	return count;
+}
+
+Bitmap& Bitmap::operator&=(const Bitmap& other) noexcept {
+	const std::size_t n = std::min(m_words.size(), other.m_words.size());
+	for (std::size_t i = 0; i < n; ++i)
+		m_words[i] &= other.m_words[i];
+	std::fill(m_words.begin() + n, m_words.end(), 0);
+	return *this;
+}
+
+Bitmap& Bitmap::operator|=(const Bitmap& other) noexcept {
+	const std::size_t n = std::min(m_words.size(), other.m_words.size());
+	for (std::size_t i = 0; i < n; ++i)
+		m_words[i] |= other.m_words[i];
+	return *this;
+}
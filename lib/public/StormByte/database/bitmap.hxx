@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class Bitmap
+	 * @brief Packed bit vector used for column validity and filter selections.
+	 *
+	 * Bits are stored LSB-first in 64-bit words; bits past Size() are always zero,
+	 * so kernels can process whole words without a tail check.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Bitmap {
+		public:
+			/**
+			 * Default constructor (empty).
+			 */
+			Bitmap() noexcept = default;
+
+			/**
+			 * @param size Number of bits.
+			 * @param value Initial value of every bit.
+			 */
+			explicit Bitmap(std::size_t size, bool value = false);
+
+			/**
+			 * Adopts already packed words.
+			 * @param words Packed bits (bits past @p size are cleared).
+			 * @param size Number of bits.
+			 */
+			Bitmap(std::vector<std::uint64_t>&& words, std::size_t size);
+
+			/**
+			 * Copy constructor.
+			 */
+			Bitmap(const Bitmap& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			Bitmap(Bitmap&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~Bitmap() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			Bitmap& operator=(const Bitmap& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			Bitmap& operator=(Bitmap&& other) noexcept = default;
+
+			/**
+			 * Appends a bit.
+			 * @param value Bit value.
+			 */
+			inline void PushBack(bool value) {
+				if ((m_size & 63) == 0)
+					m_words.push_back(0);
+				m_words.back() |= static_cast<std::uint64_t>(value) << (m_size & 63);
+				++m_size;
+			}
+
+			/**
+			 * @param index Bit index (must be < Size()).
+			 * @return Bit value.
+			 */
+			inline bool Test(std::size_t index) const noexcept {
+				return (m_words[index >> 6] >> (index & 63)) & 1;
+			}
+
+			/**
+			 * @param index Bit index (must be < Size()).
+			 * @param value New bit value.
+			 */
+			inline void Set(std::size_t index, bool value) noexcept {
+				const std::uint64_t bit = std::uint64_t{1} << (index & 63);
+				m_words[index >> 6] = value ? (m_words[index >> 6] | bit) : (m_words[index >> 6] & ~bit);
+			}
+
+			/**
+			 * Reserves space for @p size bits.
+			 * @param size Expected bit count.
+			 */
+			inline void Reserve(std::size_t size) {
+				m_words.reserve((size + 63) / 64);
+			}
+
+			/**
+			 * @return Number of bits.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_size;
+			}
+
+			/**
+			 * @return Number of set bits.
+			 */
+			std::size_t Count() const noexcept;
+
+			/**
+			 * @return Packed words (LSB-first).
+			 */
+			inline const std::vector<std::uint64_t>& Words() const noexcept {
+				return m_words;
+			}
+
+			/**
+			 * Intersects with @p other (sizes must match).
+			 * @param other Other bitmap.
+			 * @return *this
+			 */
+			Bitmap& operator&=(const Bitmap& other) noexcept;
+
+			/**
+			 * Unites with @p other (sizes must match).
+			 * @param other Other bitmap.
+			 * @return *this
+			 */
+			Bitmap& operator|=(const Bitmap& other) noexcept;
+
+			/**
+			 * @param other Other bitmap.
+			 * @return Intersection.
+			 */
+			inline Bitmap operator&(const Bitmap& other) const {
+				Bitmap result(*this);
+				return result &= other;
+			}
+
+			/**
+			 * @param other Other bitmap.
+			 * @return Union.
+			 */
+			inline Bitmap operator|(const Bitmap& other) const {
+				Bitmap result(*this);
+				return result |= other;
+			}
+
+		private:
+			std::vector<std::uint64_t> m_words;	///< Packed bits
+			std::size_t m_size = 0;				///< Bit count
+	};
+}
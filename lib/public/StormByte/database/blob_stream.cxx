@@ -0,0 +1,93 @@
+#include <StormByte/database/blob_stream.hxx>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+using namespace StormByte::Database;
+
+StormByte::Expected<void, QueryException> BlobStream::Seek(std::uint64_t position) {
+	if (!m_open)
+		return Unexpected<ExecuteError>("Blob stream is closed");
+	if (m_mode != BlobMode::Read)
+		return Unexpected<ExecuteError>("Blob write streams are sequential");
+	if (position > m_size)
+		return Unexpected<ExecuteError>("Blob offset " + std::to_string(position) + " is past the end (" + std::to_string(m_size) + " bytes)");
+	m_position = position;
+	return {};
+}
+
+StormByte::Expected<std::size_t, QueryException> BlobStream::Read(std::span<std::byte> buffer) {
+	if (!m_open)
+		return Unexpected<ExecuteError>("Blob stream is closed");
+	if (m_mode != BlobMode::Read)
+		return Unexpected<ExecuteError>("Blob stream is not readable");
+	const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(buffer.size(), m_size - m_position));
+	if (count == 0)
+		return 0;
+	if (auto read = DoRead(m_position, buffer.first(count)); !read)
+		return Unexpected(read.error());
+	m_position += count;
+	return count;
+}
+
+StormByte::Expected<void, QueryException> BlobStream::Write(std::span<const std::byte> data) {
+	if (!m_open)
+		return Unexpected<ExecuteError>("Blob stream is closed");
+	if (m_mode != BlobMode::Write)
+		return Unexpected<ExecuteError>("Blob stream is not writable");
+	if (data.size() > m_size - m_position)
+		return Unexpected<ExecuteError>("Blob write exceeds the declared size of " + std::to_string(m_size) + " bytes");
+	if (data.empty())
+		return {};
+	if (auto written = DoWrite(m_position, data); !written) {
+		m_open = false;
+		DoClose(false);
+		return written;
+	}
+	m_position += data.size();
+	return {};
+}
+
+StormByte::Expected<std::uint64_t, QueryException> BlobStream::ReadTo(std::ostream& out, std::size_t chunk_size) {
+	std::vector<std::byte> chunk(std::max<std::size_t>(1, std::min<std::uint64_t>(chunk_size, m_size - std::min(m_position, m_size))));
+	std::uint64_t total = 0;
+	while (true) {
+		auto read = Read(chunk);
+		if (!read)
+			return Unexpected(read.error());
+		if (*read == 0)
+			return total;
+		if (!out.write(reinterpret_cast<const char*>(chunk.data()), static_cast<std::streamsize>(*read)))
+			return Unexpected<ExecuteError>("Failed to write blob data to the output stream");
+		total += *read;
+	}
+}
+
+StormByte::Expected<std::uint64_t, QueryException> BlobStream::WriteFrom(std::istream& in, std::size_t chunk_size) {
+	std::vector<std::byte> chunk(std::max<std::size_t>(1, std::min<std::uint64_t>(chunk_size, m_size - std::min(m_position, m_size))));
+	std::uint64_t total = 0;
+	while (m_position < m_size) {
+		const std::size_t want = static_cast<std::size_t>(std::min<std::uint64_t>(chunk.size(), m_size - m_position));
+		in.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(want));
+		const std::size_t got = static_cast<std::size_t>(in.gcount());
+		if (got == 0)
+			return Unexpected<ExecuteError>("Input stream ended " + std::to_string(m_size - m_position) + " bytes short of the blob size");
+		if (auto written = Write(std::span<const std::byte>(chunk.data(), got)); !written)
+			return Unexpected(written.error());
+		total += got;
+	}
+	return total;
+}
+
+StormByte::Expected<void, QueryException> BlobStream::Close() {
+	if (!m_open)
+		return {};
+	m_open = false;
+	if (m_mode == BlobMode::Write && m_position != m_size) {
+		DoClose(false);
+		return Unexpected<ExecuteError>("Blob stream closed after " + std::to_string(m_position) + " of " + std::to_string(m_size) + " bytes; nothing was written");
+	}
+	return DoClose(m_mode == BlobMode::Write);
+}
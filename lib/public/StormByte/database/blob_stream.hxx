@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/exception.hxx>
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct BlobLocation
+	 * @brief Identifies one blob cell: a column of the row whose key column equals a key.
+	 *
+	 * Names are used as written in SQL (they are not quoted).
+	 */
+	struct STORMBYTE_DATABASE_PUBLIC BlobLocation {
+		std::string table;				///< Table name
+		std::string column;				///< Blob column
+		std::string key_column;			///< Column identifying the row ("rowid" is accepted by SQLite)
+		std::int64_t key = 0;			///< Key of the row
+	};
+
+	/**
+	 * @enum BlobMode
+	 * @brief Direction of a BlobStream.
+	 */
+	enum class BlobMode {
+		Read,		///< Reads an existing value in chunks (Database::ReadBlob())
+		Write		///< Replaces the value with one written sequentially (Database::WriteBlob())
+	};
+
+	/**
+	 * @class BlobStream
+	 * @brief Incremental access to one large binary value, a chunk at a time.
+	 *
+	 * Only the caller's chunk buffer is held in memory whatever the size of
+	 * the value. Backends implement DoRead() / DoWrite() / DoClose() over their
+	 * native facilities:
+	 * - SQLite: sqlite3_blob_read() / sqlite3_blob_write() (writes fill a zeroblob).
+	 * - MariaDB: SUBSTRING() reads into the caller's buffer; writes stream the
+	 *   new value as long data (mysql_stmt_send_long_data).
+	 * - PostgreSQL: substring() reads; writes are staged in a large object
+	 *   (lo_write) that replaces the bytea with lo_get() on Close().
+	 *
+	 * A stream in BlobMode::Write must receive exactly Size() bytes before
+	 * Close() applies them; a stream closed or destroyed earlier leaves the
+	 * stored value unchanged.
+	 *
+	 * @note The stream borrows its connection: it must not outlive its
+	 * Database and no other query may run on the connection while it is open.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC BlobStream {
+		public:
+			/**
+			 * Chunk size used by ReadTo() / WriteFrom() by default (1 MiB).
+			 */
+			static constexpr std::size_t DefaultChunkSize = 1024 * 1024;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			BlobStream(const BlobStream&) = delete;
+
+			/**
+			 * Destructor. Backends release their handle and discard an
+			 * unfinished write.
+			 */
+			virtual ~BlobStream() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			BlobStream& operator=(const BlobStream&) = delete;
+
+			/**
+			 * @return Size of the value in bytes.
+			 */
+			inline std::uint64_t Size() const noexcept {
+				return m_size;
+			}
+
+			/**
+			 * @return Offset of the next Read() / Write().
+			 */
+			inline std::uint64_t Position() const noexcept {
+				return m_position;
+			}
+
+			/**
+			 * @return Stream direction.
+			 */
+			inline BlobMode Mode() const noexcept {
+				return m_mode;
+			}
+
+			/**
+			 * @return true until Close() (or a failed write).
+			 */
+			inline bool IsOpen() const noexcept {
+				return m_open;
+			}
+
+			/**
+			 * Moves the read position.
+			 * @param position New offset (at most Size()).
+			 * @return Nothing, or an error (write stream, offset out of range).
+			 */
+			Expected<void, QueryException> Seek(std::uint64_t position);
+
+			/**
+			 * Reads the next chunk.
+			 * @param buffer Destination; up to its size is read.
+			 * @return Bytes read (0 at the end of the value), or an error.
+			 */
+			Expected<std::size_t, QueryException> Read(std::span<std::byte> buffer);
+
+			/**
+			 * Appends the next chunk of the new value.
+			 * @param data Bytes to write; Position() + size must not exceed Size().
+			 * @return Nothing, or an error (the stream is then closed and nothing is applied).
+			 */
+			Expected<void, QueryException> Write(std::span<const std::byte> data);
+
+			/**
+			 * Reads the rest of the value into @p out.
+			 * @param out Destination stream.
+			 * @param chunk_size Bytes read per backend call.
+			 * @return Bytes copied, or an error.
+			 */
+			Expected<std::uint64_t, QueryException> ReadTo(std::ostream& out, std::size_t chunk_size = DefaultChunkSize);
+
+			/**
+			 * Writes the rest of the value from @p in.
+			 * @param in Source stream; it must provide the Size() - Position() remaining bytes.
+			 * @param chunk_size Bytes written per backend call.
+			 * @return Bytes copied, or an error.
+			 */
+			Expected<std::uint64_t, QueryException> WriteFrom(std::istream& in, std::size_t chunk_size = DefaultChunkSize);
+
+			/**
+			 * Closes the stream. A write stream applies the new value, which
+			 * requires all Size() bytes to have been written.
+			 * @return Nothing, or an error (the value is then left unchanged).
+			 */
+			Expected<void, QueryException> Close();
+
+		protected:
+			/**
+			 * @param size Size of the value (the new value for BlobMode::Write).
+			 * @param mode Stream direction.
+			 */
+			BlobStream(std::uint64_t size, BlobMode mode) noexcept
+				:m_size(size), m_position(0), m_mode(mode), m_open(true) {}
+
+		private:
+			std::uint64_t m_size;			///< Value size
+			std::uint64_t m_position;		///< Next offset
+			BlobMode m_mode;				///< Direction
+			bool m_open;					///< Not closed yet
+
+			/**
+			 * Reads @p buffer.size() bytes at @p offset (always within the value).
+			 * @param offset Offset in the value.
+			 * @param buffer Destination.
+			 * @return Nothing, or an error.
+			 */
+			virtual Expected<void, QueryException> DoRead(std::uint64_t offset, std::span<std::byte> buffer) = 0;
+
+			/**
+			 * Writes @p data at @p offset (sequential, always within the value).
+			 * @param offset Offset in the value.
+			 * @param data Bytes to write.
+			 * @return Nothing, or an error.
+			 */
+			virtual Expected<void, QueryException> DoWrite(std::uint64_t offset, std::span<const std::byte> data) = 0;
+
+			/**
+			 * Releases the backend handle.
+			 * @param apply true to apply a completed write, false to discard it.
+			 * @return Nothing, or an error.
+			 */
+			virtual Expected<void, QueryException> DoClose(bool apply) = 0;
+	};
+}
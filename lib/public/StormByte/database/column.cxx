@@ -0,0 +1,386 @@
+#include <StormByte/database/column.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+using namespace StormByte::Database;
+
+namespace {
+	/**
+	 * Folds the valid (and selected) cells of @p data with @p op.
+	 *
+	 * Works on 64-row blocks masked by the validity word. Fully valid blocks use
+	 * four independent accumulators and no branches so the loop vectorizes;
+	 * partial blocks substitute @p identity for masked-out cells.
+	 */
+	template<typename Acc, typename T, typename Op>
+	Acc Reduce(const T* data, const Bitmap& validity, const Bitmap* selection, Acc identity, Op op) {
+		const std::uint64_t* valid = validity.Words().data();
+		const std::uint64_t* selected = selection ? selection->Words().data() : nullptr;
+		const std::size_t words = selection ? std::min(validity.Words().size(), selection->Words().size()) : validity.Words().size();
+
+		Acc acc[4] = {identity, identity, identity, identity};
+		for (std::size_t w = 0; w < words; ++w) {
+			const std::uint64_t mask = selected ? (valid[w] & selected[w]) : valid[w];
+			if (mask == 0)
+				continue;
+
+			const T* block = data + w * 64;
+			if (mask == ~std::uint64_t{0}) {
+				for (std::size_t j = 0; j < 64; j += 4) {
+					acc[0] = op(acc[0], static_cast<Acc>(block[j]));
+					acc[1] = op(acc[1], static_cast<Acc>(block[j + 1]));
+					acc[2] = op(acc[2], static_cast<Acc>(block[j + 2]));
+					acc[3] = op(acc[3], static_cast<Acc>(block[j + 3]));
+				}
+			} else {
+				// Bits past the column size are zero, so bit_width never reads out of range
+				const std::size_t len = static_cast<std::size_t>(std::bit_width(mask));
+				for (std::size_t j = 0; j < len; ++j)
+					acc[j & 3] = op(acc[j & 3], ((mask >> j) & 1) ? static_cast<Acc>(block[j]) : identity);
+			}
+		}
+		return op(op(acc[0], acc[1]), op(acc[2], acc[3]));
+	}
+
+	/**
+	 * Builds a selection of valid rows where cmp(data[i], operand) holds.
+	 */
+	template<typename T, typename Cmp>
+	Bitmap Compare(const T* data, const Bitmap& validity, T operand, Cmp cmp) {
+		const std::size_t size = validity.Size();
+		const std::vector<std::uint64_t>& valid = validity.Words();
+		std::vector<std::uint64_t> words(valid.size());
+
+		for (std::size_t w = 0; w < words.size(); ++w) {
+			const T* block = data + w * 64;
+			const std::size_t len = std::min<std::size_t>(64, size - w * 64);
+			std::uint64_t bits = 0;
+			if (len == 64) {
+				// Constant trip count so the comparison loop vectorizes
+				for (std::size_t j = 0; j < 64; ++j)
+					bits |= static_cast<std::uint64_t>(cmp(block[j], operand)) << j;
+			} else {
+				for (std::size_t j = 0; j < len; ++j)
+					bits |= static_cast<std::uint64_t>(cmp(block[j], operand)) << j;
+			}
+			words[w] = bits & valid[w];
+		}
+		return Bitmap(std::move(words), size);
+	}
+
+	template<typename T>
+	Bitmap CompareWith(Predicate op, const T* data, const Bitmap& validity, T operand) {
+		switch (op) {
+			case Predicate::Equal:			return Compare(data, validity, operand, std::equal_to<T>());
+			case Predicate::NotEqual:		return Compare(data, validity, operand, std::not_equal_to<T>());
+			case Predicate::Less:			return Compare(data, validity, operand, std::less<T>());
+			case Predicate::LessEqual:		return Compare(data, validity, operand, std::less_equal<T>());
+			case Predicate::Greater:		return Compare(data, validity, operand, std::greater<T>());
+			case Predicate::GreaterEqual:
+			default:						return Compare(data, validity, operand, std::greater_equal<T>());
+		}
+	}
+
+	bool Matches(Predicate op, std::string_view value, std::string_view operand) noexcept {
+		switch (op) {
+			case Predicate::Equal:			return value == operand;
+			case Predicate::NotEqual:		return value != operand;
+			case Predicate::Less:			return value < operand;
+			case Predicate::LessEqual:		return value <= operand;
+			case Predicate::Greater:		return value > operand;
+			case Predicate::GreaterEqual:
+			default:						return value >= operand;
+		}
+	}
+}
+
+Column::Column() noexcept
+	: m_type(Type::Null), m_reserved(0) {}
+
+void Column::Reserve(std::size_t rows) {
+	m_reserved = rows;
+	m_validity.Reserve(rows);
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean:
+			m_ints.reserve(rows);
+			break;
+		case Type::Double:
+			m_doubles.reserve(rows);
+			break;
+		case Type::Text:
+		case Type::Blob:
+			m_offsets.reserve(rows + 1);
+			break;
+		case Type::Null:
+		default:
+			break;
+	}
+}
+
+void Column::Promote(enum Type type) {
+	const std::size_t rows = Size();
+	const std::size_t capacity = std::max(rows, m_reserved);
+
+	if (type == Type::Double && (m_type == Type::Int64 || m_type == Type::Boolean)) {
+		m_doubles.reserve(capacity);
+		m_doubles.assign(m_ints.begin(), m_ints.end());
+		m_ints.clear();
+		m_ints.shrink_to_fit();
+	} else if (m_type == Type::Null) {
+		switch (type) {
+			case Type::Int64:
+			case Type::Boolean:
+				m_ints.reserve(capacity);
+				m_ints.assign(rows, 0);
+				break;
+			case Type::Double:
+				m_doubles.reserve(capacity);
+				m_doubles.assign(rows, 0.0);
+				break;
+			case Type::Text:
+			case Type::Blob:
+				m_offsets.reserve(capacity + 1);
+				m_offsets.assign(rows + 1, 0);
+				break;
+			case Type::Null:
+			default:
+				break;
+		}
+	}
+	m_type = type;
+}
+
+void Column::AppendNull() {
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean:
+			m_ints.push_back(0);
+			break;
+		case Type::Double:
+			m_doubles.push_back(0.0);
+			break;
+		case Type::Text:
+		case Type::Blob:
+			m_offsets.push_back(m_offsets.back());
+			break;
+		case Type::Null:
+		default:
+			break;
+	}
+	m_validity.PushBack(false);
+}
+
+bool Column::AppendInt64(std::int64_t value) {
+	switch (m_type) {
+		case Type::Null:
+		case Type::Boolean:
+			Promote(Type::Int64);
+			[[fallthrough]];
+		case Type::Int64:
+			m_ints.push_back(value);
+			break;
+		case Type::Double:
+			m_doubles.push_back(static_cast<double>(value));
+			break;
+		default:
+			return false;
+	}
+	m_validity.PushBack(true);
+	return true;
+}
+
+bool Column::AppendDouble(double value) {
+	switch (m_type) {
+		case Type::Null:
+		case Type::Int64:
+		case Type::Boolean:
+			Promote(Type::Double);
+			[[fallthrough]];
+		case Type::Double:
+			m_doubles.push_back(value);
+			break;
+		default:
+			return false;
+	}
+	m_validity.PushBack(true);
+	return true;
+}
+
+bool Column::AppendBool(bool value) {
+	switch (m_type) {
+		case Type::Null:
+			Promote(Type::Boolean);
+			[[fallthrough]];
+		case Type::Boolean:
+		case Type::Int64:
+			m_ints.push_back(value ? 1 : 0);
+			break;
+		case Type::Double:
+			m_doubles.push_back(value ? 1.0 : 0.0);
+			break;
+		default:
+			return false;
+	}
+	m_validity.PushBack(true);
+	return true;
+}
+
+bool Column::AppendText(std::string_view value) {
+	if (m_type == Type::Null)
+		Promote(Type::Text);
+	if (m_type != Type::Text)
+		return false;
+
+	const std::byte* data = reinterpret_cast<const std::byte*>(value.data());
+	m_bytes.insert(m_bytes.end(), data, data + value.size());
+	m_offsets.push_back(m_bytes.size());
+	m_validity.PushBack(true);
+	return true;
+}
+
+bool Column::AppendBlob(std::span<const std::byte> value) {
+	if (m_type == Type::Null)
+		Promote(Type::Blob);
+	if (m_type != Type::Blob)
+		return false;
+
+	m_bytes.insert(m_bytes.end(), value.begin(), value.end());
+	m_offsets.push_back(m_bytes.size());
+	m_validity.PushBack(true);
+	return true;
+}
+
+std::string_view Column::Text(std::size_t row) const noexcept {
+	if (m_type != Type::Text && m_type != Type::Blob)
+		return {};
+	return std::string_view(reinterpret_cast<const char*>(m_bytes.data()) + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+}
+
+std::span<const std::byte> Column::Blob(std::size_t row) const noexcept {
+	if (m_type != Type::Text && m_type != Type::Blob)
+		return {};
+	return std::span<const std::byte>(m_bytes.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+}
+
+Value Column::At(std::size_t row) const {
+	if (row >= Size())
+		throw std::out_of_range("Column row index out of range");
+	if (IsNull(row))
+		return Value();
+
+	switch (m_type) {
+		case Type::Int64:
+			return Value(static_cast<long int>(m_ints[row]));
+		case Type::Boolean:
+			return Value(m_ints[row] != 0);
+		case Type::Double:
+			return Value(m_doubles[row]);
+		case Type::Text:
+			return Value::CopyText(Text(row));
+		case Type::Blob:
+			return Value::CopyBlob(Blob(row));
+		case Type::Null:
+		default:
+			return Value();
+	}
+}
+
+std::size_t Column::Count(const Bitmap* selection) const noexcept {
+	if (!selection)
+		return m_validity.Count();
+	return (m_validity & *selection).Count();
+}
+
+Value Column::Sum(const Bitmap* selection) const {
+	if (Count(selection) == 0)
+		return Value();
+
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean: {
+			// Unsigned accumulation wraps on overflow instead of being undefined
+			const std::uint64_t sum = Reduce<std::uint64_t>(m_ints.data(), m_validity, selection, std::uint64_t{0}, std::plus<std::uint64_t>());
+			return Value(static_cast<long int>(static_cast<std::int64_t>(sum)));
+		}
+		case Type::Double:
+			return Value(Reduce<double>(m_doubles.data(), m_validity, selection, 0.0, std::plus<double>()));
+		default:
+			return Value();
+	}
+}
+
+Value Column::Min(const Bitmap* selection) const {
+	if (Count(selection) == 0)
+		return Value();
+
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean: {
+			const std::int64_t min = Reduce<std::int64_t>(m_ints.data(), m_validity, selection,
+				std::numeric_limits<std::int64_t>::max(), [](std::int64_t a, std::int64_t b) { return b < a ? b : a; });
+			if (m_type == Type::Boolean)
+				return Value(min != 0);
+			return Value(static_cast<long int>(min));
+		}
+		case Type::Double:
+			return Value(Reduce<double>(m_doubles.data(), m_validity, selection,
+				std::numeric_limits<double>::infinity(), [](double a, double b) { return b < a ? b : a; }));
+		default:
+			return Value();
+	}
+}
+
+Value Column::Max(const Bitmap* selection) const {
+	if (Count(selection) == 0)
+		return Value();
+
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean: {
+			const std::int64_t max = Reduce<std::int64_t>(m_ints.data(), m_validity, selection,
+				std::numeric_limits<std::int64_t>::lowest(), [](std::int64_t a, std::int64_t b) { return b > a ? b : a; });
+			if (m_type == Type::Boolean)
+				return Value(max != 0);
+			return Value(static_cast<long int>(max));
+		}
+		case Type::Double:
+			return Value(Reduce<double>(m_doubles.data(), m_validity, selection,
+				-std::numeric_limits<double>::infinity(), [](double a, double b) { return b > a ? b : a; }));
+		default:
+			return Value();
+	}
+}
+
+Bitmap Column::Filter(Predicate op, const Value& operand) const {
+	switch (m_type) {
+		case Type::Int64:
+		case Type::Boolean:
+			return CompareWith<std::int64_t>(op, m_ints.data(), m_validity, operand.Get<long int>());
+		case Type::Double:
+			return CompareWith<double>(op, m_doubles.data(), m_validity, operand.Get<double>());
+		case Type::Text:
+		case Type::Blob: {
+			std::string text;
+			if (m_type == Type::Text) {
+				text = operand.Get<std::string>();
+			} else {
+				const std::vector<std::byte> blob = operand.Get<std::vector<std::byte>>();
+				text.assign(reinterpret_cast<const char*>(blob.data()), blob.size());
+			}
+			Bitmap result(Size());
+			for (std::size_t i = 0; i < Size(); ++i) {
+				if (!IsNull(i) && Matches(op, Text(i), text))
+					result.Set(i, true);
+			}
+			return result;
+		}
+		case Type::Null:
+		default:
+			return Bitmap(Size());
+	}
+}
@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/bitmap.hxx>
+#include <StormByte/database/value.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @enum Predicate
+	 * @brief Comparison applied by Column::Filter.
+	 */
+	enum class Predicate: unsigned short {
+		Equal,			///< value == operand
+		NotEqual,		///< value != operand
+		Less,			///< value < operand
+		LessEqual,		///< value <= operand
+		Greater,		///< value > operand
+		GreaterEqual	///< value >= operand
+	};
+
+	/**
+	 * @class Column
+	 * @brief Typed, contiguous column of a ColumnarRows result with a validity bitmap.
+	 *
+	 * Integers and booleans are stored as int64_t, floating point as double and
+	 * text / blob as one byte buffer plus an offsets array (Size() + 1 entries).
+	 * NULL cells keep a zero (or empty) slot so indexes line up with rows.
+	 *
+	 * The column type is fixed by the first non-NULL value. Integer and floating
+	 * point values may be mixed (the column is promoted to Double); any other mix
+	 * is rejected by the Append* methods.
+	 *
+	 * Aggregation and filter kernels walk the data 64 rows at a time, using the
+	 * validity word as a mask, so fully valid blocks run as straight-line loops
+	 * the compiler can vectorize.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Column {
+		public:
+			/**
+			 * @enum Type
+			 * @brief Physical storage of the column.
+			 */
+			enum class Type: unsigned short {
+				Null = 0,	///< No non-NULL value seen yet
+				Int64,		///< int64_t values
+				Double,		///< double values
+				Text,		///< UTF-8 text (offsets + bytes)
+				Blob,		///< Binary data (offsets + bytes)
+				Boolean		///< 0 / 1 stored as int64_t
+			};
+
+			/**
+			 * Default constructor (empty, untyped).
+			 */
+			Column() noexcept;
+
+			/**
+			 * Copy constructor.
+			 */
+			Column(const Column& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			Column(Column&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~Column() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			Column& operator=(const Column& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			Column& operator=(Column&& other) noexcept = default;
+
+			/**
+			 * @name Building
+			 * Used by backends while decoding. Each call appends one row.
+			 * @{
+			 */
+
+			/**
+			 * Reserves space for @p rows rows.
+			 * @param rows Expected row count.
+			 */
+			void Reserve(std::size_t rows);
+
+			/**
+			 * Appends SQL NULL.
+			 */
+			void AppendNull();
+
+			/**
+			 * @param value Integer value.
+			 * @return false if the column holds a non-numeric type.
+			 */
+			bool AppendInt64(std::int64_t value);
+
+			/**
+			 * @param value Floating point value.
+			 * @return false if the column holds a non-numeric type.
+			 */
+			bool AppendDouble(double value);
+
+			/**
+			 * @param value Boolean value.
+			 * @return false if the column holds a non-numeric type.
+			 */
+			bool AppendBool(bool value);
+
+			/**
+			 * @param value Text (copied).
+			 * @return false if the column holds another type.
+			 */
+			bool AppendText(std::string_view value);
+
+			/**
+			 * @param value Binary data (copied).
+			 * @return false if the column holds another type.
+			 */
+			bool AppendBlob(std::span<const std::byte> value);
+
+			/** @} */
+
+			/**
+			 * @return Physical storage type.
+			 */
+			inline enum Type Type() const noexcept {
+				return m_type;
+			}
+
+			/**
+			 * @return Number of rows.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_validity.Size();
+			}
+
+			/**
+			 * @return Number of NULL cells.
+			 */
+			inline std::size_t NullCount() const noexcept {
+				return Size() - m_validity.Count();
+			}
+
+			/**
+			 * @param row Row index (must be < Size()).
+			 * @return true if the cell is NULL.
+			 */
+			inline bool IsNull(std::size_t row) const noexcept {
+				return !m_validity.Test(row);
+			}
+
+			/**
+			 * @return Validity bitmap (bit set = not NULL).
+			 */
+			inline const Bitmap& Validity() const noexcept {
+				return m_validity;
+			}
+
+			/**
+			 * @return Integer (or boolean) values; empty for other types.
+			 */
+			inline std::span<const std::int64_t> Int64s() const noexcept {
+				return m_ints;
+			}
+
+			/**
+			 * @return Floating point values; empty for other types.
+			 */
+			inline std::span<const double> Doubles() const noexcept {
+				return m_doubles;
+			}
+
+			/**
+			 * @param row Row index (must be < Size()).
+			 * @return Text of a Text column (empty for NULL).
+			 */
+			std::string_view Text(std::size_t row) const noexcept;
+
+			/**
+			 * @param row Row index (must be < Size()).
+			 * @return Bytes of a Blob column (empty for NULL).
+			 */
+			std::span<const std::byte> Blob(std::size_t row) const noexcept;
+
+			/**
+			 * Boxes one cell as a Value (convenience, not for hot loops).
+			 * @param row Row index.
+			 * @return Cell value.
+			 * @throws std::out_of_range if @p row is out of range.
+			 */
+			Value At(std::size_t row) const;
+
+			/**
+			 * @name Kernels
+			 * NULL cells never contribute. When @p selection is given (same size as
+			 * the column, typically from Filter()), only selected rows are used.
+			 * @{
+			 */
+
+			/**
+			 * @param selection Optional row selection.
+			 * @return Number of non-NULL (selected) cells.
+			 */
+			std::size_t Count(const Bitmap* selection = nullptr) const noexcept;
+
+			/**
+			 * @param selection Optional row selection.
+			 * @return Sum as long int (Int64 / Boolean) or double (Double);
+			 * NULL Value for text / blob columns or when no cell contributes.
+			 */
+			Value Sum(const Bitmap* selection = nullptr) const;
+
+			/**
+			 * @param selection Optional row selection.
+			 * @return Minimum (long int, double or bool); NULL Value for text / blob
+			 * columns or when no cell contributes.
+			 */
+			Value Min(const Bitmap* selection = nullptr) const;
+
+			/**
+			 * @param selection Optional row selection.
+			 * @return Maximum (long int, double or bool); NULL Value for text / blob
+			 * columns or when no cell contributes.
+			 */
+			Value Max(const Bitmap* selection = nullptr) const;
+
+			/**
+			 * Compares every cell against @p operand.
+			 * @param op Comparison.
+			 * @param operand Right-hand side, converted to the column type.
+			 * @return Selection with a bit set for each non-NULL matching row.
+			 * @throws WrongValueType if @p operand cannot be converted to the column type.
+			 */
+			Bitmap Filter(Predicate op, const Value& operand) const;
+
+			/** @} */
+
+		private:
+			enum Type m_type;						///< Storage type
+			Bitmap m_validity;						///< Bit set = not NULL
+			std::vector<std::int64_t> m_ints;		///< Int64 / Boolean storage
+			std::vector<double> m_doubles;			///< Double storage
+			std::vector<std::uint64_t> m_offsets;	///< Text / Blob offsets (Size() + 1)
+			std::vector<std::byte> m_bytes;			///< Text / Blob bytes
+			std::size_t m_reserved;					///< Row capacity hint applied on Promote()
+
+			/**
+			 * Fixes the column type on the first non-NULL value, back-filling NULL slots.
+			 * @param type New type.
+			 */
+			void Promote(enum Type type);
+	};
+}
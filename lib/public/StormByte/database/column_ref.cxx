@@ -0,0 +1,15 @@
+#include <StormByte/database/column_ref.hxx>
+#include <StormByte/database/exception.hxx>
+
+using namespace StormByte::Database;
+
+ColumnRef::ColumnRef(std::string_view name)
+	: m_name(name) {}
+
+ColumnRef::ColumnRef(SharedResultSchema schema, std::string_view name)
+	: m_schema(std::move(schema)), m_name(name) {
+	std::optional<std::size_t> index = m_schema ? m_schema->IndexOf(m_name) : std::nullopt;
+	if (!index)
+		throw ColumnNotFound(m_name);
+	m_index = *index;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/result_schema.hxx>
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class ColumnRef
+	 * @brief Column name resolved once to an index, for repeated access by name.
+	 *
+	 * Rows sharing the schema the reference was resolved against are accessed
+	 * by index with a single pointer comparison. Rows of another schema (a new
+	 * execution, a different query) still work: the name is checked at the
+	 * cached position first and looked up again only if it moved.
+	 * @code
+	 * const ColumnRef id = rows.Column("id");
+	 * for (const Row& row : rows)
+	 * 	sum += row[id].Get<int>();
+	 * @endcode
+	 */
+	class STORMBYTE_DATABASE_PUBLIC ColumnRef {
+		public:
+			/**
+			 * Creates an unresolved reference; every access looks @p name up.
+			 * @param name Column name.
+			 */
+			explicit ColumnRef(std::string_view name);
+
+			/**
+			 * Resolves @p name against @p schema.
+			 * @param schema Schema of the rows that will be accessed.
+			 * @param name Column name.
+			 * @throws ColumnNotFound if @p schema has no such column.
+			 */
+			ColumnRef(SharedResultSchema schema, std::string_view name);
+
+			/**
+			 * Copy constructor.
+			 */
+			ColumnRef(const ColumnRef& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			ColumnRef(ColumnRef&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~ColumnRef() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			ColumnRef& operator=(const ColumnRef& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			ColumnRef& operator=(ColumnRef&& other) noexcept = default;
+
+			/**
+			 * @return Column name.
+			 */
+			inline const std::string& Name() const noexcept {
+				return m_name;
+			}
+
+			/**
+			 * @return Resolved index (meaningful only if the reference is resolved).
+			 */
+			inline std::size_t Index() const noexcept {
+				return m_index;
+			}
+
+			/**
+			 * @param schema Schema to check.
+			 * @return true if Index() is valid for rows of @p schema without a lookup.
+			 */
+			inline bool ResolvedFor(const ResultSchema* schema) const noexcept {
+				return schema != nullptr && schema == m_schema.get();
+			}
+
+		private:
+			SharedResultSchema m_schema;	///< Schema the index was resolved against (kept alive so the pointer cannot be reused)
+			std::string m_name;				///< Column name
+			std::size_t m_index = 0;		///< Index in m_schema
+	};
+}
@@ -0,0 +1,17 @@
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/exception.hxx>
+
+using namespace StormByte::Database;
+
+ColumnarRows::ColumnarRows(SharedResultSchema schema)
+	: m_schema(std::move(schema)) {
+	if (m_schema)
+		m_data.resize(m_schema->Count());
+}
+
+const Column& ColumnarRows::operator[](std::string_view columnName) const {
+	std::optional<std::size_t> index = m_schema ? m_schema->IndexOf(columnName) : std::nullopt;
+	if (!index || *index >= m_data.size())
+		throw ColumnNotFound(std::string(columnName));
+	return m_data[*index];
+}
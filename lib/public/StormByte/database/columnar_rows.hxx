@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/column.hxx>
+#include <StormByte/database/result_schema.hxx>
+#include <StormByte/iterable.hxx>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class ColumnarRows
+	 * @brief Column-oriented result set: one typed, contiguous Column per result column.
+	 *
+	 * Returned by Database::QueryColumnar() and Database::ExecuteColumnar(). Backends
+	 * decode straight into the column buffers, so no per-cell Value is built.
+	 * Use it for scans and aggregations; use Rows for record-at-a-time access.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC ColumnarRows: public Iterable<std::vector<Column>> {
+		public:
+			/**
+			 * Default constructor (no columns).
+			 */
+			ColumnarRows() noexcept = default;
+
+			/**
+			 * Creates one empty Column per schema column.
+			 * @param schema Result schema.
+			 */
+			explicit ColumnarRows(SharedResultSchema schema);
+
+			/**
+			 * Copy constructor.
+			 */
+			ColumnarRows(const ColumnarRows& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			ColumnarRows(ColumnarRows&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~ColumnarRows() noexcept override = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			ColumnarRows& operator=(const ColumnarRows& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			ColumnarRows& operator=(ColumnarRows&& other) noexcept = default;
+
+			/**
+			 * Access by column name.
+			 * @param columnName Column name.
+			 * @return Column.
+			 * @throws ColumnNotFound if the name is absent.
+			 */
+			const Column& operator[](std::string_view columnName) const;
+
+			using Iterable::operator[];
+
+			/**
+			 * @return Number of columns.
+			 */
+			inline std::size_t ColumnCount() const noexcept {
+				return size();
+			}
+
+			/**
+			 * @return Number of rows.
+			 */
+			inline std::size_t RowCount() const noexcept {
+				return m_data.empty() ? 0 : m_data.front().Size();
+			}
+
+			/**
+			 * @return Result schema (null for a default-constructed object).
+			 */
+			inline const SharedResultSchema& Schema() const noexcept {
+				return m_schema;
+			}
+
+		private:
+			SharedResultSchema m_schema;	///< Column names and types
+	};
+}
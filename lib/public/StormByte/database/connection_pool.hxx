@@ -0,0 +1,573 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/database.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct PoolOptions
+	 * @brief Sizing and maintenance policy of a ConnectionPool.
+	 */
+	struct PoolOptions {
+		std::size_t min_size = 0;										///< Connections opened up front and kept through eviction
+		std::size_t max_size = 8;										///< Hard limit of open connections
+		std::chrono::milliseconds acquire_timeout{5000};				///< Default wait for Acquire() when the pool is exhausted
+		std::chrono::milliseconds idle_timeout{0};						///< Close connections idle longer than this (0 = never)
+		std::chrono::milliseconds health_check_interval{0};				///< Check connections idle at least this long on checkout (0 = always)
+	};
+
+	/**
+	 * @struct PoolStats
+	 * @brief Snapshot of ConnectionPool counters.
+	 */
+	struct PoolStats {
+		std::size_t size = 0;						///< Open connections
+		std::size_t in_use = 0;						///< Checked out connections
+		std::size_t max_size = 0;					///< Pool capacity
+		std::uint64_t acquired = 0;					///< Successful checkouts
+		std::uint64_t waited = 0;					///< Checkouts that had to wait for a release
+		std::uint64_t timeouts = 0;					///< Checkouts that timed out
+		std::uint64_t created = 0;					///< Connections opened
+		std::uint64_t evicted = 0;					///< Connections closed for being idle
+		std::uint64_t health_failures = 0;			///< Connections dropped by the health check or released disconnected
+		std::chrono::nanoseconds total_wait{0};		///< Accumulated checkout latency
+		std::chrono::nanoseconds max_wait{0};		///< Worst checkout latency
+
+		/**
+		 * @return Fraction of the capacity checked out (0..1).
+		 */
+		inline double Utilization() const noexcept {
+			return max_size == 0 ? 0.0 : static_cast<double>(in_use) / static_cast<double>(max_size);
+		}
+
+		/**
+		 * @return Mean checkout latency.
+		 */
+		inline std::chrono::nanoseconds AverageWait() const noexcept {
+			return acquired == 0 ? std::chrono::nanoseconds{0} : total_wait / static_cast<std::int64_t>(acquired);
+		}
+	};
+
+	/**
+	 * @class ConnectionPool
+	 * @brief Bounded, thread-safe pool of connected Database instances.
+	 *
+	 * Connections are built by a factory and connected by the pool, so every
+	 * pooled instance has already run DoPostConnect() and prepared its
+	 * statements. Acquire() hands out a Lease that returns the connection on
+	 * destruction; an idle connection is claimed with a single compare-and-swap
+	 * on its slot, and the mutex is only taken to wait when the pool is exhausted.
+	 *
+	 * A Database is still not thread-safe: a connection belongs to the thread
+	 * holding its Lease. The pool must outlive every Lease it handed out.
+	 * @tparam DB Database subclass.
+	 */
+	template<typename DB> requires std::derived_from<DB, Database>
+	class ConnectionPool {
+		public:
+			/**
+			 * @typedef Factory
+			 * @brief Builds a new, not yet connected, DB.
+			 */
+			using Factory = std::function<std::unique_ptr<DB>()>;
+
+			/**
+			 * @typedef HealthCheck
+			 * @brief Returns false if an idle connection must be replaced.
+			 */
+			using HealthCheck = std::function<bool(DB&)>;
+
+			/**
+			 * @class Lease
+			 * @brief RAII checkout of one pooled connection.
+			 */
+			class Lease {
+				public:
+					/**
+					 * Empty lease.
+					 */
+					Lease() noexcept = default;
+
+					/**
+					 * Copy constructor (deleted).
+					 */
+					Lease(const Lease&) = delete;
+
+					/**
+					 * Move constructor.
+					 */
+					Lease(Lease&& other) noexcept
+						: m_pool(std::exchange(other.m_pool, nullptr)), m_index(other.m_index) {}
+
+					/**
+					 * Destructor. Returns the connection to the pool.
+					 */
+					~Lease() noexcept {
+						Release();
+					}
+
+					/**
+					 * Copy assignment (deleted).
+					 */
+					Lease& operator=(const Lease&) = delete;
+
+					/**
+					 * Move assignment. Returns the currently held connection first.
+					 */
+					Lease& operator=(Lease&& other) noexcept {
+						if (this != &other) {
+							Release();
+							m_pool = std::exchange(other.m_pool, nullptr);
+							m_index = other.m_index;
+						}
+						return *this;
+					}
+
+					/**
+					 * @return Leased connection.
+					 */
+					inline DB* operator->() const noexcept {
+						return Get();
+					}
+
+					/**
+					 * @return Leased connection.
+					 */
+					inline DB& operator*() const noexcept {
+						return *Get();
+					}
+
+					/**
+					 * @return Leased connection (null for an empty lease).
+					 */
+					inline DB* Get() const noexcept {
+						return m_pool ? m_pool->m_slots[m_index].db.get() : nullptr;
+					}
+
+					/**
+					 * @return true if a connection is held.
+					 */
+					inline explicit operator bool() const noexcept {
+						return m_pool != nullptr;
+					}
+
+					/**
+					 * Returns the connection to the pool early. A connection that is no
+					 * longer connected is closed instead of being reused.
+					 */
+					void Release() noexcept {
+						if (m_pool)
+							std::exchange(m_pool, nullptr)->Return(m_index);
+					}
+
+				private:
+					friend class ConnectionPool;
+
+					ConnectionPool* m_pool = nullptr;		///< Owning pool (null when empty)
+					std::size_t m_index = 0;				///< Slot index in the pool
+
+					Lease(ConnectionPool* pool, std::size_t index) noexcept
+						: m_pool(pool), m_index(index) {}
+			};
+
+			/**
+			 * @typedef ExpectedLease
+			 * @brief Checkout result: Lease or ConnectionError.
+			 */
+			using ExpectedLease = Expected<Lease, ConnectionError>;
+
+			/**
+			 * Creates the pool and opens options.min_size connections.
+			 * @param factory Builds a new, not yet connected, DB (called with no lock held).
+			 * @param options Sizing and maintenance policy.
+			 * @param check Health check for idle connections (default: IsConnected()).
+			 */
+			explicit ConnectionPool(Factory factory, PoolOptions options = {}, HealthCheck check = {})
+				: m_factory(std::move(factory)), m_check(std::move(check)), m_options(options),
+				  m_slots(std::make_unique<Slot[]>(options.max_size)) {
+				if (m_options.min_size > m_options.max_size)
+					m_options.min_size = m_options.max_size;
+				if (!m_check)
+					m_check = [](DB& db) { return db.IsConnected(); };
+				Warm();
+			}
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			ConnectionPool(const ConnectionPool&) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			ConnectionPool(ConnectionPool&&) = delete;
+
+			/**
+			 * Destructor. Closes every connection; no Lease may be outstanding.
+			 */
+			~ConnectionPool() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			ConnectionPool& operator=(ConnectionPool&&) = delete;
+
+			/**
+			 * Checks out a connection, waiting up to options.acquire_timeout.
+			 * @return Lease or an error (timeout, or the connection could not be opened).
+			 */
+			inline ExpectedLease Acquire() {
+				return Acquire(m_options.acquire_timeout);
+			}
+
+			/**
+			 * Checks out a connection.
+			 *
+			 * An idle connection is reused first; otherwise a new one is opened if
+			 * the pool is below max_size; otherwise the call waits for a release.
+			 * @param timeout Longest wait for a release.
+			 * @return Lease or an error (timeout, or the connection could not be opened).
+			 */
+			ExpectedLease Acquire(std::chrono::milliseconds timeout) {
+				const auto start = Clock::now();
+				const auto deadline = start + timeout;
+				bool waited = false;
+				for (;;) {
+					const std::uint64_t generation = m_generation.load();
+					if (auto lease = TryCheckout(start))
+						return std::move(*lease);
+
+					if (!waited) {
+						waited = true;
+						++m_waited;
+					}
+					std::unique_lock<std::mutex> lock(m_mutex);
+					++m_waiters;
+					const bool released = m_released.wait_until(lock, deadline, [&] {
+						return m_generation.load() != generation;
+					});
+					--m_waiters;
+					if (!released) {
+						++m_timeouts;
+						return Unexpected<ConnectionError>("Timed out waiting for a pooled connection");
+					}
+				}
+			}
+
+			/**
+			 * Checks out an idle connection, or opens one if below max_size, without waiting.
+			 * @return Lease, or std::nullopt if none is available right now.
+			 */
+			std::optional<Lease> TryAcquire() {
+				auto lease = TryCheckout(Clock::now());
+				if (!lease || !*lease)
+					return std::nullopt;
+				return std::move(**lease);
+			}
+
+			/**
+			 * Opens connections until options.min_size are open.
+			 * @return Connections opened.
+			 */
+			std::size_t Warm() {
+				std::size_t opened = 0;
+				while (m_size.load() < m_options.min_size) {
+					auto index = Claim(State::Empty);
+					if (!index)
+						break;
+					if (!Open(*index)) {
+						Vacate(*index);
+						break;
+					}
+					Vacate(*index, State::Idle);
+					++opened;
+				}
+				return opened;
+			}
+
+			/**
+			 * Closes connections idle longer than options.idle_timeout, keeping
+			 * options.min_size open. Also run periodically by returning leases.
+			 * @return Connections closed.
+			 */
+			std::size_t EvictIdle() {
+				if (m_options.idle_timeout.count() <= 0)
+					return 0;
+
+				const auto now = Clock::now();
+				std::size_t evicted = 0;
+				for (std::size_t i = 0; i < m_options.max_size; ++i) {
+					if (m_size.load() <= m_options.min_size)
+						break;
+					State expected = State::Idle;
+					if (!m_slots[i].state.compare_exchange_strong(expected, State::Busy))
+						continue;
+					if (now - m_slots[i].last_used >= m_options.idle_timeout) {
+						Close(i);
+						Vacate(i);
+						++evicted;
+					}
+					else
+						Vacate(i, State::Idle);
+				}
+				m_evicted += evicted;
+				return evicted;
+			}
+
+			/**
+			 * @return Snapshot of the pool counters.
+			 */
+			PoolStats Stats() const noexcept {
+				PoolStats stats;
+				stats.size = m_size.load();
+				stats.in_use = m_in_use.load();
+				stats.max_size = m_options.max_size;
+				stats.acquired = m_acquired.load();
+				stats.waited = m_waited.load();
+				stats.timeouts = m_timeouts.load();
+				stats.created = m_created.load();
+				stats.evicted = m_evicted.load();
+				stats.health_failures = m_health_failures.load();
+				stats.total_wait = std::chrono::nanoseconds{m_total_wait_ns.load()};
+				stats.max_wait = std::chrono::nanoseconds{m_max_wait_ns.load()};
+				return stats;
+			}
+
+			/**
+			 * @return Pool options.
+			 */
+			inline const PoolOptions& Options() const noexcept {
+				return m_options;
+			}
+
+		private:
+			using Clock = std::chrono::steady_clock;
+
+			/**
+			 * @enum State
+			 * @brief Slot ownership; only the thread that moved a slot to Busy touches its db.
+			 */
+			enum class State: std::uint8_t {
+				Empty,		///< No connection
+				Idle,		///< Connected, available
+				Busy		///< Leased, or being opened / checked / closed
+			};
+
+			/**
+			 * @struct Slot
+			 * @brief One pooled connection.
+			 */
+			struct Slot {
+				std::atomic<State> state{State::Empty};		///< Ownership state
+				std::unique_ptr<DB> db;						///< Connection (set while not Empty)
+				Clock::time_point last_used;				///< Time of the last release
+			};
+
+			Factory m_factory;								///< Connection factory
+			HealthCheck m_check;							///< Idle connection check
+			PoolOptions m_options;							///< Sizing and maintenance policy
+			std::unique_ptr<Slot[]> m_slots;				///< max_size slots
+
+			std::atomic<std::size_t> m_size{0};				///< Open connections
+			std::atomic<std::size_t> m_in_use{0};			///< Leased connections
+			std::atomic<std::uint64_t> m_generation{0};		///< Bumped on every slot release
+			std::atomic<std::size_t> m_waiters{0};			///< Threads blocked in Acquire()
+			std::atomic<Clock::rep> m_next_eviction{0};		///< Earliest time for the next EvictIdle() from Return()
+			std::mutex m_mutex;								///< Guards waiting only
+			std::condition_variable m_released;				///< Signalled when a slot is released
+
+			std::atomic<std::uint64_t> m_acquired{0};
+			std::atomic<std::uint64_t> m_waited{0};
+			std::atomic<std::uint64_t> m_timeouts{0};
+			std::atomic<std::uint64_t> m_created{0};
+			std::atomic<std::uint64_t> m_evicted{0};
+			std::atomic<std::uint64_t> m_health_failures{0};
+			std::atomic<std::int64_t> m_total_wait_ns{0};
+			std::atomic<std::int64_t> m_max_wait_ns{0};
+
+			/**
+			 * Lock-free checkout attempt: reuses an idle connection, else opens one in an empty slot.
+			 * @param start Time the checkout started.
+			 * @return Lease or open error, or std::nullopt if every slot is busy.
+			 */
+			std::optional<ExpectedLease> TryCheckout(Clock::time_point start) {
+				if (auto index = Claim(State::Idle)) {
+					if (CheckHealth(*index))
+						return Checkout(*index, start);
+					Close(*index);
+					++m_health_failures;
+					if (Open(*index))
+						return Checkout(*index, start);
+					Vacate(*index);
+					return Unexpected<ConnectionError>("Could not open a pooled connection");
+				}
+
+				if (auto index = Claim(State::Empty)) {
+					if (Open(*index))
+						return Checkout(*index, start);
+					Vacate(*index);
+					return Unexpected<ConnectionError>("Could not open a pooled connection");
+				}
+				return std::nullopt;
+			}
+
+			/**
+			 * Moves the first slot in @p from to Busy. Scanning from the front keeps
+			 * recently used connections hot and lets the tail go idle for eviction.
+			 * @param from Slot state to claim.
+			 * @return Claimed slot index.
+			 */
+			std::optional<std::size_t> Claim(State from) noexcept {
+				for (std::size_t i = 0; i < m_options.max_size; ++i) {
+					State expected = from;
+					if (m_slots[i].state.load(std::memory_order_relaxed) == from &&
+						m_slots[i].state.compare_exchange_strong(expected, State::Busy, std::memory_order_acquire))
+						return i;
+				}
+				return std::nullopt;
+			}
+
+			/**
+			 * Opens a connection in a claimed, empty slot.
+			 * @param index Slot index.
+			 * @return false if the factory or Connect() failed.
+			 */
+			bool Open(std::size_t index) noexcept {
+				Slot& slot = m_slots[index];
+				try {
+					slot.db = m_factory();
+				} catch (...) {
+					slot.db.reset();
+				}
+				if (!slot.db || !slot.db->Connect()) {
+					slot.db.reset();
+					return false;
+				}
+				slot.last_used = Clock::now();
+				++m_size;
+				++m_created;
+				return true;
+			}
+
+			/**
+			 * Closes the connection of a claimed slot.
+			 * @param index Slot index.
+			 */
+			void Close(std::size_t index) noexcept {
+				m_slots[index].db.reset();
+				--m_size;
+			}
+
+			/**
+			 * Runs the health check on a claimed idle slot if it is due.
+			 * @param index Slot index.
+			 * @return false if the connection must be replaced.
+			 */
+			bool CheckHealth(std::size_t index) noexcept {
+				Slot& slot = m_slots[index];
+				if (Clock::now() - slot.last_used < m_options.health_check_interval)
+					return true;
+				try {
+					return m_check(*slot.db);
+				} catch (...) {
+					return false;
+				}
+			}
+
+			/**
+			 * Hands a claimed, connected slot to a Lease and records the checkout.
+			 * @param index Slot index.
+			 * @param start Time Acquire() was called.
+			 * @return Lease.
+			 */
+			Lease Checkout(std::size_t index, Clock::time_point start) noexcept {
+				const std::int64_t wait = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+				++m_in_use;
+				++m_acquired;
+				m_total_wait_ns += wait;
+				std::int64_t max = m_max_wait_ns.load(std::memory_order_relaxed);
+				while (wait > max && !m_max_wait_ns.compare_exchange_weak(max, wait, std::memory_order_relaxed)) {}
+				return Lease(this, index);
+			}
+
+			/**
+			 * Releases a claimed slot as @p state and wakes one waiter.
+			 * @param index Slot index.
+			 * @param state Empty or Idle.
+			 */
+			void Vacate(std::size_t index, State state = State::Empty) noexcept {
+				m_slots[index].state.store(state, std::memory_order_release);
+				++m_generation;
+				if (m_waiters.load() > 0) {
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_released.notify_one();
+				}
+			}
+
+			/**
+			 * Takes back a leased slot (called by Lease).
+			 * @param index Slot index.
+			 */
+			void Return(std::size_t index) noexcept {
+				Slot& slot = m_slots[index];
+				--m_in_use;
+				if (!slot.db->IsConnected()) {
+					Close(index);
+					++m_health_failures;
+					Vacate(index);
+				}
+				else {
+					slot.last_used = Clock::now();
+					Vacate(index, State::Idle);
+				}
+
+				if (m_options.idle_timeout.count() > 0) {
+					const Clock::rep now = Clock::now().time_since_epoch().count();
+					Clock::rep next = m_next_eviction.load(std::memory_order_relaxed);
+					const Clock::rep period = std::chrono::duration_cast<Clock::duration>(m_options.idle_timeout).count();
+					if (now >= next && m_next_eviction.compare_exchange_strong(next, now + period))
+						EvictIdle();
+				}
+			}
+	};
+}
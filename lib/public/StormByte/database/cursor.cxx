@@ -0,0 +1,13 @@
+#include <StormByte/database/cursor.hxx>
+
+using namespace StormByte::Database;
+
+ExpectedRow Cursor::Next() {
+	if (!m_source)
+		return std::optional<Row>();
+
+	ExpectedRow next = m_source->Fetch();
+	if (!next || !next->has_value())
+		m_source.reset();
+	return next;
+}
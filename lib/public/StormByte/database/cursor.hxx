@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/row.hxx>
+#include <StormByte/database/typedefs.hxx>
+
+#include <memory>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class Cursor
+	 * @brief Pull-based, forward-only result stream.
+	 *
+	 * Rows are fetched from the backend one at a time (or one chunk at a time)
+	 * as Next() is called, so memory stays bounded regardless of result size
+	 * and the first row is available before the server finishes sending.
+	 *
+	 * @note The cursor borrows the connection (and, for ExecuteSTMTStream, the
+	 * prepared statement). It must not outlive its Database, and no other query
+	 * may be issued on the same connection until it is exhausted or destroyed.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Cursor {
+		public:
+			/**
+			 * @class Source
+			 * @brief Backend row producer driven by Cursor.
+			 */
+			class STORMBYTE_DATABASE_PUBLIC Source {
+				public:
+					/**
+					 * Destructor. Must release or drain any pending backend result.
+					 */
+					virtual ~Source() noexcept = default;
+
+					/**
+					 * Fetches the next row from the backend.
+					 * @return Row, std::nullopt when exhausted, or an error.
+					 */
+					virtual ExpectedRow Fetch() = 0;
+			};
+
+			/**
+			 * Empty cursor (yields no rows).
+			 */
+			Cursor() noexcept = default;
+
+			/**
+			 * @param source Backend row producer.
+			 */
+			explicit Cursor(std::unique_ptr<Source> source) noexcept
+				: m_source(std::move(source)) {}
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Cursor(const Cursor&) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			Cursor(Cursor&&) noexcept = default;
+
+			/**
+			 * Destructor. Releases the backend result if not exhausted.
+			 */
+			~Cursor() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Cursor& operator=(const Cursor&) = delete;
+
+			/**
+			 * Move assignment.
+			 */
+			Cursor& operator=(Cursor&&) noexcept = default;
+
+			/**
+			 * Fetches the next row.
+			 * @return Row, std::nullopt once the result is exhausted, or an error.
+			 * After exhaustion or an error the backend result is released and
+			 * further calls return std::nullopt.
+			 */
+			ExpectedRow Next();
+
+			/**
+			 * @return true once all rows were consumed or an error occurred.
+			 */
+			inline bool Done() const noexcept {
+				return !m_source;
+			}
+
+		private:
+			std::unique_ptr<Source> m_source;	///< Backend producer (null once done)
+	};
+}
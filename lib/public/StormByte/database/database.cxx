@@ -10,6 +10,7 @@ bool Database::Connect() noexcept {
 	bool result = DoConnect();
 	if (result) {
 		m_connected = true;
+		m_stats->SlowLog().SetExplainer(DoExplainer());
 		DoPostConnect();
 	}
 
@@ -23,6 +24,8 @@ void Database::Disconnect() noexcept {
 		*m_logger << Logger::Level::LowLevel << "Disconnect enter" << std::endl;
 
 	DoPreDisconnect();
+	m_statement_cache.Clear();
+	m_stats->SlowLog().SetExplainer({});
 	DoDisconnect();
 	DoPostDisconnect();
 	m_connected = false;
@@ -35,13 +38,129 @@ void Database::PrepareSTMT(std::string&& name, std::string&& query) noexcept {
 	DoPrepareSTMT(std::move(name), std::move(query));
 }
 
-void Database::DoPrepareSTMT(std::string&& name, std::string&& query) noexcept {
+PreparedSTMT* Database::DoPrepareSTMT(std::string&& name, std::string&& query) noexcept {
 	if (m_logger)
 		*m_logger << Logger::Level::Debug << "Preparing statement '" << name << "': " << query << std::endl;
 
 	std::unique_ptr<PreparedSTMT> prepared = CreatePreparedSTMT(std::move(name), std::move(query));
-	if (prepared)
-		m_prepared_stmts.emplace(prepared->Name(), std::move(prepared));
+	if (!prepared)
+		return nullptr;
+
+	prepared->SetResultStorage(m_result_storage);
+	prepared->SetEventLoop(m_event_loop.get());
+	prepared->SetMetrics(m_stats_enabled ? m_stats->Get(prepared->Name(), StatementKind::Prepared) : nullptr);
+	auto [it, inserted] = m_prepared_stmts.emplace(prepared->Name(), std::move(prepared));
+	return inserted ? it->second.get() : nullptr;
+}
+
+void Database::SetResultStorage(ResultStorage storage) noexcept {
+	m_result_storage = storage;
+	for (auto& [name, stmt] : m_prepared_stmts)
+		stmt->SetResultStorage(storage);
+	m_statement_cache.ForEach([storage](PreparedSTMT& stmt) { stmt.SetResultStorage(storage); });
+}
+
+void Database::SetEventLoop(std::shared_ptr<EventLoop> loop) noexcept {
+	m_event_loop = std::move(loop);
+	for (auto& [name, stmt] : m_prepared_stmts)
+		stmt->SetEventLoop(m_event_loop.get());
+	m_statement_cache.ForEach([loop = m_event_loop.get()](PreparedSTMT& stmt) { stmt.SetEventLoop(loop); });
+}
+
+void Database::SetStatsEnabled(bool enabled) noexcept {
+	m_stats_enabled = enabled;
+	for (auto& [name, stmt] : m_prepared_stmts)
+		stmt->SetMetrics(enabled ? m_stats->Get(name, StatementKind::Prepared) : nullptr);
+	m_statement_cache.ForEach([this, enabled](PreparedSTMT& stmt) {
+		stmt.SetMetrics(enabled ? m_stats->Get(stmt.Query(), StatementKind::Query) : nullptr);
+	});
+}
+
+void Database::SetSlowQueryThreshold(std::chrono::nanoseconds threshold) noexcept {
+	SlowQueryOptions options = m_stats->SlowLog().Options();
+	options.threshold = threshold;
+	m_stats->SlowLog().SetOptions(options);
+}
+
+void Database::SetStatementCacheSize(std::size_t capacity) noexcept {
+	m_statement_cache.SetCapacity(capacity);
+	TrimStatementCache();
+}
+
+PreparedSTMT* Database::CachedSTMT(const std::string& query) {
+	if (!m_connected)
+		return nullptr;
+	if (PreparedSTMT* cached = m_statement_cache.Find(query))
+		return cached;
+
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Caching statement: " << query << std::endl;
+	std::unique_ptr<PreparedSTMT> prepared = CreatePreparedSTMT("stormbyte_cached_" + std::to_string(++m_cache_serial), std::string(query));
+	if (!prepared)
+		return nullptr;
+	prepared->SetResultStorage(m_result_storage);
+	prepared->SetEventLoop(m_event_loop.get());
+	prepared->SetMetrics(m_stats_enabled ? m_stats->Get(query, StatementKind::Query) : nullptr);
+
+	while (m_statement_cache.Size() > 0 && m_statement_cache.Full())
+		DoEvictSTMT(*m_statement_cache.PopLeastRecent());
+	return m_statement_cache.Insert(query, std::move(prepared));
+}
+
+void Database::TrimStatementCache() noexcept {
+	while (m_statement_cache.Size() > m_statement_cache.Capacity())
+		DoEvictSTMT(*m_statement_cache.PopLeastRecent());
+}
+
+ExpectedRows Database::Query(const std::string& query) {
+	if (!m_stats_enabled)
+		return DoQuery(query);
+	return m_stats->Get(query, StatementKind::Query)->Measure([this, &query] { return DoQuery(query); }, query, [] { return std::vector<Value>(); });
+}
+
+Awaitable<ExpectedRows> Database::QueryAsync(const std::string& query) {
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Executing async query: " << query << std::endl;
+
+	if (!m_connected)
+		return Awaitable<ExpectedRows>(Unexpected<ExecuteError>("Database not connected"));
+	return Awaitable<ExpectedRows>(DoQueryAsync(query), m_event_loop.get());
+}
+
+ExpectedColumnarRows Database::QueryColumnar(const std::string& query) {
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Executing columnar query: " << query << std::endl;
+
+	if (!m_connected)
+		return Unexpected<ExecuteError>("Database not connected");
+	return DoQueryColumnar(query);
+}
+
+ExpectedCursor Database::QueryStream(const std::string& query) {
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Executing streaming query: " << query << std::endl;
+
+	if (!m_connected)
+		return Unexpected<ExecuteError>("Database not connected");
+	return DoQueryStream(query);
+}
+
+ExpectedBlobStream Database::ReadBlob(const BlobLocation& location) {
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Reading blob " << location.table << "." << location.column << " where " << location.key_column << " = " << location.key << std::endl;
+
+	if (!m_connected)
+		return Unexpected<ExecuteError>("Database not connected");
+	return DoOpenBlob(location, BlobMode::Read, 0);
+}
+
+ExpectedBlobStream Database::WriteBlob(const BlobLocation& location, std::uint64_t size) {
+	if (m_logger)
+		*m_logger << Logger::Level::Debug << "Writing " << size << " byte blob " << location.table << "." << location.column << " where " << location.key_column << " = " << location.key << std::endl;
+
+	if (!m_connected)
+		return Unexpected<ExecuteError>("Database not connected");
+	return DoOpenBlob(location, BlobMode::Write, size);
 }
 
 Transaction Database::BeginTransaction(IsolationLevel level) {
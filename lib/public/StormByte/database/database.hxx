@@ -19,12 +19,20 @@
 
 #pragma once
 
+#include <StormByte/database/blob_stream.hxx>
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/cursor.hxx>
 #include <StormByte/database/prepared_stmt.hxx>
 #include <StormByte/database/rows.hxx>
+#include <StormByte/database/slow_query_log.hxx>
+#include <StormByte/database/statement_cache.hxx>
+#include <StormByte/database/statement_stats.hxx>
+#include <StormByte/database/statement.hxx>
 #include <StormByte/database/transaction.hxx>
 #include <StormByte/database/typedefs.hxx>
 #include <StormByte/logger/log.hxx>
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 
@@ -54,7 +62,9 @@ namespace StormByte::Database {
 			 * @param logger Logger instance (may be null).
 			 */
 			Database(std::shared_ptr<Logger::Log> logger) noexcept
-				: m_logger(std::move(logger)), m_connected(false), m_ssl_mode(SslMode::Default) {}
+				: m_logger(std::move(logger)), m_connected(false), m_ssl_mode(SslMode::Default), m_result_storage(ResultStorage::Owned) {
+				m_stats->SlowLog().SetLogger(m_logger);
+			}
 
 			/**
 			 * Copy constructor (deleted).
@@ -116,6 +126,23 @@ namespace StormByte::Database {
 				return m_ssl_mode;
 			}
 
+			/**
+			 * Sets where Query() and ExecuteSTMT() results keep their text and blob
+			 * payloads. ResultStorage::Arena packs them into one Arena per Rows;
+			 * ResultStorage::Borrowed (PostgreSQL) keeps the backend result alive
+			 * and views it directly.
+			 * Applies to all prepared statements, including ones prepared later.
+			 * @param storage Result storage mode.
+			 */
+			void SetResultStorage(ResultStorage storage) noexcept;
+
+			/**
+			 * @return Current result storage mode.
+			 */
+			ResultStorage GetResultStorage() const noexcept {
+				return m_result_storage;
+			}
+
 			/**
 			 * Executes a prepared statement by name.
 			 * @tparam Args Argument types to bind.
@@ -132,11 +159,254 @@ namespace StormByte::Database {
 			}
 
 			/**
-			 * Executes a query and returns rows.
+			 * Executes a prepared statement by name into a columnar result.
+			 * @tparam Args Argument types to bind.
+			 * @param name Prepared statement name.
+			 * @param args Values to bind (positional, 0-based).
+			 * @return Columnar result or an error.
+			 */
+			template<typename... Args>
+			ExpectedColumnarRows ExecuteColumnar(const std::string& name, Args&&... args) {
+				auto it = m_prepared_stmts.find(name);
+				if (it == m_prepared_stmts.end())
+					return Unexpected<UnknownSTMT>(name);
+				return it->second->ExecuteColumnar(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Executes a prepared statement by name, decoding rows straight into @p T.
+			 * @tparam T std::tuple or aggregate struct; columns bind to elements / fields by position.
+			 * @tparam Args Argument types to bind.
+			 * @param name Prepared statement name.
+			 * @param args Values to bind (positional, 0-based).
+			 * @return Decoded rows or an error.
+			 */
+			template<typename T, typename... Args>
+			ExpectedVector<T> ExecuteSTMTAs(const std::string& name, Args&&... args) {
+				auto it = m_prepared_stmts.find(name);
+				if (it == m_prepared_stmts.end())
+					return Unexpected<UnknownSTMT>(name);
+				return it->second->ExecuteAs<T>(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Executes a prepared statement by name once per row of @p rows.
+			 * @tparam R Range of tuple-like rows (std::tuple, std::pair, std::array).
+			 * @param name Prepared statement name.
+			 * @param rows Bind values, one tuple per execution.
+			 * @return Affected row counts, or the first failure (BatchError).
+			 * @see PreparedSTMT::ExecuteBatch
+			 */
+			template<std::ranges::input_range R>
+			ExpectedBatch ExecuteBatch(const std::string& name, const R& rows) {
+				auto it = m_prepared_stmts.find(name);
+				if (it == m_prepared_stmts.end())
+					return Unexpected<UnknownSTMT>(name);
+				return it->second->ExecuteBatch(rows);
+			}
+
+			/**
+			 * Executes a prepared statement by name without blocking the caller.
+			 * @tparam Args Argument types to bind.
+			 * @param name Prepared statement name.
+			 * @param args Values to bind (positional, 0-based).
+			 * @return Awaitable yielding the result rows or an error.
+			 * @see PreparedSTMT::ExecuteAsync
+			 */
+			template<typename... Args>
+			Awaitable<ExpectedRows> ExecuteAsync(const std::string& name, Args&&... args) {
+				auto it = m_prepared_stmts.find(name);
+				if (it == m_prepared_stmts.end())
+					return Awaitable<ExpectedRows>(Unexpected<UnknownSTMT>(name));
+				return it->second->ExecuteAsync(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Executes a prepared statement by name, streaming its rows.
+			 * @tparam Args Argument types to bind.
+			 * @param name Prepared statement name.
+			 * @param args Values to bind (positional, 0-based).
+			 * @return Cursor over the result rows or an error.
+			 * @see Cursor for lifetime rules.
+			 */
+			template<typename... Args>
+			ExpectedCursor ExecuteSTMTStream(const std::string& name, Args&&... args) {
+				auto it = m_prepared_stmts.find(name);
+				if (it == m_prepared_stmts.end())
+					return Unexpected<UnknownSTMT>(name);
+				return it->second->ExecuteStream(std::forward<Args>(args)...);
+			}
+
+			/**
+			 * Executes a query and returns rows. Recorded in Stats() under the SQL text.
 			 * @param query SQL text.
 			 * @return Result rows or an error.
 			 */
-			virtual ExpectedRows Query(const std::string& query) = 0;
+			ExpectedRows Query(const std::string& query);
+
+			/**
+			 * Executes a parameterized query through the statement cache.
+			 *
+			 * The first call with a given SQL text prepares a native statement
+			 * (sqlite3_stmt, server-side Postgres statement, MYSQL_STMT); later calls
+			 * with the same text reuse it until it is evicted. Placeholders are the
+			 * backend's own (? / $1).
+			 * @tparam Args Argument types to bind.
+			 * @param query SQL text (single statement).
+			 * @param args Values to bind (positional, 0-based).
+			 * @return Result rows or an error.
+			 * @see SetStatementCacheSize
+			 */
+			template<typename... Args>
+			requires (sizeof...(Args) > 0)
+			ExpectedRows Query(const std::string& query, Args&&... args) {
+				PreparedSTMT* stmt = CachedSTMT(query);
+				if (!stmt)
+					return Unexpected<ExecuteError>(m_connected ? "Failed to prepare query: " + query : "Database not connected");
+				ExpectedRows result = stmt->Execute(std::forward<Args>(args)...);
+				TrimStatementCache();
+				return result;
+			}
+
+			/**
+			 * Sets how many statements Query(query, args...) keeps prepared,
+			 * evicting the least recently used ones beyond it. 0 prepares and
+			 * releases a statement on every call. Defaults to 128.
+			 * @param capacity Maximum cached statements.
+			 */
+			void SetStatementCacheSize(std::size_t capacity) noexcept;
+
+			/**
+			 * @return Statement cache size, capacity and hit / miss / eviction counters.
+			 */
+			StatementCacheStats CacheStats() const noexcept {
+				return m_statement_cache.Stats();
+			}
+
+			/**
+			 * Enables or disables per-statement statistics (enabled by default).
+			 * Applies to prepared statements and Query(), including ones prepared
+			 * later; recorded counters are kept.
+			 * @param enabled Whether to record.
+			 */
+			void SetStatsEnabled(bool enabled) noexcept;
+
+			/**
+			 * @return true if per-statement statistics are recorded.
+			 */
+			bool StatsEnabled() const noexcept {
+				return m_stats_enabled;
+			}
+
+			/**
+			 * Snapshot of the per-statement statistics: calls, errors, rows,
+			 * decoded bytes and execute / decode latency histograms of every named
+			 * prepared statement (Execute(), ExecuteSTMT(), Statement handles) and
+			 * of every Query() SQL text. Safe to call from another thread.
+			 * @return Statistics; render them with DatabaseStats::ToPrometheus() or ToJson().
+			 */
+			DatabaseStats Stats() const {
+				return m_stats->Snapshot();
+			}
+
+			/**
+			 * Clears every per-statement counter.
+			 */
+			void ResetStats() noexcept {
+				m_stats->Reset();
+			}
+
+			/**
+			 * Logs every execution of a prepared statement or Query() taking at
+			 * least @p threshold, with its SQL, parameters and duration, at
+			 * Logger::Level::Warning. Other slow query log options are kept.
+			 * Relies on the statistics timings, so nothing is reported while
+			 * they are disabled (SetStatsEnabled()).
+			 * @param threshold Minimum duration reported (0 disables the log, the default).
+			 * @see SetSlowQueryOptions
+			 */
+			void SetSlowQueryThreshold(std::chrono::nanoseconds threshold) noexcept;
+
+			/**
+			 * Sets the slow query log threshold and plan capture. Reports of
+			 * successful executions include the backend's plan for the same SQL
+			 * and parameters (SQLite EXPLAIN QUERY PLAN, PostgreSQL EXPLAIN
+			 * (FORMAT JSON), MariaDB EXPLAIN FORMAT=JSON), captured on this
+			 * connection right after the statement and at most once per
+			 * SlowQueryOptions::plan_interval; the statement is not executed again.
+			 * @param options Slow query log options.
+			 */
+			void SetSlowQueryOptions(const SlowQueryOptions& options) noexcept {
+				m_stats->SlowLog().SetOptions(options);
+			}
+
+			/**
+			 * @return Slow query log options.
+			 */
+			const SlowQueryOptions& SlowQueryLogOptions() const noexcept {
+				return m_stats->SlowLog().Options();
+			}
+
+			/**
+			 * @return Slow executions reported and plans captured, skipped or failed.
+			 */
+			SlowQueryStats SlowQueries() const noexcept {
+				return m_stats->SlowLog().Stats();
+			}
+
+			/**
+			 * Executes a query into a columnar result.
+			 * @param query SQL text (single statement).
+			 * @return Columnar result or an error.
+			 */
+			ExpectedColumnarRows QueryColumnar(const std::string& query);
+
+			/**
+			 * Executes a query, streaming its rows instead of materializing them.
+			 * @param query SQL text (single statement).
+			 * @return Cursor over the result rows or an error.
+			 * @see Cursor for lifetime rules.
+			 */
+			ExpectedCursor QueryStream(const std::string& query);
+
+			/**
+			 * Executes a query without blocking the caller.
+			 *
+			 * PostgreSQL and MariaDB send it on their non-blocking API and the
+			 * awaiting coroutine is resumed by the EventLoop when the reply has
+			 * arrived; SQLite runs it on the connection's executor thread. Only one
+			 * operation may be in flight per connection.
+			 * @param query SQL text.
+			 * @return Awaitable yielding the result rows or an error.
+			 * @see Awaitable
+			 */
+			Awaitable<ExpectedRows> QueryAsync(const std::string& query);
+
+			/**
+			 * Opens a blob cell for reading in chunks.
+			 * @param location Table, column and row of the value.
+			 * @return Stream over the value or an error (no such row, NULL value, ...).
+			 * @see BlobStream for lifetime rules.
+			 */
+			ExpectedBlobStream ReadBlob(const BlobLocation& location);
+
+			/**
+			 * Opens a blob cell for replacing its value with @p size bytes written
+			 * in chunks. The new value is applied by BlobStream::Close() once all
+			 * bytes were written. Only one write stream can be open per connection.
+			 * @param location Table, column and row of the value (the row must exist).
+			 * @param size Size of the new value in bytes.
+			 * @return Stream accepting the value or an error.
+			 * @see BlobStream for lifetime rules.
+			 */
+			ExpectedBlobStream WriteBlob(const BlobLocation& location, std::uint64_t size);
+
+			/**
+			 * Sets the loop driving QueryAsync() / ExecuteAsync() on network backends,
+			 * including statements prepared later. Not used by SQLite.
+			 * @param loop Event loop (nullptr: EventLoop::Default()).
+			 */
+			void SetEventLoop(std::shared_ptr<EventLoop> loop) noexcept;
 
 			/**
 			 * Executes a query that does not return rows.
@@ -169,6 +439,12 @@ namespace StormByte::Database {
 			std::unordered_map<std::string, std::unique_ptr<PreparedSTMT>> m_prepared_stmts; ///< Named prepared statements
 			bool m_connected; ///< Connection state
 			SslMode m_ssl_mode; ///< TLS policy for network backends
+			ResultStorage m_result_storage; ///< Payload storage for Query() / ExecuteSTMT()
+			std::shared_ptr<EventLoop> m_event_loop; ///< Loop for async calls (null: default)
+			StatementCache m_statement_cache; ///< Statements behind Query(query, args...)
+			std::uint64_t m_cache_serial = 0; ///< Names cached statements uniquely
+			std::unique_ptr<StatsRegistry> m_stats = std::make_unique<StatsRegistry>(); ///< Per-statement statistics
+			bool m_stats_enabled = true; ///< Whether statements record into m_stats
 
 			/**
 			 * @name Lifecycle hooks
@@ -208,6 +484,16 @@ namespace StormByte::Database {
 			 */
 			virtual void DoPostDisconnect() noexcept {}
 
+			/**
+			 * Called before a statement evicted from the statement cache is
+			 * destroyed, while still connected. Backends whose statements live on
+			 * the server (PostgreSQL) release them here. Default no-op.
+			 * @param stmt Evicted statement.
+			 */
+			virtual void DoEvictSTMT(PreparedSTMT& stmt) noexcept {
+				(void)stmt;
+			}
+
 			/** @} */
 
 			/**
@@ -229,8 +515,26 @@ namespace StormByte::Database {
 			 * Same as PrepareSTMT; kept for symmetry with hooks.
 			 * @param name Statement name.
 			 * @param query SQL text.
+			 * @return Registered statement, or nullptr on failure or if @p name is taken.
+			 */
+			PreparedSTMT* DoPrepareSTMT(std::string&& name, std::string&& query) noexcept;
+
+			/**
+			 * Registers a prepared statement and returns a typed handle to it.
+			 *
+			 * The statement stays reachable by name through ExecuteSTMT(); the
+			 * handle executes it directly (see Statement). Keep handles as members
+			 * and recreate them in DoPostConnect(), as a disconnect invalidates them.
+			 * @tparam Args Parameter types, in placeholder order.
+			 * @param name Statement name.
+			 * @param query SQL text.
+			 * @return Handle (not valid on failure).
 			 */
-			void DoPrepareSTMT(std::string&& name, std::string&& query) noexcept;
+			template<typename... Args>
+			Statement<Args...> DoPrepareSTMT(std::string&& name, std::string&& query) noexcept {
+				PreparedSTMT* stmt = DoPrepareSTMT(std::move(name), std::move(query));
+				return Statement<Args...>(stmt);
+			}
 
 			/**
 			 * Backend-specific BEGIN with isolation level.
@@ -238,11 +542,71 @@ namespace StormByte::Database {
 			 */
 			virtual void DoBeginTransaction(IsolationLevel level) = 0;
 
+			/**
+			 * Backend-specific query.
+			 * @param query SQL text.
+			 * @return Result rows or an error.
+			 */
+			virtual ExpectedRows DoQuery(const std::string& query) = 0;
+
+			/**
+			 * Backend-specific columnar query.
+			 * @param query SQL text.
+			 * @return Columnar result or an error.
+			 */
+			virtual ExpectedColumnarRows DoQueryColumnar(const std::string& query) = 0;
+
+			/**
+			 * Backend-specific streaming query.
+			 * @param query SQL text.
+			 * @return Cursor over the result rows or an error.
+			 */
+			virtual ExpectedCursor DoQueryStream(const std::string& query) = 0;
+
+			/**
+			 * Backend-specific non-blocking query.
+			 * @param query SQL text.
+			 * @return Operation (not started yet).
+			 */
+			virtual std::unique_ptr<AsyncResult<ExpectedRows>> DoQueryAsync(const std::string& query) = 0;
+
+			/**
+			 * Backend-specific blob stream.
+			 * @param location Table, column and row of the value.
+			 * @param mode Stream direction.
+			 * @param size Size of the new value (BlobMode::Write only).
+			 * @return Stream or an error.
+			 */
+			virtual ExpectedBlobStream DoOpenBlob(const BlobLocation& location, BlobMode mode, std::uint64_t size) = 0;
+
+			/**
+			 * Builds the slow query log's plan source for the open connection.
+			 * Called after every successful DoConnect(); the explainer is dropped
+			 * before DoDisconnect(). It must capture the native handle, not this
+			 * object, and leave the session (and any open transaction) as it was.
+			 * @return Explainer (empty: plans are not captured).
+			 */
+			virtual SlowQueryLog::Explainer DoExplainer() noexcept = 0;
+
 			/**
 			 * Backend-specific silent query.
 			 * @param query SQL text.
 			 * @return true on success.
 			 */
 			virtual bool DoSilentQuery(const std::string& query) noexcept = 0;
+
+		private:
+			/**
+			 * Finds or prepares the cached statement for @p query, evicting the
+			 * least recently used one if the cache is full.
+			 * @param query SQL text.
+			 * @return Statement, nullptr if not connected or preparation failed.
+			 */
+			PreparedSTMT* CachedSTMT(const std::string& query);
+
+			/**
+			 * Evicts statements beyond the cache capacity.
+			 */
+			void TrimStatementCache() noexcept;
 	};
 }
@@ -22,6 +22,8 @@
 #include <StormByte/exception.hxx>
 #include <StormByte/database/visibility.h>
 
+#include <cstddef>
+
 /**
  * @namespace Database
  * @brief Contains classes and functions for database operations.
@@ -166,4 +168,42 @@ namespace StormByte::Database {
 
 			using QueryException::QueryException;
 	};
+
+	/**
+	 * @class BatchError
+	 * @brief Exception when a row of ExecuteBatch() fails.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC BatchError final: public QueryException {
+		public:
+			/**
+			 * @param index Index of the failing row in the batch.
+			 * @param error Backend error message.
+			 */
+			BatchError(std::size_t index, const std::string& error):
+			QueryException("Batch: ", "Error executing row {}: {}", index, error), m_index(index) {}
+
+			/**
+			 * @brief Tag selecting the whole-batch constructor.
+			 */
+			struct WholeBatch {};
+
+			/**
+			 * @brief Failure reported for the batch as a whole (Index() is the batch size).
+			 * @param size Number of rows in the batch.
+			 * @param error Backend error message.
+			 */
+			BatchError(WholeBatch, std::size_t size, const std::string& error):
+			QueryException("Batch: ", "Batch of {} rows failed: {}", size, error), m_index(size) {}
+
+			/**
+			 * @return Index of the failing row, or the batch size when the backend
+			 * only reports a failure of the batch as a whole (MariaDB array execution).
+			 */
+			inline std::size_t Index() const noexcept {
+				return m_index;
+			}
+
+		private:
+			std::size_t m_index;	///< Failing row
+	};
 }
@@ -19,24 +19,41 @@
 
 #pragma once
 
+#include <StormByte/database/async.hxx>
+#include <StormByte/database/batch_result.hxx>
+#include <StormByte/database/columnar_rows.hxx>
+#include <StormByte/database/cursor.hxx>
+#include <StormByte/database/row_reader.hxx>
 #include <StormByte/database/rows.hxx>
+#include <StormByte/database/statement_stats.hxx>
 #include <StormByte/database/value.hxx>
 #include <StormByte/logger/log.hxx>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 /**
  * @namespace Database
  * @brief Contains classes and functions for database operations.
  */
 namespace StormByte::Database {
+	template<typename... Args> class Statement;
+
 	/**
 	 * @class PreparedSTMT
 	 * @brief Abstract prepared statement (backend-specific subclasses).
 	 */
 	class STORMBYTE_DATABASE_PUBLIC PreparedSTMT {
+		template<typename... Args> friend class Statement;
 		public:
 			/**
 			 * @param name Statement name.
@@ -90,7 +107,116 @@ namespace StormByte::Database {
 				Reset();
 				std::size_t idx = 0;
 				(void)((Bind(static_cast<int>(idx++), std::forward<Args>(args))), ...);
-				ExpectedRows result = DoExecute();
+				ExpectedRows result = m_metrics
+					? m_metrics->Measure([this] { return DoExecute(); }, m_query, [&] { return std::vector<Value>{SlowQueryLog::Parameter(args)...}; })
+					: DoExecute();
+				Reset();
+				return result;
+			}
+
+			/**
+			 * Binds arguments and executes the statement into a columnar result.
+			 * @tparam Args Argument types.
+			 * @param args Positional bind values (0-based).
+			 * @return Columnar result or an error.
+			 */
+			template<typename... Args>
+			ExpectedColumnarRows ExecuteColumnar(Args&&... args) {
+				Reset();
+				std::size_t idx = 0;
+				(void)((Bind(static_cast<int>(idx++), std::forward<Args>(args))), ...);
+				ExpectedColumnarRows result = DoExecuteColumnar();
+				Reset();
+				return result;
+			}
+
+			/**
+			 * Binds arguments and executes the statement, streaming its rows.
+			 *
+			 * The statement stays busy until the returned Cursor is exhausted or
+			 * destroyed; it is reset by the cursor, not here.
+			 * @tparam Args Argument types.
+			 * @param args Positional bind values (0-based).
+			 * @return Cursor over the result rows or an error.
+			 */
+			template<typename... Args>
+			ExpectedCursor ExecuteStream(Args&&... args) {
+				Reset();
+				std::size_t idx = 0;
+				(void)((Bind(static_cast<int>(idx++), std::forward<Args>(args))), ...);
+				return DoExecuteStream();
+			}
+
+			/**
+			 * Binds arguments and executes the statement without blocking the caller.
+			 *
+			 * Only one operation may be in flight per connection: do not use the
+			 * statement or its Database until the awaitable has completed.
+			 * @tparam Args Argument types.
+			 * @param args Positional bind values (0-based), used until the co_await completes.
+			 * @return Awaitable yielding the result rows or an error.
+			 * @see Awaitable
+			 */
+			template<typename... Args>
+			Awaitable<ExpectedRows> ExecuteAsync(Args&&... args) {
+				Reset();
+				std::size_t idx = 0;
+				(void)((Bind(static_cast<int>(idx++), std::forward<Args>(args))), ...);
+				return Awaitable<ExpectedRows>(DoExecuteAsync(), m_event_loop);
+			}
+
+			/**
+			 * Binds arguments, executes the statement and decodes every row straight
+			 * into @p T, bound to the result columns by position. No Value or Row is built.
+			 * @tparam T std::tuple or aggregate struct (see RowDecoder / CellDecoder).
+			 * @tparam Args Argument types.
+			 * @param args Positional bind values (0-based).
+			 * @return Decoded rows or an error (also on NULL into a non-optional field).
+			 */
+			template<typename T, typename... Args>
+			ExpectedVector<T> ExecuteAs(Args&&... args) {
+				Reset();
+				std::size_t idx = 0;
+				(void)((Bind(static_cast<int>(idx++), std::forward<Args>(args))), ...);
+				ExpectedVector<T> result = ReadAll<T>(DoExecuteReader());
+				Reset();
+				return result;
+			}
+
+			/**
+			 * Executes the statement once per element of @p rows, binding the
+			 * element's fields positionally.
+			 *
+			 * Rows go through the native statement without building a Value per
+			 * cell and without a round trip each: SQLite steps them inside one
+			 * implicit transaction, PostgreSQL pipelines them up to a single sync
+			 * and MariaDB sends them as one array execution. A failure stops the
+			 * batch and, outside an explicit transaction, rolls it back.
+			 * @tparam R Range of tuple-like rows (std::tuple, std::pair, std::array).
+			 * @param rows Rows to execute.
+			 * @return Affected row counts, or the first failure (BatchError).
+			 */
+			template<std::ranges::input_range R>
+			ExpectedBatch ExecuteBatch(const R& rows) {
+				Reset();
+				ExpectedBatch result = BatchResult{};
+				if (auto begun = DoBeginBatch(); !begun) {
+					Reset();
+					return Unexpected(begun.error());
+				}
+				for (const auto& row : rows) {
+					std::apply([this](const auto&... args) {
+						int index = 0;
+						(BindNative(index++, args), ...);
+					}, row);
+					auto queued = DoBatchRow(*result);
+					if (!queued) {
+						result = Unexpected(queued.error());
+						break;
+					}
+					++result->rows;
+				}
+				result = DoEndBatch(std::move(result));
 				Reset();
 				return result;
 			}
@@ -109,13 +235,48 @@ namespace StormByte::Database {
 				return m_query;
 			}
 
+			/**
+			 * Sets where Execute() results keep their text and blob payloads.
+			 * @param storage Result storage mode.
+			 */
+			inline void SetResultStorage(ResultStorage storage) noexcept {
+				m_result_storage = storage;
+			}
+
+			/**
+			 * Sets where Execute() records its calls, rows and timings.
+			 * @param metrics Counters (nullptr: not recorded).
+			 */
+			inline void SetMetrics(StatementMetrics* metrics) noexcept {
+				m_metrics = metrics;
+			}
+
+			/**
+			 * Sets the loop driving ExecuteAsync() on network backends.
+			 * @param loop Event loop (nullptr: EventLoop::Default()).
+			 */
+			inline void SetEventLoop(EventLoop* loop) noexcept {
+				m_event_loop = loop;
+			}
+
 		protected:
 			std::string m_name;							///< Statement name
 			std::string m_query;						///< SQL text
 			std::shared_ptr<Logger::Log> m_logger;		///< Logger instance
+			ResultStorage m_result_storage = ResultStorage::Owned;	///< Payload storage for Execute()
+			EventLoop* m_event_loop = nullptr;			///< Loop for ExecuteAsync() (null: default)
+			StatementMetrics* m_metrics = nullptr;		///< Counters of Execute() (null: not recorded)
 
 			/**
 			 * Binds a value at @p index.
+			 *
+			 * std::string_view and std::span<const std::byte> arguments become
+			 * non-owning Values that backends bind in place (SQLITE_STATIC, a
+			 * MYSQL_BIND pointer, a libpq parameter pointer): nothing is copied,
+			 * and the viewed buffer must stay valid until the statement has run
+			 * (for ExecuteStream() / ExecuteAsync(), until the cursor is done or
+			 * the co_await completes). Other text and blob arguments are copied,
+			 * except long std::string / std::vector rvalues, which are adopted.
 			 * @tparam T Value type.
 			 * @param index Parameter index (0-based).
 			 * @param value Value to bind.
@@ -133,6 +294,37 @@ namespace StormByte::Database {
 				Binder(index, Value());
 			}
 
+			/**
+			 * Binds @p value at @p index through the native binder matching its type.
+			 * @tparam T bool, integral, floating point, text, blob, std::nullptr_t or std::optional of those.
+			 * @param index Parameter index (0-based).
+			 * @param value Value to bind (viewed, not copied, where the backend allows).
+			 */
+			template<typename T>
+			void BindNative(int index, const T& value) noexcept {
+				using U = std::remove_cvref_t<T>;
+				if constexpr (std::is_same_v<U, std::nullptr_t>)
+					BindNull(index);
+				else if constexpr (std::is_same_v<U, bool>)
+					BindBool(index, value);
+				else if constexpr (std::is_integral_v<U>)
+					BindInt64(index, static_cast<std::int64_t>(value));
+				else if constexpr (std::is_floating_point_v<U>)
+					BindDouble(index, static_cast<double>(value));
+				else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+					BindText(index, std::string_view(value));
+				else if constexpr (std::is_convertible_v<const U&, std::span<const std::byte>>)
+					BindBlob(index, std::span<const std::byte>(value));
+				else if constexpr (requires { value.has_value(); *value; }) {
+					if (value.has_value())
+						BindNative(index, *value);
+					else
+						BindNull(index);
+				}
+				else
+					static_assert(sizeof(U) == 0, "Unsupported native bind type");
+			}
+
 		private:
 			/**
 			 * Backend bind implementation.
@@ -141,6 +333,59 @@ namespace StormByte::Database {
 			 */
 			virtual void Binder(const int& index, Value&& value) noexcept = 0;
 
+			/**
+			 * @name Native binders
+			 * Typed binds used by Statement<Args...>, bypassing Value. Payload views
+			 * must stay valid until the statement has executed. The defaults wrap
+			 * the argument in a Value and call Binder().
+			 * @{
+			 */
+			virtual void BindInt64(int index, std::int64_t value) noexcept {
+				Binder(index, Value(static_cast<long int>(value)));
+			}
+
+			virtual void BindDouble(int index, double value) noexcept {
+				Binder(index, Value(value));
+			}
+
+			virtual void BindBool(int index, bool value) noexcept {
+				Binder(index, Value(value));
+			}
+
+			virtual void BindText(int index, std::string_view value) noexcept {
+				Binder(index, Value(value));
+			}
+
+			virtual void BindBlob(int index, std::span<const std::byte> value) noexcept {
+				Binder(index, Value(value));
+			}
+
+			virtual void BindNull(int index) noexcept {
+				Binder(index, Value());
+			}
+			/** @} */
+
+			/**
+			 * Starts ExecuteBatch() (implicit transaction, pipeline mode, ...).
+			 * @return Error if the batch cannot start.
+			 */
+			virtual Expected<void, QueryException> DoBeginBatch() = 0;
+
+			/**
+			 * Executes or queues the currently bound batch row and clears its bindings.
+			 * @param result Batch result to append affected counts to.
+			 * @return BatchError for a failing row.
+			 */
+			virtual Expected<void, QueryException> DoBatchRow(BatchResult& result) = 0;
+
+			/**
+			 * Finishes ExecuteBatch(): collects outstanding results, then commits
+			 * or rolls back.
+			 * @param result Result so far (an error if a row already failed).
+			 * @return Final result.
+			 */
+			virtual ExpectedBatch DoEndBatch(ExpectedBatch&& result) = 0;
+
 			/**
 			 * Resets bindings / statement state.
 			 */
@@ -151,5 +396,30 @@ namespace StormByte::Database {
 			 * @return Result rows or an error.
 			 */
 			virtual ExpectedRows DoExecute() = 0;
+
+			/**
+			 * Creates the non-blocking execution of the bound statement. The
+			 * operation consumes the bindings and resets the statement itself.
+			 * @return Operation (not started yet).
+			 */
+			virtual std::unique_ptr<AsyncResult<ExpectedRows>> DoExecuteAsync() = 0;
+
+			/**
+			 * Executes the prepared statement without materializing its result.
+			 * @return Cursor over the result rows or an error.
+			 */
+			virtual ExpectedCursor DoExecuteStream() = 0;
+
+			/**
+			 * Executes the prepared statement, decoding straight into columns.
+			 * @return Columnar result or an error.
+			 */
+			virtual ExpectedColumnarRows DoExecuteColumnar() = 0;
+
+			/**
+			 * Executes the prepared statement and exposes its result positionally.
+			 * @return Reader (null if the statement returns no result set) or an error.
+			 */
+			virtual ExpectedRowReader DoExecuteReader() = 0;
 	};
 }
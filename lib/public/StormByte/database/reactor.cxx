@@ -0,0 +1,318 @@
+#include <StormByte/database/poller.hxx>
+#include <StormByte/database/reactor.hxx>
+
+#include <algorithm>
+#include <climits>
+#include <coroutine>
+#include <exception>
+#include <optional>
+
+using namespace StormByte::Database;
+
+namespace {
+	/**
+	 * @struct DetachedTask
+	 * @brief Coroutine type of Drive(): starts eagerly and frees itself at the end.
+	 */
+	struct DetachedTask {
+		struct promise_type {
+			DetachedTask get_return_object() noexcept { return {}; }
+			std::suspend_never initial_suspend() noexcept { return {}; }
+			std::suspend_never final_suspend() noexcept { return {}; }
+			void return_void() noexcept {}
+			void unhandled_exception() noexcept { std::terminate(); }
+		};
+	};
+
+	/**
+	 * Starts a queued job on its connection and hands the result to @p finish.
+	 * The job lives in the coroutine frame, so its bound arguments outlive the
+	 * co_await.
+	 */
+	template<typename Job, typename Finish>
+	DetachedTask Drive(Job job, Database& db, Finish finish) {
+		ExpectedRows result = co_await job.start(db);
+		finish(std::move(job), std::move(result));
+	}
+}
+
+/**
+ * @class Reactor::QueuedOperation
+ * @brief Operation returned by Reactor::QueryAsync() / ExecuteAsync().
+ *
+ * Reports AsyncStatus::Offloaded so that awaiting it queues the job on its
+ * connection; the reactor completes it once the job's result is known.
+ */
+class Reactor::QueuedOperation final: public AsyncResult<ExpectedRows> {
+	public:
+		QueuedOperation(Reactor& reactor, ConnectionId id, Factory start)
+			: m_reactor(reactor), m_id(id), m_start(std::move(start)) {}
+
+		AsyncStatus Start() override {
+			return AsyncStatus::Offloaded;
+		}
+
+		void Offload(std::function<void()> done) override {
+			m_done = std::move(done);
+			m_reactor.Enqueue(m_id, Job{std::move(m_start), this, Clock::now()});
+		}
+
+		ExpectedRows Result() override {
+			return std::move(*m_result);
+		}
+
+		void Complete(ExpectedRows result) {
+			m_result = std::move(result);
+			auto done = std::move(m_done);
+			done();
+		}
+
+	private:
+		Reactor& m_reactor;							///< Owning reactor
+		ConnectionId m_id;							///< Target connection
+		Factory m_start;							///< Moved into the Job on Offload()
+		std::function<void()> m_done;				///< Resumes the awaiting coroutine
+		std::optional<ExpectedRows> m_result;		///< Result once complete
+};
+
+Reactor::Reactor()
+	: m_poller(std::make_unique<Poller>()) {}
+
+Reactor::~Reactor() noexcept {
+	// Connections reference this reactor as their loop: close them first
+	m_slots.clear();
+}
+
+Reactor::ConnectionId Reactor::Add(std::unique_ptr<Database> db) {
+	// Non-owning: the reactor outlives the connections it owns
+	db->SetEventLoop(std::shared_ptr<EventLoop>(std::shared_ptr<EventLoop>(), this));
+	auto slot = std::make_unique<Slot>();
+	slot->db = std::move(db);
+	std::lock_guard lock(m_mutex);
+	const ConnectionId id = m_slots.size();
+	slot->id = id;
+	m_slots.push_back(std::move(slot));
+	return id;
+}
+
+Database& Reactor::Connection(ConnectionId id) {
+	std::lock_guard lock(m_mutex);
+	return *m_slots.at(id)->db;
+}
+
+std::size_t Reactor::Size() const {
+	std::lock_guard lock(m_mutex);
+	return m_slots.size();
+}
+
+Awaitable<ExpectedRows> Reactor::QueryAsync(ConnectionId id, std::string query) {
+	return Submit(id, [query = std::move(query)](Database& db) {
+		return db.QueryAsync(query);
+	});
+}
+
+Awaitable<ExpectedRows> Reactor::Submit(ConnectionId id, Factory start) {
+	if (id >= Size())
+		return Awaitable<ExpectedRows>(Unexpected<ExecuteError>("Unknown reactor connection " + std::to_string(id)));
+	return Awaitable<ExpectedRows>(std::make_unique<QueuedOperation>(*this, id, std::move(start)), this);
+}
+
+void Reactor::Enqueue(ConnectionId id, Job job) {
+	{
+		std::lock_guard lock(m_mutex);
+		Slot& slot = *m_slots[id];
+		slot.queue.push_back(std::move(job));
+		if (!slot.stats.in_flight && slot.queue.size() == 1)
+			m_ready.push_back(id);
+	}
+	m_poller->Wake();
+}
+
+std::size_t Reactor::Dispatch() {
+	std::vector<std::pair<Slot*, Job>> starting;
+	{
+		std::lock_guard lock(m_mutex);
+		for (ConnectionId id : m_ready) {
+			Slot& slot = *m_slots[id];
+			if (slot.stats.in_flight || slot.queue.empty())
+				continue;
+			slot.stats.in_flight = true;
+			starting.emplace_back(&slot, std::move(slot.queue.front()));
+			slot.queue.pop_front();
+		}
+		m_ready.clear();
+	}
+	for (auto& [slot, job] : starting) {
+		Drive(std::move(job), *slot->db, [this, slot](Job job, ExpectedRows result) {
+			Finish(*slot, std::move(job), std::move(result));
+		});
+	}
+	return starting.size();
+}
+
+void Reactor::Finish(Slot& slot, Job job, ExpectedRows result) {
+	{
+		std::unique_lock lock(m_mutex);
+		if (m_thread != std::this_thread::get_id()) {
+			// Offloaded backends (SQLite) finish on their own thread: hop back
+			auto pending = std::make_shared<std::pair<Job, ExpectedRows>>(std::move(job), std::move(result));
+			m_posted.push_back([this, &slot, pending] {
+				Finish(slot, std::move(pending->first), std::move(pending->second));
+			});
+			lock.unlock();
+			m_poller->Wake();
+			return;
+		}
+
+		const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - job.submitted);
+		ReactorStats& stats = slot.stats;
+		stats.in_flight = false;
+		stats.completed++;
+		if (!result)
+			stats.failed++;
+		stats.total_latency += latency;
+		stats.last_latency = latency;
+		stats.max_latency = std::max(stats.max_latency, latency);
+		if (!slot.queue.empty())
+			m_ready.push_back(slot.id);
+	}
+	job.operation->Complete(std::move(result));
+}
+
+void Reactor::Watch(AsyncOperation& operation, AsyncStatus status, std::function<void()> done) {
+	{
+		std::lock_guard lock(m_mutex);
+		m_incoming.push_back({&operation, status, std::move(done)});
+	}
+	m_poller->Wake();
+}
+
+bool Reactor::Register(Watcher& watcher) {
+	const std::intptr_t fd = watcher.operation->Handle();
+	if (m_watchers.contains(fd) || !m_poller->Add(fd, watcher.status == AsyncStatus::WantWrite))
+		return false;
+	m_watchers.emplace(fd, std::move(watcher));
+	return true;
+}
+
+Reactor::TimerId Reactor::After(std::chrono::milliseconds delay, std::function<void()> callback) {
+	TimerId timer;
+	{
+		std::lock_guard lock(m_mutex);
+		timer = m_next_timer++;
+		const auto deadline = Clock::now() + delay;
+		m_timers.emplace(std::make_pair(deadline, timer), std::move(callback));
+		m_deadlines.emplace(timer, deadline);
+	}
+	m_poller->Wake();
+	return timer;
+}
+
+bool Reactor::Cancel(TimerId timer) {
+	std::lock_guard lock(m_mutex);
+	auto it = m_deadlines.find(timer);
+	if (it == m_deadlines.end())
+		return false;
+	m_timers.erase(std::make_pair(it->second, timer));
+	m_deadlines.erase(it);
+	return true;
+}
+
+void Reactor::Post(std::function<void()> callback) {
+	{
+		std::lock_guard lock(m_mutex);
+		m_posted.push_back(std::move(callback));
+	}
+	m_poller->Wake();
+}
+
+std::size_t Reactor::RunOnce(std::chrono::milliseconds timeout) {
+	std::vector<Watcher> incoming;
+	int wait = timeout.count() < 0 ? -1 : static_cast<int>(std::min<std::chrono::milliseconds::rep>(timeout.count(), INT_MAX));
+	{
+		std::lock_guard lock(m_mutex);
+		m_thread = std::this_thread::get_id();
+		incoming.swap(m_incoming);
+		if (!m_posted.empty() || !m_ready.empty())
+			wait = 0;
+		if (!m_timers.empty()) {
+			const auto until = std::chrono::ceil<std::chrono::milliseconds>(m_timers.begin()->first.first - Clock::now());
+			const int due = static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(until.count(), 0, INT_MAX));
+			wait = wait < 0 ? due : std::min(wait, due);
+		}
+	}
+	for (auto& watcher : incoming)
+		if (!Register(watcher))
+			m_unwatchable.push_back(std::move(watcher));
+	if (!m_unwatchable.empty())
+		wait = wait < 0 ? 1 : std::min(wait, 1);
+
+	std::vector<std::intptr_t> ready;
+	m_poller->Wait(wait, ready);
+
+	std::vector<std::function<void()>> callbacks;
+	const auto advance = [&callbacks](Watcher& watcher) {
+		AsyncStatus status;
+		try {
+			status = watcher.operation->Resume();
+		} catch (...) {
+			status = AsyncStatus::Done;
+		}
+		if (status == AsyncStatus::Done) {
+			callbacks.push_back(std::move(watcher.done));
+			return true;
+		}
+		watcher.status = status;
+		return false;
+	};
+	for (std::intptr_t fd : ready) {
+		auto it = m_watchers.find(fd);
+		if (it == m_watchers.end())
+			continue;
+		const AsyncStatus before = it->second.status;
+		if (advance(it->second)) {
+			m_poller->Remove(fd);
+			m_watchers.erase(it);
+		}
+		else if (it->second.status != before)
+			m_poller->Modify(fd, it->second.status == AsyncStatus::WantWrite);
+	}
+	std::erase_if(m_unwatchable, advance);
+
+	{
+		std::lock_guard lock(m_mutex);
+		const auto now = Clock::now();
+		while (!m_timers.empty() && m_timers.begin()->first.first <= now) {
+			auto node = m_timers.extract(m_timers.begin());
+			m_deadlines.erase(node.key().second);
+			callbacks.push_back(std::move(node.mapped()));
+		}
+		for (auto& callback : m_posted)
+			callbacks.push_back(std::move(callback));
+		m_posted.clear();
+	}
+
+	// Callbacks may submit, Watch() or post again; no lock is held here
+	for (auto& callback : callbacks)
+		callback();
+	return callbacks.size() + Dispatch();
+}
+
+void Reactor::Run() {
+	while (!m_stop)
+		RunOnce();
+	m_stop = false;
+}
+
+void Reactor::Stop() noexcept {
+	m_stop = true;
+	m_poller->Wake();
+}
+
+ReactorStats Reactor::Stats(ConnectionId id) const {
+	std::lock_guard lock(m_mutex);
+	const Slot& slot = *m_slots.at(id);
+	ReactorStats stats = slot.stats;
+	stats.queued = slot.queue.size();
+	return stats;
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/async.hxx>
+#include <StormByte/database/database.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	class Poller;
+
+	/**
+	 * @struct ReactorStats
+	 * @brief Snapshot of one Reactor connection's counters.
+	 */
+	struct ReactorStats {
+		std::size_t queued = 0;						///< Operations waiting for the connection
+		bool in_flight = false;						///< An operation is running on the connection
+		std::uint64_t completed = 0;				///< Finished operations (including failed ones)
+		std::uint64_t failed = 0;					///< Operations that returned an error
+		std::chrono::nanoseconds total_latency{0};	///< Accumulated submit-to-result latency
+		std::chrono::nanoseconds max_latency{0};	///< Worst submit-to-result latency
+		std::chrono::nanoseconds last_latency{0};	///< Latency of the latest operation
+
+		/**
+		 * @return Mean submit-to-result latency.
+		 */
+		inline std::chrono::nanoseconds AverageLatency() const noexcept {
+			return completed == 0 ? std::chrono::nanoseconds{0} : total_latency / static_cast<std::int64_t>(completed);
+		}
+	};
+
+	/**
+	 * @class Reactor
+	 * @brief Single-threaded event loop owning many connections.
+	 *
+	 * Connections handed to Add() are driven by this reactor: their sockets are
+	 * multiplexed with epoll (poll() / WSAPoll() outside Linux), so thousands of
+	 * idle or waiting connections cost one thread and no per-connection polling.
+	 * QueryAsync() / ExecuteAsync() queue an operation on a connection; queued
+	 * operations start in order as soon as the previous one finished, and every
+	 * awaiting coroutine, timer and Post() callback runs on the thread calling
+	 * Run() / RunOnce().
+	 *
+	 * Submitting work, timers and Stop() are thread-safe. The owned connections
+	 * themselves are not: use them only from reactor callbacks or coroutines.
+	 * Let in-flight operations finish before destroying the reactor; coroutines
+	 * still waiting on it are never resumed.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC Reactor final: public EventLoop {
+		public:
+			using ConnectionId = std::size_t;						///< Index returned by Add()
+			using TimerId = std::uint64_t;							///< Handle returned by After()
+			using Clock = std::chrono::steady_clock;				///< Timer and latency clock
+
+			/**
+			 * Constructor.
+			 */
+			Reactor();
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Reactor(const Reactor&) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Reactor(Reactor&&) = delete;
+
+			/**
+			 * Destructor. Destroys the owned connections.
+			 */
+			~Reactor() noexcept override;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Reactor& operator=(const Reactor&) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Reactor& operator=(Reactor&&) = delete;
+
+			/**
+			 * Takes ownership of @p db and makes this reactor its event loop.
+			 * Connecting it (before or after) is up to the caller.
+			 * @param db Connection.
+			 * @return Id used by the other calls.
+			 */
+			ConnectionId Add(std::unique_ptr<Database> db);
+
+			/**
+			 * @param id Connection id.
+			 * @return The owned connection.
+			 */
+			Database& Connection(ConnectionId id);
+
+			/**
+			 * @return Number of owned connections.
+			 */
+			std::size_t Size() const;
+
+			/**
+			 * Queues a query on connection @p id.
+			 * @param id Connection id.
+			 * @param query SQL text.
+			 * @return Awaitable yielding the result rows or an error.
+			 */
+			Awaitable<ExpectedRows> QueryAsync(ConnectionId id, std::string query);
+
+			/**
+			 * Queues a prepared statement execution on connection @p id.
+			 * Arguments are copied and bound only when the statement starts.
+			 * @tparam Args Argument types.
+			 * @param id Connection id.
+			 * @param name Prepared statement name.
+			 * @param args Positional bind values (0-based).
+			 * @return Awaitable yielding the result rows or an error.
+			 */
+			template<typename... Args>
+			Awaitable<ExpectedRows> ExecuteAsync(ConnectionId id, std::string name, Args&&... args) {
+				return Submit(id, [name = std::move(name), bound = std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...)](Database& db) {
+					return std::apply([&db, &name](const auto&... values) { return db.ExecuteAsync(name, values...); }, bound);
+				});
+			}
+
+			/**
+			 * Runs @p callback on the reactor thread after @p delay.
+			 * @param delay Delay from now.
+			 * @param callback Timer callback.
+			 * @return Timer handle for Cancel().
+			 */
+			TimerId After(std::chrono::milliseconds delay, std::function<void()> callback);
+
+			/**
+			 * Cancels a pending timer.
+			 * @param timer Timer handle.
+			 * @return true if it had not fired yet.
+			 */
+			bool Cancel(TimerId timer);
+
+			/**
+			 * Runs @p callback on the reactor thread during the next iteration.
+			 * @param callback Callback.
+			 */
+			void Post(std::function<void()> callback);
+
+			/**
+			 * Runs one iteration: waits up to @p timeout for sockets, timers or
+			 * posted work, then handles everything that became ready.
+			 * @param timeout Maximum wait (negative: until something happens).
+			 * @return Number of operations, timers and callbacks completed.
+			 */
+			std::size_t RunOnce(std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+			/**
+			 * Runs iterations on the calling thread until Stop().
+			 */
+			void Run();
+
+			/**
+			 * Makes Run() return after its current iteration. Thread-safe.
+			 */
+			void Stop() noexcept;
+
+			/**
+			 * @param id Connection id.
+			 * @return Queue depth and latency counters of connection @p id.
+			 */
+			ReactorStats Stats(ConnectionId id) const;
+
+			/**
+			 * Drives @p operation from the reactor's poller.
+			 * @see EventLoop::Watch
+			 */
+			void Watch(AsyncOperation& operation, AsyncStatus status, std::function<void()> done) override;
+
+		private:
+			class QueuedOperation;
+
+			using Factory = std::function<Awaitable<ExpectedRows>(Database&)>;
+
+			/**
+			 * @struct Job
+			 * @brief An operation queued on a connection.
+			 */
+			struct Job {
+				Factory start;										///< Starts the operation on the connection
+				QueuedOperation* operation;							///< Awaited operation to complete
+				Clock::time_point submitted;						///< Queueing time (latency origin)
+			};
+
+			/**
+			 * @struct Slot
+			 * @brief An owned connection and its queue.
+			 */
+			struct Slot {
+				ConnectionId id;									///< Index in m_slots
+				std::unique_ptr<Database> db;						///< Connection
+				std::deque<Job> queue;								///< Operations not started yet
+				ReactorStats stats;									///< Counters (queued / in_flight derived)
+			};
+
+			/**
+			 * @struct Watcher
+			 * @brief A suspended operation waiting on its socket.
+			 */
+			struct Watcher {
+				AsyncOperation* operation;							///< Operation being driven
+				AsyncStatus status;									///< What it waits for
+				std::function<void()> done;							///< Completion callback
+			};
+
+			mutable std::mutex m_mutex;								///< Guards everything but m_poller / m_watchers
+			std::unique_ptr<Poller> m_poller;						///< Socket multiplexer (reactor thread only)
+			std::vector<std::unique_ptr<Slot>> m_slots;				///< Owned connections by id
+			std::vector<ConnectionId> m_ready;						///< Idle connections with queued jobs
+			std::vector<Watcher> m_incoming;						///< Watch() calls not registered yet
+			std::unordered_map<std::intptr_t, Watcher> m_watchers;	///< Registered operations by socket (reactor thread only)
+			std::vector<Watcher> m_unwatchable;						///< Operations without a usable socket, resumed every iteration
+			std::vector<std::function<void()>> m_posted;			///< Post() callbacks
+			std::map<std::pair<Clock::time_point, TimerId>, std::function<void()>> m_timers;	///< Pending timers by deadline
+			std::unordered_map<TimerId, Clock::time_point> m_deadlines;	///< Pending timer deadlines by handle
+			TimerId m_next_timer = 1;								///< Next timer handle
+			std::thread::id m_thread;								///< Thread running the latest iteration
+			std::atomic<bool> m_stop{false};						///< Set by Stop()
+
+			/**
+			 * Queues an operation on connection @p id.
+			 * @param id Connection id.
+			 * @param start Starts the operation once the connection is free.
+			 * @return Awaitable completed on the reactor thread.
+			 */
+			Awaitable<ExpectedRows> Submit(ConnectionId id, Factory start);
+
+			/**
+			 * Queues @p job and wakes the reactor.
+			 */
+			void Enqueue(ConnectionId id, Job job);
+
+			/**
+			 * Starts the next job of every idle connection.
+			 * @return Number of jobs started.
+			 */
+			std::size_t Dispatch();
+
+			/**
+			 * Records the result of @p job and resumes its awaiter.
+			 */
+			void Finish(Slot& slot, Job job, ExpectedRows result);
+
+			/**
+			 * Registers an operation with the poller (reactor thread).
+			 * @return false if its socket cannot be watched.
+			 */
+			bool Register(Watcher& watcher);
+	};
+}
@@ -0,0 +1,22 @@
+#include <StormByte/database/result_schema.hxx>
+
+using namespace StormByte::Database;
+
+void ResultSchema::AddColumn(std::string&& name, std::string&& declared_type) {
+	m_index.emplace(name, m_names.size());
+	m_names.push_back(std::move(name));
+	m_types.push_back(std::move(declared_type));
+}
+
+void ResultSchema::Reserve(std::size_t count) {
+	m_names.reserve(count);
+	m_types.reserve(count);
+	m_index.reserve(count);
+}
+
+std::optional<std::size_t> ResultSchema::IndexOf(std::string_view name) const noexcept {
+	auto it = m_index.find(name);
+	if (it == m_index.end())
+		return std::nullopt;
+	return it->second;
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/visibility.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class ResultSchema
+	 * @brief Column names, declared types and name lookup for one result set.
+	 *
+	 * Built once per result and shared (reference counted) by every Row of that
+	 * result, so rows only store their values. A schema must not be modified once
+	 * it is shared by more than one row.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC ResultSchema {
+		public:
+			/**
+			 * Default constructor (no columns).
+			 */
+			ResultSchema() noexcept = default;
+
+			/**
+			 * Copy constructor.
+			 */
+			ResultSchema(const ResultSchema& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			ResultSchema(ResultSchema&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~ResultSchema() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			ResultSchema& operator=(const ResultSchema& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			ResultSchema& operator=(ResultSchema&& other) noexcept = default;
+
+			/**
+			 * Appends a column.
+			 * @param name Column name.
+			 * @param declared_type Backend type name (may be empty when unknown).
+			 *
+			 * When several columns share a name, lookup by name resolves to the first one.
+			 */
+			void AddColumn(std::string&& name, std::string&& declared_type = {});
+
+			/**
+			 * Reserves space for @p count columns.
+			 * @param count Expected column count.
+			 */
+			void Reserve(std::size_t count);
+
+			/**
+			 * @return Number of columns.
+			 */
+			inline std::size_t Count() const noexcept {
+				return m_names.size();
+			}
+
+			/**
+			 * @param index Column index.
+			 * @return Column name.
+			 * @throws std::out_of_range if @p index is out of range.
+			 */
+			inline const std::string& Name(std::size_t index) const {
+				return m_names.at(index);
+			}
+
+			/**
+			 * @param index Column index.
+			 * @return Declared (backend) type name, empty if unknown.
+			 * @throws std::out_of_range if @p index is out of range.
+			 */
+			inline const std::string& DeclaredType(std::size_t index) const {
+				return m_types.at(index);
+			}
+
+			/**
+			 * Resolves a column name without building a std::string key.
+			 * @param name Column name.
+			 * @return Column index, or std::nullopt if absent.
+			 */
+			std::optional<std::size_t> IndexOf(std::string_view name) const noexcept;
+
+		private:
+			/**
+			 * @struct NameHash
+			 * @brief Transparent hash so that lookups accept std::string_view.
+			 */
+			struct NameHash {
+				using is_transparent = void;
+				inline std::size_t operator()(std::string_view name) const noexcept {
+					return std::hash<std::string_view>{}(name);
+				}
+			};
+
+			std::vector<std::string> m_names;							///< Column names
+			std::vector<std::string> m_types;							///< Declared types
+			std::unordered_map<std::string, std::size_t, NameHash, std::equal_to<>> m_index;	///< Name → index
+	};
+
+	/**
+	 * @brief Shared, immutable schema handle.
+	 */
+	using SharedResultSchema = std::shared_ptr<const ResultSchema>;
+}
@@ -3,44 +3,42 @@
 
 using namespace StormByte::Database;
 
-Row::Row(const Row& other)
-	: Iterable(other), m_name_index(other.m_name_index) {}
-
-Row& Row::operator=(const Row& other) {
-	if (this != &other) {
-		Iterable::operator=(other);
-		m_name_index = other.m_name_index;
-	}
-	return *this;
+Row::Row(SharedResultSchema schema)
+	: m_schema(std::move(schema)) {
+	if (m_schema)
+		m_data.reserve(m_schema->Count());
 }
 
-void Row::BuildNameIndex() const {
-	if (m_name_index) return;
+void Row::add(std::string&& columnName, Value&& value) {
+	// Copy on write: only a schema this row exclusively owns may be extended in place
+	if (!m_schema || m_schema.use_count() > 1)
+		m_schema = m_schema ? std::make_shared<ResultSchema>(*m_schema) : std::make_shared<ResultSchema>();
+	std::const_pointer_cast<ResultSchema>(m_schema)->AddColumn(std::move(columnName));
+	m_data.push_back(std::move(value));
+}
+
+std::size_t Row::IndexOf(std::string_view columnName) const {
+	std::optional<std::size_t> index = m_schema ? m_schema->IndexOf(columnName) : std::nullopt;
+	if (!index || *index >= m_data.size())
+		throw ColumnNotFound(std::string(columnName));
+	return *index;
+}
 
-	std::unordered_map<std::string, std::size_t> index;
-	index.reserve(m_data.size());
-	for (std::size_t i = 0; i < m_data.size(); ++i) {
-		index.emplace(m_data[i].Name(), i);
-	}
-	m_name_index = std::move(index);
+std::size_t Row::Relocate(const ColumnRef& column) const {
+	const std::size_t index = column.Index();
+	if (m_schema && index < m_data.size() && index < m_schema->Count() && m_schema->Name(index) == column.Name())
+		return index;
+	return IndexOf(column.Name());
 }
 
-const Value& Row::operator[](const std::string& columnName) const & {
-	BuildNameIndex();
-	auto it = m_name_index->find(columnName);
-	if (it == m_name_index->end())
-		throw ColumnNotFound(columnName);
-	return m_data[it->second];
+const Value& Row::operator[](std::string_view columnName) const & {
+	return m_data[IndexOf(columnName)];
 }
 
-Value& Row::operator[](const std::string& columnName) & {
-	return const_cast<Value&>(static_cast<const Row*>(this)->operator[](columnName));
+Value& Row::operator[](std::string_view columnName) & {
+	return m_data[IndexOf(columnName)];
 }
 
-Value Row::operator[](const std::string& columnName) && {
-	BuildNameIndex();
-	auto it = m_name_index->find(columnName);
-	if (it == m_name_index->end())
-		throw ColumnNotFound(columnName);
-	return std::move(m_data[it->second]);
+Value Row::operator[](std::string_view columnName) && {
+	return std::move(m_data[IndexOf(columnName)]);
 }
@@ -19,12 +19,14 @@
 
 #pragma once
 
-#include <StormByte/database/named_value.hxx>
+#include <StormByte/database/column_ref.hxx>
+#include <StormByte/database/result_schema.hxx>
+#include <StormByte/database/value.hxx>
 #include <StormByte/iterable.hxx>
 
-#include <unordered_map>
+#include <memory>
+#include <string_view>
 #include <vector>
-#include <optional>
 
 /**
  * @namespace Database
@@ -33,20 +35,28 @@
 namespace StormByte::Database {
 	/**
 	 * @class Row
-	 * @brief Single result row: ordered NamedValues with lookup by column name.
+	 * @brief Single result row: ordered Values with lookup by column name.
+	 *
+	 * Column names live in a ResultSchema shared by every row of the same
+	 * result, so a row only owns its values.
 	 */
-	class STORMBYTE_DATABASE_PUBLIC Row: public Iterable<std::vector<NamedValue>> {
+	class STORMBYTE_DATABASE_PUBLIC Row: public Iterable<std::vector<Value>> {
 		public:
 			/**
-			 * Default constructor.
+			 * Default constructor (no schema, no columns).
 			 */
 			Row() noexcept = default;
 
+			/**
+			 * Creates an empty row bound to @p schema; values are appended with add(Value&&).
+			 * @param schema Schema shared with the other rows of the result.
+			 */
+			explicit Row(SharedResultSchema schema);
+
 			/**
 			 * Copy constructor.
-			 * @param other Source row.
 			 */
-			Row(const Row& other);
+			Row(const Row& other) = default;
 
 			/**
 			 * Move constructor.
@@ -60,10 +70,8 @@ namespace StormByte::Database {
 
 			/**
 			 * Copy assignment.
-			 * @param other Source row.
-			 * @return *this
 			 */
-			Row& operator=(const Row& other);
+			Row& operator=(const Row& other) = default;
 
 			/**
 			 * Move assignment.
@@ -76,7 +84,7 @@ namespace StormByte::Database {
 			 * @return Reference to the value.
 			 * @throws ColumnNotFound if the name is absent.
 			 */
-			const Value& operator[](const std::string& columnName) const &;
+			const Value& operator[](std::string_view columnName) const &;
 
 			/**
 			 * Access by column name (lvalue).
@@ -84,7 +92,7 @@ namespace StormByte::Database {
 			 * @return Reference to the value.
 			 * @throws ColumnNotFound if the name is absent.
 			 */
-			Value& operator[](const std::string& columnName) &;
+			Value& operator[](std::string_view columnName) &;
 
 			/**
 			 * Access by column name (rvalue).
@@ -92,19 +100,50 @@ namespace StormByte::Database {
 			 * @return Value (moved).
 			 * @throws ColumnNotFound if the name is absent.
 			 */
-			Value operator[](const std::string& columnName) &&;
+			Value operator[](std::string_view columnName) &&;
+
+			/**
+			 * Access through a resolved column reference (const lvalue).
+			 * @param column Column reference.
+			 * @return Reference to the value.
+			 * @throws ColumnNotFound if the column is absent.
+			 */
+			inline const Value& operator[](const ColumnRef& column) const & {
+				return m_data[IndexOf(column)];
+			}
+
+			/**
+			 * Access through a resolved column reference (lvalue).
+			 * @param column Column reference.
+			 * @return Reference to the value.
+			 * @throws ColumnNotFound if the column is absent.
+			 */
+			inline Value& operator[](const ColumnRef& column) & {
+				return m_data[IndexOf(column)];
+			}
+
+			/**
+			 * Access through a resolved column reference (rvalue).
+			 * @param column Column reference.
+			 * @return Value (moved).
+			 * @throws ColumnNotFound if the column is absent.
+			 */
+			inline Value operator[](const ColumnRef& column) && {
+				return std::move(m_data[IndexOf(column)]);
+			}
 
 			using Iterable::operator[];
+			using Iterable::add;
 
 			/**
-			 * Appends a named column.
+			 * Appends a named column to a row that does not share its schema.
 			 * @param columnName Column name.
 			 * @param value Value to store.
+			 *
+			 * If the schema is shared with other rows it is copied first, so prefer
+			 * Row(SharedResultSchema) plus add(Value&&) when building many rows.
 			 */
-			inline void add(std::string&& columnName, Value&& value) {
-				m_data.emplace_back(std::move(columnName), std::move(value));
-				m_name_index.reset();
-			}
+			void add(std::string&& columnName, Value&& value);
 
 			/**
 			 * @return Number of columns.
@@ -113,12 +152,52 @@ namespace StormByte::Database {
 				return size();
 			}
 
+			/**
+			 * Makes every text / blob view in this row an owning copy.
+			 */
+			inline void Detach() {
+				for (Value& value : m_data)
+					value.Detach();
+			}
+
+			/**
+			 * @return Schema shared by this row (may be null for a default-constructed row).
+			 */
+			inline const SharedResultSchema& Schema() const noexcept {
+				return m_schema;
+			}
+
 		private:
-			mutable std::optional<std::unordered_map<std::string, std::size_t>> m_name_index;	///< Lazy name → index map
+			SharedResultSchema m_schema;	///< Column names and types
+
+			/**
+			 * Resolves @p columnName through the schema.
+			 * @param columnName Column name.
+			 * @return Column index.
+			 * @throws ColumnNotFound if the name is absent.
+			 */
+			std::size_t IndexOf(std::string_view columnName) const;
+
+			/**
+			 * Resolves @p column: its cached index when this row shares the schema it
+			 * was resolved against, otherwise through Relocate().
+			 * @param column Column reference.
+			 * @return Column index.
+			 * @throws ColumnNotFound if the column is absent.
+			 */
+			inline std::size_t IndexOf(const ColumnRef& column) const {
+				if (column.ResolvedFor(m_schema.get()) && column.Index() < m_data.size())
+					return column.Index();
+				return Relocate(column);
+			}
 
 			/**
-			 * Builds m_name_index if not yet present.
+			 * Resolves @p column for a row of another schema: the cached position
+			 * if the name still matches there, otherwise a name lookup.
+			 * @param column Column reference.
+			 * @return Column index.
+			 * @throws ColumnNotFound if the column is absent.
 			 */
-			void BuildNameIndex() const;
+			std::size_t Relocate(const ColumnRef& column) const;
 	};
 }
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/exception.hxx>
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/visibility.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @class RowReader
+	 * @brief Positional, typed access to a backend result without building Values.
+	 *
+	 * Backends implement it directly over their native buffers
+	 * (sqlite3_column_*, PGresult cells, MYSQL_BIND buffers). Getters read the
+	 * current row and must only be called after Next() returned true; views stay
+	 * valid until the next call to Next().
+	 */
+	class STORMBYTE_DATABASE_PUBLIC RowReader {
+		public:
+			/**
+			 * Destructor. Releases or drains the backend result.
+			 */
+			virtual ~RowReader() noexcept = default;
+
+			/**
+			 * Advances to the next row.
+			 * @return true if a row is available, false once exhausted, or an error.
+			 */
+			virtual Expected<bool, QueryException> Next() = 0;
+
+			/**
+			 * @return Number of columns in the result.
+			 */
+			virtual std::size_t ColumnCount() const noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return true if the cell is SQL NULL.
+			 */
+			virtual bool IsNull(std::size_t column) noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return Cell as a 64-bit integer.
+			 */
+			virtual std::int64_t Int64(std::size_t column) noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return Cell as a double.
+			 */
+			virtual double Double(std::size_t column) noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return Cell as a boolean.
+			 */
+			virtual bool Bool(std::size_t column) noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return Cell text (view into the backend buffer).
+			 */
+			virtual std::string_view Text(std::size_t column) noexcept = 0;
+
+			/**
+			 * @param column Column index.
+			 * @return Cell bytes (view into the backend buffer).
+			 */
+			virtual std::span<const std::byte> Blob(std::size_t column) = 0;
+	};
+
+	/**
+	 * @struct CellDecoder
+	 * @brief Reads one cell of a RowReader as @p T.
+	 *
+	 * Supported: bool, integral and floating point types, std::string,
+	 * std::vector<std::byte> and std::optional of any of them (NULL maps to
+	 * std::nullopt). Integers are narrowed with static_cast, without range checks.
+	 * @tparam T Target type.
+	 */
+	template<typename T>
+	struct CellDecoder {
+		static_assert(std::is_arithmetic_v<T> || std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<std::byte>>,
+			"Unsupported column type for typed decoding");
+
+		/**
+		 * @param reader Reader positioned on a row.
+		 * @param column Column index.
+		 * @return Decoded cell.
+		 * @throws WrongValueType if the cell is NULL.
+		 */
+		static T Decode(RowReader& reader, std::size_t column) {
+			if (reader.IsNull(column))
+				throw WrongValueType("Column " + std::to_string(column) + " is NULL; decode it as std::optional");
+			if constexpr (std::is_same_v<T, bool>)
+				return reader.Bool(column);
+			else if constexpr (std::is_integral_v<T>)
+				return static_cast<T>(reader.Int64(column));
+			else if constexpr (std::is_floating_point_v<T>)
+				return static_cast<T>(reader.Double(column));
+			else if constexpr (std::is_same_v<T, std::string>)
+				return std::string(reader.Text(column));
+			else {
+				const std::span<const std::byte> blob = reader.Blob(column);
+				return std::vector<std::byte>(blob.begin(), blob.end());
+			}
+		}
+	};
+
+	template<typename T>
+	struct CellDecoder<std::optional<T>> {
+		static std::optional<T> Decode(RowReader& reader, std::size_t column) {
+			if (reader.IsNull(column))
+				return std::nullopt;
+			return CellDecoder<T>::Decode(reader, column);
+		}
+	};
+
+	/**
+	 * @struct RowDecoder
+	 * @brief Decodes a whole row into an aggregate, binding fields to columns by position.
+	 *
+	 * The field count is found at compile time from aggregate initialization;
+	 * aggregates of up to 16 default-constructible fields are supported.
+	 * @tparam T Aggregate type.
+	 */
+	template<typename T>
+	struct RowDecoder {
+		private:
+			/** Converts to any field type; only used to count fields. */
+			struct AnyField {
+				std::size_t index;
+				template<typename U> operator U() const;
+			};
+
+			template<std::size_t... I>
+			static constexpr bool Constructible(std::index_sequence<I...>) {
+				return requires { T{AnyField{I}...}; };
+			}
+
+			template<std::size_t N = 0>
+			static constexpr std::size_t CountFields() {
+				if constexpr (N > 16 || !Constructible(std::make_index_sequence<N + 1>{}))
+					return N;
+				else
+					return CountFields<N + 1>();
+			}
+
+			template<typename... Fields>
+			static void Fill(RowReader& reader, Fields&... fields) {
+				std::size_t column = 0;
+				((fields = CellDecoder<std::remove_cvref_t<Fields>>::Decode(reader, column++)), ...);
+			}
+
+		public:
+			static_assert(std::is_aggregate_v<T>, "Typed rows must be std::tuple or aggregate structs");
+
+			static constexpr std::size_t Columns = CountFields();	///< Columns consumed
+
+			static_assert(Columns > 0 && Columns <= 16, "Aggregate must have between 1 and 16 fields");
+
+			/**
+			 * @param reader Reader positioned on a row.
+			 * @return Decoded row.
+			 */
+			static T Decode(RowReader& reader) {
+				T row{};
+				if constexpr (Columns == 1) { auto& [a] = row; Fill(reader, a); }
+				else if constexpr (Columns == 2) { auto& [a, b] = row; Fill(reader, a, b); }
+				else if constexpr (Columns == 3) { auto& [a, b, c] = row; Fill(reader, a, b, c); }
+				else if constexpr (Columns == 4) { auto& [a, b, c, d] = row; Fill(reader, a, b, c, d); }
+				else if constexpr (Columns == 5) { auto& [a, b, c, d, e] = row; Fill(reader, a, b, c, d, e); }
+				else if constexpr (Columns == 6) { auto& [a, b, c, d, e, f] = row; Fill(reader, a, b, c, d, e, f); }
+				else if constexpr (Columns == 7) { auto& [a, b, c, d, e, f, g] = row; Fill(reader, a, b, c, d, e, f, g); }
+				else if constexpr (Columns == 8) { auto& [a, b, c, d, e, f, g, h] = row; Fill(reader, a, b, c, d, e, f, g, h); }
+				else if constexpr (Columns == 9) { auto& [a, b, c, d, e, f, g, h, i] = row; Fill(reader, a, b, c, d, e, f, g, h, i); }
+				else if constexpr (Columns == 10) { auto& [a, b, c, d, e, f, g, h, i, j] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j); }
+				else if constexpr (Columns == 11) { auto& [a, b, c, d, e, f, g, h, i, j, k] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k); }
+				else if constexpr (Columns == 12) { auto& [a, b, c, d, e, f, g, h, i, j, k, l] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k, l); }
+				else if constexpr (Columns == 13) { auto& [a, b, c, d, e, f, g, h, i, j, k, l, m] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k, l, m); }
+				else if constexpr (Columns == 14) { auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k, l, m, n); }
+				else if constexpr (Columns == 15) { auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o); }
+				else { auto& [a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p] = row; Fill(reader, a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p); }
+				return row;
+			}
+	};
+
+	template<typename... Ts>
+	struct RowDecoder<std::tuple<Ts...>> {
+		static constexpr std::size_t Columns = sizeof...(Ts);	///< Columns consumed
+
+		static std::tuple<Ts...> Decode(RowReader& reader) {
+			return Decode(reader, std::index_sequence_for<Ts...>{});
+		}
+
+		private:
+			template<std::size_t... I>
+			static std::tuple<Ts...> Decode(RowReader& reader, std::index_sequence<I...>) {
+				// Braced initialization evaluates the cells left to right
+				return std::tuple<Ts...>{CellDecoder<Ts>::Decode(reader, I)...};
+			}
+	};
+
+	/**
+	 * Drains @p reader into a vector of @p T.
+	 * @tparam T std::tuple or aggregate struct.
+	 * @param reader Reader from DoExecuteReader() (null: no result set).
+	 * @return Decoded rows or an error.
+	 */
+	template<typename T>
+	ExpectedVector<T> ReadAll(ExpectedRowReader&& reader) {
+		if (!reader)
+			return Unexpected(reader.error());
+
+		std::vector<T> rows;
+		if (!*reader)
+			return rows;
+
+		if ((*reader)->ColumnCount() < RowDecoder<T>::Columns) {
+			return Unexpected<ExecuteError>("Result has " + std::to_string((*reader)->ColumnCount()) +
+				" columns, typed row needs " + std::to_string(RowDecoder<T>::Columns));
+		}
+
+		try {
+			while (true) {
+				Expected<bool, QueryException> more = (*reader)->Next();
+				if (!more)
+					return Unexpected(more.error());
+				if (!*more)
+					break;
+				rows.push_back(RowDecoder<T>::Decode(**reader));
+			}
+		} catch (const WrongValueType& e) {
+			return Unexpected<ExecuteError>(e.what());
+		}
+		return rows;
+	}
+}
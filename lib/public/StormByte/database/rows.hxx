@@ -19,8 +19,12 @@
 
 #pragma once
 
+#include <StormByte/database/arena.hxx>
 #include <StormByte/database/row.hxx>
 
+#include <memory>
+#include <string_view>
+
 /**
  * @namespace Database
  * @brief Contains classes and functions for database operations.
@@ -29,6 +33,15 @@ namespace StormByte::Database {
 	/**
 	 * @class Rows
 	 * @brief Ordered collection of result rows.
+	 *
+	 * With ResultStorage::Arena the text and blob values of every row are views
+	 * into an Arena owned by the Rows (shared by its copies). Such values stay
+	 * valid while any copy of the Rows lives; call Row::Detach() on a Row that
+	 * must outlive them.
+	 *
+	 * With ResultStorage::Borrowed the Rows additionally keeps the backend
+	 * result alive (see KeepAlive()) and text values view its buffer directly,
+	 * under the same lifetime rules.
 	 */
 	class STORMBYTE_DATABASE_PUBLIC Rows: public Iterable<std::vector<Row>> {
 		public:
@@ -68,5 +81,46 @@ namespace StormByte::Database {
 			inline std::size_t Count() const noexcept {
 				return size();
 			}
+
+			/**
+			 * Resolves a column name once for access on every row of this result.
+			 * @param name Column name.
+			 * @return Reference resolved against the rows' schema (unresolved if there are no rows).
+			 * @throws ColumnNotFound if the rows have no such column.
+			 */
+			inline ColumnRef Column(std::string_view name) const {
+				return m_data.empty() ? ColumnRef(name) : ColumnRef(m_data.front().Schema(), name);
+			}
+
+			/**
+			 * Creates the arena that will hold this result's text and blob payloads.
+			 * @param block_size Arena block size in bytes.
+			 * @return The arena.
+			 */
+			inline Arena& UseArena(std::size_t block_size = Arena::DefaultBlockSize) {
+				if (!m_arena)
+					m_arena = std::make_shared<Arena>(block_size);
+				return *m_arena;
+			}
+
+			/**
+			 * @return Payload arena, or nullptr if this result owns its values.
+			 */
+			inline Arena* GetArena() const noexcept {
+				return m_arena.get();
+			}
+
+			/**
+			 * Ties the lifetime of @p owner (typically the backend result whose
+			 * buffer the values view) to this Rows and its copies.
+			 * @param owner Object to keep alive.
+			 */
+			inline void KeepAlive(std::shared_ptr<const void> owner) noexcept {
+				m_owner = std::move(owner);
+			}
+
+		private:
+			std::shared_ptr<Arena> m_arena;			///< Payload storage (ResultStorage::Arena / Borrowed)
+			std::shared_ptr<const void> m_owner;	///< Backend result viewed by the values (ResultStorage::Borrowed)
 	};
 }
@@ -0,0 +1,138 @@
+#include <StormByte/database/slow_query_log.hxx>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <optional>
+
+using namespace StormByte::Database;
+
+namespace {
+	void AppendMilliseconds(std::string& out, SlowQueryLog::Clock::duration elapsed) {
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.3f ms", std::chrono::duration<double, std::milli>(elapsed).count());
+		out += buffer;
+	}
+}
+
+void SlowQueryLog::SetOptions(const SlowQueryOptions& options) noexcept {
+	m_options = options;
+	m_next_plan = Clock::time_point{};
+}
+
+void SlowQueryLog::SetLogger(std::shared_ptr<Logger::Log> logger) noexcept {
+	m_logger = std::move(logger);
+}
+
+void SlowQueryLog::SetExplainer(Explainer explainer) noexcept {
+	m_explainer = std::move(explainer);
+}
+
+void SlowQueryLog::Report(std::string_view statement, const std::string& sql, std::span<const Value> parameters, Clock::duration elapsed, bool failed) {
+	m_reported.fetch_add(1, std::memory_order_relaxed);
+
+	// The rate limit applies to attempts, so a plan the backend cannot produce is not retried on every slow call either
+	std::optional<ExpectedPlan> plan;
+	bool skipped = false;
+	if (!failed && m_options.capture_plan && m_explainer) {
+		const Clock::time_point now = Clock::now();
+		if (now < m_next_plan) {
+			skipped = true;
+			m_plans_skipped.fetch_add(1, std::memory_order_relaxed);
+		}
+		else {
+			m_next_plan = now + m_options.plan_interval;
+			plan = m_explainer(sql, parameters);
+			(*plan ? m_plans : m_plan_errors).fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	if (!m_logger)
+		return;
+
+	std::string message = statement.empty() ? "Slow query " : "Slow statement '" + std::string(statement) + "' ";
+	message += failed ? "failed after " : "took ";
+	AppendMilliseconds(message, elapsed);
+	message += ": ";
+	message += sql;
+	if (!parameters.empty()) {
+		message += " [parameters: ";
+		for (std::size_t i = 0; i < parameters.size(); ++i) {
+			if (i > 0)
+				message += ", ";
+			AppendParameter(message, parameters[i]);
+		}
+		message += ']';
+	}
+	if (skipped)
+		message += " (plan not captured: rate limited)";
+	else if (plan && !*plan)
+		message += std::string(" (plan not captured: ") + plan->error()->what() + ')';
+	else if (plan && !(*plan)->empty())
+		message += "\nPlan:\n" + **plan;
+
+	*m_logger << Logger::Level::Warning << message << std::endl;
+}
+
+SlowQueryStats SlowQueryLog::Stats() const noexcept {
+	SlowQueryStats stats;
+	stats.reported = m_reported.load(std::memory_order_relaxed);
+	stats.plans = m_plans.load(std::memory_order_relaxed);
+	stats.plans_skipped = m_plans_skipped.load(std::memory_order_relaxed);
+	stats.plan_errors = m_plan_errors.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void SlowQueryLog::AppendParameter(std::string& out, const Value& value) const {
+	char buffer[32];
+	switch (value.Type()) {
+		case Value::Type::Null:
+			out += "NULL";
+			break;
+		case Value::Type::Boolean:
+			out += value.Get<bool>() ? "TRUE" : "FALSE";
+			break;
+		case Value::Type::UnsignedInteger:
+		case Value::Type::UnsignedLongInteger:
+			out += std::to_string(value.Get<unsigned long int>());
+			break;
+		case Value::Type::Integer:
+		case Value::Type::LongInteger:
+			out += std::to_string(value.Get<long int>());
+			break;
+		case Value::Type::Double:
+			out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value.Get<double>()).ptr);
+			break;
+		case Value::Type::Text: {
+			const std::string_view text = value.Get<std::string_view>();
+			std::size_t shown = std::min(text.size(), m_options.max_parameter_length);
+			// Do not cut a UTF-8 sequence in half
+			while (shown < text.size() && shown > 0 && (static_cast<unsigned char>(text[shown]) & 0xC0) == 0x80)
+				--shown;
+			out += '\'';
+			for (char c : text.substr(0, shown)) {
+				if (c == '\'')
+					out += '\'';
+				out += c;
+			}
+			out += '\'';
+			if (shown < text.size())
+				out += "... (" + std::to_string(text.size()) + " bytes)";
+			break;
+		}
+		case Value::Type::Blob: {
+			static constexpr char digits[] = "0123456789abcdef";
+			const std::span<const std::byte> blob = value.Get<std::span<const std::byte>>();
+			const std::size_t shown = std::min(blob.size(), m_options.max_parameter_length / 2);
+			out += "X'";
+			for (std::byte b : blob.first(shown)) {
+				out += digits[std::to_integer<unsigned>(b) >> 4];
+				out += digits[std::to_integer<unsigned>(b) & 0x0F];
+			}
+			out += '\'';
+			if (shown < blob.size())
+				out += "... (" + std::to_string(blob.size()) + " bytes)";
+			break;
+		}
+	}
+}
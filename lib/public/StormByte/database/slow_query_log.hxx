@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/value.hxx>
+#include <StormByte/database/visibility.h>
+#include <StormByte/logger/log.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct SlowQueryOptions
+	 * @brief When a Database reports slow statements and captures their plans.
+	 */
+	struct SlowQueryOptions {
+		std::chrono::nanoseconds threshold{0};				///< Report executions taking at least this long (0 = disabled)
+		bool capture_plan = true;							///< Log the plan of reported statements
+		std::chrono::milliseconds plan_interval{60000};		///< Minimum time between two plan captures
+		std::size_t max_parameter_length = 256;				///< Longer text / blob parameters are cut in the log
+	};
+
+	/**
+	 * @struct SlowQueryStats
+	 * @brief Snapshot of SlowQueryLog counters.
+	 */
+	struct SlowQueryStats {
+		std::uint64_t reported = 0;			///< Slow executions logged
+		std::uint64_t plans = 0;			///< Plans captured
+		std::uint64_t plans_skipped = 0;	///< Captures skipped by the rate limit
+		std::uint64_t plan_errors = 0;		///< Captures the backend could not explain
+	};
+
+	/**
+	 * @class SlowQueryLog
+	 * @brief Reports statements exceeding SlowQueryOptions::threshold to the logger.
+	 *
+	 * Checked by StatementMetrics after every recorded execution, so it sees
+	 * exactly what Database::Stats() sees. A report logs the statement, its SQL,
+	 * its parameters and its duration at Logger::Level::Warning and, at most
+	 * once per SlowQueryOptions::plan_interval, the plan the backend's explainer
+	 * returns for the same SQL and parameters. The capture runs after the
+	 * statement finished, on the same connection, and never executes it.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC SlowQueryLog {
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			/**
+			 * @typedef ExpectedPlan
+			 * @brief Plan text or the error that prevented its capture.
+			 */
+			using ExpectedPlan = Expected<std::string, QueryException>;
+
+			/**
+			 * @typedef Explainer
+			 * @brief Explains @p sql with @p parameters bound (EXPLAIN QUERY PLAN,
+			 * EXPLAIN (FORMAT JSON), EXPLAIN FORMAT=JSON). Bound to the native
+			 * connection handle, not to the Database, which may be moved.
+			 */
+			using Explainer = std::function<ExpectedPlan(const std::string& sql, std::span<const Value> parameters)>;
+
+			/**
+			 * Sets the threshold, plan capture and rate limit.
+			 * @param options Options.
+			 */
+			void SetOptions(const SlowQueryOptions& options) noexcept;
+
+			/**
+			 * @return Current options.
+			 */
+			inline const SlowQueryOptions& Options() const noexcept {
+				return m_options;
+			}
+
+			/**
+			 * Sets where reports are written.
+			 * @param logger Logger instance (null: reports are only counted).
+			 */
+			void SetLogger(std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Sets the plan source; an empty one disables capture.
+			 * @param explainer Explainer of the current connection.
+			 */
+			void SetExplainer(Explainer explainer) noexcept;
+
+			/**
+			 * @param elapsed Execution time.
+			 * @return true if @p elapsed has to be reported.
+			 */
+			inline bool IsSlow(Clock::duration elapsed) const noexcept {
+				return m_options.threshold.count() > 0 && elapsed >= m_options.threshold;
+			}
+
+			/**
+			 * Logs one slow execution and, rate limit permitting, its plan.
+			 * @param statement Statement name (empty for Database::Query()).
+			 * @param sql SQL text.
+			 * @param parameters Bound parameters.
+			 * @param elapsed Execution time.
+			 * @param failed Whether it returned an error (no plan is captured then).
+			 */
+			void Report(std::string_view statement, const std::string& sql, std::span<const Value> parameters, Clock::duration elapsed, bool failed);
+
+			/**
+			 * @return Current counters.
+			 */
+			SlowQueryStats Stats() const noexcept;
+
+			/**
+			 * Non-owning Value of an Execute() argument, as Report() takes them:
+			 * the same conversions as PreparedSTMT::BindNative().
+			 * @tparam T Argument type.
+			 * @param value Argument, which must outlive the Value.
+			 * @return Value viewing text and blob arguments.
+			 */
+			template<typename T>
+			static Value Parameter(const T& value) noexcept {
+				using U = std::remove_cvref_t<T>;
+				if constexpr (std::is_same_v<U, Value>)
+					return value;
+				else if constexpr (std::is_same_v<U, std::nullptr_t>)
+					return Value();
+				else if constexpr (std::is_same_v<U, bool>)
+					return Value(value);
+				else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+					return Value(static_cast<long int>(value));
+				else if constexpr (std::is_integral_v<U>)
+					return Value(static_cast<unsigned long int>(value));
+				else if constexpr (std::is_floating_point_v<U>)
+					return Value(static_cast<double>(value));
+				else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+					return Value(std::string_view(value));
+				else if constexpr (std::is_convertible_v<const U&, std::span<const std::byte>>)
+					return Value(std::span<const std::byte>(value));
+				else if constexpr (requires { value.has_value(); *value; })
+					return value.has_value() ? Parameter(*value) : Value();
+				else
+					return Value(value);
+			}
+
+		private:
+			SlowQueryOptions m_options;							///< Threshold and rate limit
+			std::shared_ptr<Logger::Log> m_logger;				///< Report destination
+			Explainer m_explainer;								///< Plan source (empty: none)
+			Clock::time_point m_next_plan{};					///< Earliest time of the next capture
+			std::atomic<std::uint64_t> m_reported{0};			///< Slow executions logged
+			std::atomic<std::uint64_t> m_plans{0};				///< Plans captured
+			std::atomic<std::uint64_t> m_plans_skipped{0};		///< Captures skipped by the rate limit
+			std::atomic<std::uint64_t> m_plan_errors{0};		///< Failed captures
+
+			/**
+			 * Appends @p value as an SQL literal, cutting long text and blobs.
+			 * @param out Destination.
+			 * @param value Parameter.
+			 */
+			void AppendParameter(std::string& out, const Value& value) const;
+	};
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/prepared_stmt.hxx>
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct StatementParam
+	 * @brief Parameter type Statement<Args...> accepts for a declared argument @p T.
+	 *
+	 * Strings and blobs are taken as views so literals and buffers bind without a copy.
+	 */
+	template<typename T>
+	struct StatementParam {
+		using type = const T&;
+	};
+
+	template<>
+	struct StatementParam<std::string> {
+		using type = std::string_view;
+	};
+
+	template<>
+	struct StatementParam<std::vector<std::byte>> {
+		using type = std::span<const std::byte>;
+	};
+
+	/**
+	 * @class Statement
+	 * @brief Typed handle to a registered prepared statement.
+	 *
+	 * Returned by Database::DoPrepareSTMT<Args...>(). Executing through the handle
+	 * skips the by-name lookup, binds each argument through the backend's native
+	 * typed binder (no Value is built) and resets the statement once, afterwards.
+	 *
+	 * Supported argument types: bool, integral and floating-point types,
+	 * std::string / std::string_view / const char*, std::vector<std::byte> /
+	 * std::span<const std::byte>, std::nullptr_t and std::optional of any of those.
+	 *
+	 * @note The handle does not own the statement: it is invalidated when the
+	 * Database disconnects (prepared statements are dropped) and must be
+	 * recreated in DoPostConnect().
+	 */
+	template<typename... Args>
+	class Statement {
+		public:
+			/**
+			 * Empty handle (IsValid() is false).
+			 */
+			Statement() noexcept = default;
+
+			/**
+			 * @param stmt Registered prepared statement (may be null).
+			 */
+			explicit Statement(PreparedSTMT* stmt) noexcept
+				: m_stmt(stmt) {}
+
+			/**
+			 * Binds arguments and executes the statement.
+			 * @param args Positional bind values.
+			 * @return Result rows or an error.
+			 */
+			ExpectedRows Execute(typename StatementParam<Args>::type... args) const {
+				if (!m_stmt)
+					return Unexpected<ExecuteError>("Statement handle is not prepared");
+				BindAll(std::index_sequence_for<Args...>{}, args...);
+				ExpectedRows result = m_stmt->m_metrics
+					? m_stmt->m_metrics->Measure([this] { return m_stmt->DoExecute(); }, m_stmt->m_query, [&] { return std::vector<Value>{SlowQueryLog::Parameter(args)...}; })
+					: m_stmt->DoExecute();
+				m_stmt->Reset();
+				return result;
+			}
+
+			/**
+			 * Binds arguments and executes the statement without blocking the caller.
+			 * @param args Positional bind values, used until the co_await completes.
+			 * @return Awaitable yielding the result rows or an error.
+			 * @see PreparedSTMT::ExecuteAsync
+			 */
+			Awaitable<ExpectedRows> ExecuteAsync(typename StatementParam<Args>::type... args) const {
+				if (!m_stmt)
+					return Awaitable<ExpectedRows>(Unexpected<ExecuteError>("Statement handle is not prepared"));
+				BindAll(std::index_sequence_for<Args...>{}, args...);
+				return Awaitable<ExpectedRows>(m_stmt->DoExecuteAsync(), m_stmt->m_event_loop);
+			}
+
+			/**
+			 * Binds arguments, executes the statement and decodes every row into @p T.
+			 * @tparam T std::tuple or aggregate struct (see RowDecoder / CellDecoder).
+			 * @param args Positional bind values.
+			 * @return Decoded rows or an error.
+			 */
+			template<typename T>
+			ExpectedVector<T> ExecuteAs(typename StatementParam<Args>::type... args) const {
+				if (!m_stmt)
+					return Unexpected<ExecuteError>("Statement handle is not prepared");
+				BindAll(std::index_sequence_for<Args...>{}, args...);
+				ExpectedVector<T> result = ReadAll<T>(m_stmt->DoExecuteReader());
+				m_stmt->Reset();
+				return result;
+			}
+
+			/**
+			 * @return true if the handle refers to a prepared statement.
+			 */
+			inline bool IsValid() const noexcept {
+				return m_stmt != nullptr;
+			}
+
+			/**
+			 * @return true if the handle refers to a prepared statement.
+			 */
+			inline explicit operator bool() const noexcept {
+				return IsValid();
+			}
+
+			/**
+			 * @return Underlying prepared statement (null if not prepared).
+			 */
+			inline PreparedSTMT* Get() const noexcept {
+				return m_stmt;
+			}
+
+		private:
+			PreparedSTMT* m_stmt = nullptr;		///< Registered statement (owned by Database)
+
+			template<std::size_t... I>
+			void BindAll(std::index_sequence<I...>, typename StatementParam<Args>::type... args) const {
+				(m_stmt->BindNative(static_cast<int>(I), args), ...);
+			}
+	};
+}
@@ -0,0 +1,47 @@
+#include <StormByte/database/statement_cache.hxx>
+
+using namespace StormByte::Database;
+
+PreparedSTMT* StatementCache::Find(std::string_view sql) {
+	auto it = m_index.find(sql);
+	if (it == m_index.end()) {
+		m_misses++;
+		return nullptr;
+	}
+	m_hits++;
+	m_entries.splice(m_entries.begin(), m_entries, it->second);
+	return it->second->stmt.get();
+}
+
+PreparedSTMT* StatementCache::Insert(std::string sql, std::unique_ptr<PreparedSTMT> stmt) {
+	m_entries.push_front({std::move(sql), std::move(stmt)});
+	// The key views the list node's string, which never moves
+	m_index[m_entries.front().sql] = m_entries.begin();
+	return m_entries.front().stmt.get();
+}
+
+std::unique_ptr<PreparedSTMT> StatementCache::PopLeastRecent() {
+	if (m_entries.empty())
+		return nullptr;
+	Entry& last = m_entries.back();
+	std::unique_ptr<PreparedSTMT> stmt = std::move(last.stmt);
+	m_index.erase(last.sql);
+	m_entries.pop_back();
+	m_evictions++;
+	return stmt;
+}
+
+void StatementCache::Clear() noexcept {
+	m_index.clear();
+	m_entries.clear();
+}
+
+StatementCacheStats StatementCache::Stats() const noexcept {
+	StatementCacheStats stats;
+	stats.size = m_entries.size();
+	stats.capacity = m_capacity;
+	stats.hits = m_hits;
+	stats.misses = m_misses;
+	stats.evictions = m_evictions;
+	return stats;
+}
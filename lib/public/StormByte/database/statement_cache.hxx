@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/database/prepared_stmt.hxx>
+#include <StormByte/database/visibility.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @struct StatementCacheStats
+	 * @brief Snapshot of StatementCache counters.
+	 */
+	struct StatementCacheStats {
+		std::size_t size = 0;				///< Cached statements
+		std::size_t capacity = 0;			///< Maximum cached statements (0 = caching disabled)
+		std::uint64_t hits = 0;				///< Lookups that found a cached statement
+		std::uint64_t misses = 0;			///< Lookups that had to prepare one
+		std::uint64_t evictions = 0;		///< Statements dropped to make room
+
+		/**
+		 * @return Fraction of lookups served from the cache (0..1).
+		 */
+		inline double HitRate() const noexcept {
+			const std::uint64_t lookups = hits + misses;
+			return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+		}
+	};
+
+	/**
+	 * @class StatementCache
+	 * @brief Bounded LRU map from SQL text to native prepared statements.
+	 *
+	 * Backs Database::Query(sql, args...). Lookups take a std::string_view, so a
+	 * hit neither copies nor allocates the SQL text.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC StatementCache {
+		public:
+			/**
+			 * @param capacity Maximum cached statements (0 disables caching).
+			 */
+			explicit StatementCache(std::size_t capacity = 128) noexcept
+				: m_capacity(capacity) {}
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			StatementCache(const StatementCache&) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			StatementCache(StatementCache&&) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~StatementCache() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			StatementCache& operator=(const StatementCache&) = delete;
+
+			/**
+			 * Move assignment.
+			 */
+			StatementCache& operator=(StatementCache&&) noexcept = default;
+
+			/**
+			 * Looks up @p sql and marks it most recently used. Counts a hit or a miss.
+			 * @param sql SQL text.
+			 * @return Cached statement, nullptr on a miss.
+			 */
+			PreparedSTMT* Find(std::string_view sql);
+
+			/**
+			 * Caches @p stmt under @p sql as the most recently used entry.
+			 * The caller makes room first (see Full() / PopLeastRecent()).
+			 * @param sql SQL text.
+			 * @param stmt Prepared statement.
+			 * @return The cached statement.
+			 */
+			PreparedSTMT* Insert(std::string sql, std::unique_ptr<PreparedSTMT> stmt);
+
+			/**
+			 * Removes the least recently used entry and counts an eviction.
+			 * @return The evicted statement, nullptr if empty.
+			 */
+			std::unique_ptr<PreparedSTMT> PopLeastRecent();
+
+			/**
+			 * @return true if inserting would exceed the capacity.
+			 */
+			inline bool Full() const noexcept {
+				return m_entries.size() >= m_capacity;
+			}
+
+			/**
+			 * Drops every entry without counting evictions (e.g. on disconnect).
+			 */
+			void Clear() noexcept;
+
+			/**
+			 * Sets the capacity. Callers evict the excess with PopLeastRecent().
+			 * @param capacity Maximum cached statements (0 disables caching).
+			 */
+			inline void SetCapacity(std::size_t capacity) noexcept {
+				m_capacity = capacity;
+			}
+
+			/**
+			 * @return Maximum cached statements.
+			 */
+			inline std::size_t Capacity() const noexcept {
+				return m_capacity;
+			}
+
+			/**
+			 * @return Number of cached statements.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_entries.size();
+			}
+
+			/**
+			 * Calls @p fn on every cached statement.
+			 * @param fn Callable taking PreparedSTMT&.
+			 */
+			template<typename F>
+			void ForEach(F&& fn) {
+				for (auto& entry : m_entries)
+					fn(*entry.stmt);
+			}
+
+			/**
+			 * @return Counter snapshot.
+			 */
+			StatementCacheStats Stats() const noexcept;
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief Cached statement and the SQL text keying it.
+			 */
+			struct Entry {
+				std::string sql;							///< Key (viewed by m_index)
+				std::unique_ptr<PreparedSTMT> stmt;			///< Native statement
+			};
+
+			std::size_t m_capacity;							///< Maximum entries
+			std::list<Entry> m_entries;						///< Most recently used first
+			std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index;	///< SQL text -> entry
+			std::uint64_t m_hits = 0;						///< Lookup hits
+			std::uint64_t m_misses = 0;						///< Lookup misses
+			std::uint64_t m_evictions = 0;					///< Evicted entries
+	};
+}
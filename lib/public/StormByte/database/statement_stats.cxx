@@ -0,0 +1,368 @@
+#include <StormByte/database/statement_stats.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <tuple>
+#include <utility>
+
+using namespace StormByte::Database;
+
+namespace {
+	thread_local StatementMetrics::Clock::time_point decode_mark{};	///< Set by BeginDecode() during Measure()
+	thread_local std::uint64_t decoded_bytes = 0;					///< Summed by AddDecodedBytes() during Measure()
+
+	std::uint64_t Nanoseconds(StatementMetrics::Clock::duration duration) noexcept {
+		const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+		return ns > 0 ? static_cast<std::uint64_t>(ns) : 0;
+	}
+
+	void AtomicMax(std::atomic<std::uint64_t>& target, std::uint64_t value) noexcept {
+		std::uint64_t current = target.load(std::memory_order_relaxed);
+		while (current < value && !target.compare_exchange_weak(current, value, std::memory_order_relaxed));
+	}
+
+	const char* KindName(StatementKind kind) noexcept {
+		return kind == StatementKind::Query ? "query" : "prepared";
+	}
+
+	/**
+	 * Appends @p text as a Prometheus label value (\\, " and newline escaped).
+	 */
+	void AppendLabel(std::string& out, std::string_view text) {
+		for (char c : text) {
+			switch (c) {
+				case '\\':	out += "\\\\"; break;
+				case '"':	out += "\\\""; break;
+				case '\n':	out += "\\n"; break;
+				default:	out += c;
+			}
+		}
+	}
+
+	/**
+	 * Appends @p text as a quoted JSON string.
+	 */
+	void AppendJsonString(std::string& out, std::string_view text) {
+		out += '"';
+		for (char c : text) {
+			switch (c) {
+				case '\\':	out += "\\\\"; break;
+				case '"':	out += "\\\""; break;
+				case '\n':	out += "\\n"; break;
+				case '\r':	out += "\\r"; break;
+				case '\t':	out += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20) {
+						char escaped[8];
+						std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+						out += escaped;
+					}
+					else
+						out += c;
+			}
+		}
+		out += '"';
+	}
+
+	void AppendSeconds(std::string& out, std::uint64_t ns) {
+		char buffer[32];
+		std::snprintf(buffer, sizeof(buffer), "%.9g", static_cast<double>(ns) / 1e9);
+		out += buffer;
+	}
+}
+
+std::size_t LatencyStats::BucketOf(std::uint64_t ns) noexcept {
+	if (ns < SubBuckets)
+		return static_cast<std::size_t>(ns);
+	const std::size_t exponent = static_cast<std::size_t>(std::bit_width(ns)) - 1;
+	const std::size_t sub = static_cast<std::size_t>(ns >> (exponent - SubBucketBits)) & (SubBuckets - 1);
+	return std::min(((exponent - SubBucketBits + 1) << SubBucketBits) | sub, Buckets - 1);
+}
+
+std::uint64_t LatencyStats::LowerBound(std::size_t bucket) noexcept {
+	if (bucket < SubBuckets)
+		return bucket;
+	const std::size_t exponent = (bucket >> SubBucketBits) + SubBucketBits - 1;
+	const std::uint64_t sub = bucket & (SubBuckets - 1);
+	return (SubBuckets + sub) << (exponent - SubBucketBits);
+}
+
+std::chrono::nanoseconds LatencyStats::Percentile(double quantile) const noexcept {
+	if (count == 0)
+		return std::chrono::nanoseconds(0);
+	const double clamped = std::clamp(quantile, 0.0, 1.0);
+	const std::uint64_t rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped * static_cast<double>(count))));
+	std::uint64_t seen = 0;
+	for (std::size_t bucket = 0; bucket < Buckets; ++bucket) {
+		seen += counts[bucket];
+		if (seen >= rank) {
+			const std::uint64_t upper = bucket + 1 < Buckets ? LowerBound(bucket + 1) - 1 : max_ns;
+			return std::chrono::nanoseconds(static_cast<std::int64_t>(std::min(upper, max_ns)));
+		}
+	}
+	return std::chrono::nanoseconds(static_cast<std::int64_t>(max_ns));
+}
+
+std::chrono::nanoseconds LatencyStats::Mean() const noexcept {
+	return std::chrono::nanoseconds(count == 0 ? 0 : static_cast<std::int64_t>(total_ns / count));
+}
+
+void LatencyStats::Merge(const LatencyStats& other) noexcept {
+	for (std::size_t bucket = 0; bucket < Buckets; ++bucket)
+		counts[bucket] += other.counts[bucket];
+	count += other.count;
+	total_ns += other.total_ns;
+	max_ns = std::max(max_ns, other.max_ns);
+}
+
+void StatementStats::Merge(const StatementStats& other) noexcept {
+	calls += other.calls;
+	errors += other.errors;
+	rows += other.rows;
+	bytes += other.bytes;
+	execute.Merge(other.execute);
+	decode.Merge(other.decode);
+}
+
+const StatementStats* DatabaseStats::Find(std::string_view name, StatementKind kind) const noexcept {
+	for (const StatementStats& stats : statements)
+		if (stats.kind == kind && stats.name == name)
+			return &stats;
+	return nullptr;
+}
+
+void DatabaseStats::Merge(const DatabaseStats& other) {
+	for (const StatementStats& stats : other.statements) {
+		auto it = std::find_if(statements.begin(), statements.end(), [&stats](const StatementStats& existing) {
+			return existing.kind == stats.kind && existing.name == stats.name;
+		});
+		if (it == statements.end())
+			statements.push_back(stats);
+		else
+			it->Merge(stats);
+	}
+	std::sort(statements.begin(), statements.end(), [](const StatementStats& a, const StatementStats& b) {
+		return std::tie(a.kind, a.name) < std::tie(b.kind, b.name);
+	});
+}
+
+std::string DatabaseStats::ToPrometheus(std::string_view prefix) const {
+	std::string out;
+	const auto labels = [&out](const StatementStats& stats) {
+		out += "{statement=\"";
+		AppendLabel(out, stats.name);
+		out += "\",kind=\"";
+		out += KindName(stats.kind);
+		out += '"';
+	};
+
+	const auto counter = [&](const char* name, const char* help, std::uint64_t StatementStats::*field) {
+		out.append("# HELP ").append(prefix).append("_statement_").append(name).append(" ").append(help).append("\n");
+		out.append("# TYPE ").append(prefix).append("_statement_").append(name).append(" counter\n");
+		for (const StatementStats& stats : statements) {
+			out.append(prefix).append("_statement_").append(name);
+			labels(stats);
+			out.append("} ").append(std::to_string(stats.*field)).append("\n");
+		}
+	};
+	counter("calls_total", "Statement executions.", &StatementStats::calls);
+	counter("errors_total", "Statement executions that failed.", &StatementStats::errors);
+	counter("rows_total", "Rows returned.", &StatementStats::rows);
+	counter("decoded_bytes_total", "Bytes of decoded values.", &StatementStats::bytes);
+
+	const auto histogram = [&](const char* name, const char* help, LatencyStats StatementStats::*field) {
+		out.append("# HELP ").append(prefix).append("_statement_").append(name).append(" ").append(help).append("\n");
+		out.append("# TYPE ").append(prefix).append("_statement_").append(name).append(" histogram\n");
+		for (const StatementStats& stats : statements) {
+			const LatencyStats& latency = stats.*field;
+			// Power-of-two bounds fall on bucket boundaries, so the cumulative counts are exact
+			std::uint64_t cumulative = 0;
+			std::size_t bucket = 0;
+			for (unsigned exponent = 10; exponent <= 34; exponent += 2) {
+				const std::size_t end = LatencyStats::BucketOf(std::uint64_t{1} << exponent);
+				for (; bucket < end; ++bucket)
+					cumulative += latency.counts[bucket];
+				out.append(prefix).append("_statement_").append(name).append("_bucket");
+				labels(stats);
+				out.append(",le=\"");
+				AppendSeconds(out, std::uint64_t{1} << exponent);
+				out.append("\"} ").append(std::to_string(cumulative)).append("\n");
+			}
+			out.append(prefix).append("_statement_").append(name).append("_bucket");
+			labels(stats);
+			out.append(",le=\"+Inf\"} ").append(std::to_string(latency.count)).append("\n");
+			out.append(prefix).append("_statement_").append(name).append("_sum");
+			labels(stats);
+			out.append("} ");
+			AppendSeconds(out, latency.total_ns);
+			out.append("\n");
+			out.append(prefix).append("_statement_").append(name).append("_count");
+			labels(stats);
+			out.append("} ").append(std::to_string(latency.count)).append("\n");
+		}
+	};
+	histogram("execute_seconds", "Time until the backend had the result.", &StatementStats::execute);
+	histogram("decode_seconds", "Time spent building rows from the result.", &StatementStats::decode);
+	return out;
+}
+
+std::string DatabaseStats::ToJson() const {
+	std::string out = "{\"statements\":[";
+	const auto phase = [&out](const char* name, const LatencyStats& latency) {
+		out.append("\"").append(name).append("\":{\"count\":").append(std::to_string(latency.count))
+			.append(",\"total_ns\":").append(std::to_string(latency.total_ns))
+			.append(",\"mean_ns\":").append(std::to_string(latency.Mean().count()))
+			.append(",\"max_ns\":").append(std::to_string(latency.max_ns))
+			.append(",\"p50_ns\":").append(std::to_string(latency.Percentile(0.5).count()))
+			.append(",\"p90_ns\":").append(std::to_string(latency.Percentile(0.9).count()))
+			.append(",\"p99_ns\":").append(std::to_string(latency.Percentile(0.99).count()))
+			.append("}");
+	};
+	bool first = true;
+	for (const StatementStats& stats : statements) {
+		if (!first)
+			out += ',';
+		first = false;
+		out += "{\"name\":";
+		AppendJsonString(out, stats.name);
+		out.append(",\"kind\":\"").append(KindName(stats.kind)).append("\"")
+			.append(",\"calls\":").append(std::to_string(stats.calls))
+			.append(",\"errors\":").append(std::to_string(stats.errors))
+			.append(",\"rows\":").append(std::to_string(stats.rows))
+			.append(",\"bytes\":").append(std::to_string(stats.bytes))
+			.append(",");
+		phase("execute", stats.execute);
+		out += ',';
+		phase("decode", stats.decode);
+		out += '}';
+	}
+	out += "]}";
+	return out;
+}
+
+void LatencyHistogram::Record(std::uint64_t ns) noexcept {
+	m_counts[LatencyStats::BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+	m_count.fetch_add(1, std::memory_order_relaxed);
+	m_total.fetch_add(ns, std::memory_order_relaxed);
+	AtomicMax(m_max, ns);
+}
+
+LatencyStats LatencyHistogram::Snapshot() const noexcept {
+	LatencyStats stats;
+	for (std::size_t bucket = 0; bucket < LatencyStats::Buckets; ++bucket)
+		stats.counts[bucket] = m_counts[bucket].load(std::memory_order_relaxed);
+	stats.count = m_count.load(std::memory_order_relaxed);
+	stats.total_ns = m_total.load(std::memory_order_relaxed);
+	stats.max_ns = m_max.load(std::memory_order_relaxed);
+	return stats;
+}
+
+void LatencyHistogram::Reset() noexcept {
+	for (auto& count : m_counts)
+		count.store(0, std::memory_order_relaxed);
+	m_count.store(0, std::memory_order_relaxed);
+	m_total.store(0, std::memory_order_relaxed);
+	m_max.store(0, std::memory_order_relaxed);
+}
+
+StatementMetrics::StatementMetrics(std::string name, StatementKind kind, SlowQueryLog* slow_log)
+	: m_name(std::move(name)), m_kind(kind), m_slow_log(slow_log) {}
+
+void StatementMetrics::BeginDecode() noexcept {
+	decode_mark = Clock::now();
+}
+
+void StatementMetrics::AddDecodedBytes(std::uint64_t bytes) noexcept {
+	decoded_bytes += bytes;
+}
+
+void StatementMetrics::ClearDecodeMark() noexcept {
+	decode_mark = Clock::time_point{};
+	decoded_bytes = 0;
+}
+
+StatementMetrics::Clock::time_point StatementMetrics::TakeDecodeMark() noexcept {
+	return std::exchange(decode_mark, Clock::time_point{});
+}
+
+std::uint64_t StatementMetrics::TakeDecodedBytes() noexcept {
+	return std::exchange(decoded_bytes, 0);
+}
+
+void StatementMetrics::Record(const ExpectedRows& result, Clock::time_point start, Clock::time_point decode, Clock::time_point end, std::uint64_t bytes) noexcept {
+	m_calls.fetch_add(1, std::memory_order_relaxed);
+	if (!result) {
+		m_errors.fetch_add(1, std::memory_order_relaxed);
+		m_execute.Record(Nanoseconds(end - start));
+		return;
+	}
+
+	// Without a mark inside the call (no result set, or a backend that does not mark) it all counts as execute
+	if (decode < start || decode > end)
+		decode = end;
+	m_execute.Record(Nanoseconds(decode - start));
+	m_decode.Record(Nanoseconds(end - decode));
+
+	m_rows.fetch_add(result->Count(), std::memory_order_relaxed);
+	m_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+StatementStats StatementMetrics::Snapshot() const {
+	StatementStats stats;
+	stats.name = m_name;
+	stats.kind = m_kind;
+	stats.calls = m_calls.load(std::memory_order_relaxed);
+	stats.errors = m_errors.load(std::memory_order_relaxed);
+	stats.rows = m_rows.load(std::memory_order_relaxed);
+	stats.bytes = m_bytes.load(std::memory_order_relaxed);
+	stats.execute = m_execute.Snapshot();
+	stats.decode = m_decode.Snapshot();
+	return stats;
+}
+
+void StatementMetrics::Reset() noexcept {
+	m_calls.store(0, std::memory_order_relaxed);
+	m_errors.store(0, std::memory_order_relaxed);
+	m_rows.store(0, std::memory_order_relaxed);
+	m_bytes.store(0, std::memory_order_relaxed);
+	m_execute.Reset();
+	m_decode.Reset();
+}
+
+StatementMetrics* StatsRegistry::Get(std::string_view name, StatementKind kind) {
+	std::lock_guard lock(m_mutex);
+	Map& map = kind == StatementKind::Query ? m_queries : m_prepared;
+	if (auto it = map.find(name); it != map.end())
+		return it->second.get();
+	if (kind == StatementKind::Query && map.size() >= MaxQueryEntries) {
+		if (auto it = map.find(OverflowName); it != map.end())
+			return it->second.get();
+		name = OverflowName;
+	}
+	auto metrics = std::make_unique<StatementMetrics>(std::string(name), kind, &m_slow_log);
+	return map.emplace(std::string(name), std::move(metrics)).first->second.get();
+}
+
+DatabaseStats StatsRegistry::Snapshot() const {
+	DatabaseStats stats;
+	{
+		std::lock_guard lock(m_mutex);
+		stats.statements.reserve(m_prepared.size() + m_queries.size());
+		for (const Map* map : {&m_prepared, &m_queries})
+			for (const auto& [name, metrics] : *map)
+				stats.statements.push_back(metrics->Snapshot());
+	}
+	std::sort(stats.statements.begin(), stats.statements.end(), [](const StatementStats& a, const StatementStats& b) {
+		return std::tie(a.kind, a.name) < std::tie(b.kind, b.name);
+	});
+	return stats;
+}
+
+void StatsRegistry::Reset() noexcept {
+	std::lock_guard lock(m_mutex);
+	for (Map* map : {&m_prepared, &m_queries})
+		for (auto& [name, metrics] : *map)
+			metrics->Reset();
+}
@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include <StormByte/database/rows.hxx>
+#include <StormByte/database/slow_query_log.hxx>
+#include <StormByte/database/typedefs.hxx>
+#include <StormByte/database/visibility.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Database
+ * @brief Contains classes and functions for database operations.
+ */
+namespace StormByte::Database {
+	/**
+	 * @enum StatementKind
+	 * @brief What a StatementStats entry is keyed by.
+	 */
+	enum class StatementKind: unsigned short {
+		Prepared = 0,	///< Named prepared statement (ExecuteSTMT(), Statement handles)
+		Query			///< SQL text of Query(), with or without arguments
+	};
+
+	/**
+	 * @struct LatencyStats
+	 * @brief Snapshot of a LatencyHistogram.
+	 *
+	 * Buckets are log-linear (HDR style): exact below 8 ns, then 8 buckets per
+	 * power of two, so any recorded value is within 12.5% of its bucket's bounds.
+	 * The range ends at 2^41 ns (about 37 minutes); longer samples are counted
+	 * in the last bucket.
+	 */
+	struct STORMBYTE_DATABASE_PUBLIC LatencyStats {
+		static constexpr std::size_t SubBucketBits = 3;								///< log2 of the buckets per power of two
+		static constexpr std::size_t SubBuckets = std::size_t{1} << SubBucketBits;	///< Buckets per power of two
+		static constexpr std::size_t Buckets = (42 - SubBucketBits) * SubBuckets;	///< Covers up to 2^41 ns
+
+		std::array<std::uint64_t, Buckets> counts{};	///< Samples per bucket
+		std::uint64_t count = 0;						///< Samples
+		std::uint64_t total_ns = 0;						///< Sum of the samples
+		std::uint64_t max_ns = 0;						///< Largest sample
+
+		/**
+		 * @param ns Sample in nanoseconds.
+		 * @return Bucket counting @p ns.
+		 */
+		static std::size_t BucketOf(std::uint64_t ns) noexcept;
+
+		/**
+		 * @param bucket Bucket index.
+		 * @return Smallest value counted in @p bucket, in nanoseconds.
+		 */
+		static std::uint64_t LowerBound(std::size_t bucket) noexcept;
+
+		/**
+		 * @param quantile Quantile in [0, 1] (0.99 for p99).
+		 * @return Upper bound of the bucket holding the quantile (capped at the
+		 * largest sample); zero without samples.
+		 */
+		std::chrono::nanoseconds Percentile(double quantile) const noexcept;
+
+		/**
+		 * @return Mean sample; zero without samples.
+		 */
+		std::chrono::nanoseconds Mean() const noexcept;
+
+		/**
+		 * Adds the samples of @p other (e.g. to aggregate pooled connections).
+		 * @param other Snapshot to add.
+		 */
+		void Merge(const LatencyStats& other) noexcept;
+	};
+
+	/**
+	 * @struct StatementStats
+	 * @brief Snapshot of one statement's counters.
+	 *
+	 * Execution time is split at the point the backend has the result and
+	 * starts building Rows: PQexecPrepared / PQexec, mysql_stmt_execute plus
+	 * mysql_stmt_store_result, or the first sqlite3_step. Since SQLite produces
+	 * rows lazily, its later steps count as decode time.
+	 */
+	struct STORMBYTE_DATABASE_PUBLIC StatementStats {
+		std::string name;									///< Statement name, or SQL text for StatementKind::Query
+		StatementKind kind = StatementKind::Prepared;		///< What name is
+		std::uint64_t calls = 0;							///< Executions
+		std::uint64_t errors = 0;							///< Executions that returned an error
+		std::uint64_t rows = 0;								///< Rows returned
+		std::uint64_t bytes = 0;							///< Bytes of decoded values (Value::PayloadSize())
+		LatencyStats execute;								///< Time until the result was available
+		LatencyStats decode;								///< Time spent building Rows (successful calls only)
+
+		/**
+		 * Adds the counters of @p other.
+		 * @param other Snapshot of the same statement on another connection.
+		 */
+		void Merge(const StatementStats& other) noexcept;
+	};
+
+	/**
+	 * @struct DatabaseStats
+	 * @brief Snapshot of every statement recorded by a Database.
+	 */
+	struct STORMBYTE_DATABASE_PUBLIC DatabaseStats {
+		std::vector<StatementStats> statements;		///< Sorted by kind, then name
+
+		/**
+		 * @param name Statement name or SQL text.
+		 * @param kind Entry kind.
+		 * @return Entry, nullptr if nothing was recorded for it.
+		 */
+		const StatementStats* Find(std::string_view name, StatementKind kind = StatementKind::Prepared) const noexcept;
+
+		/**
+		 * Adds the entries of @p other, merging those with the same name and kind.
+		 * @param other Snapshot of another connection.
+		 */
+		void Merge(const DatabaseStats& other);
+
+		/**
+		 * Renders the snapshot in the Prometheus text exposition format: counters
+		 * for calls, errors, rows and decoded bytes, and execute / decode
+		 * histograms in seconds with power-of-four bucket bounds from about
+		 * 1 µs to 17 s. Every series is labelled with statement and kind.
+		 * @param prefix Metric name prefix.
+		 * @return Exposition text.
+		 */
+		std::string ToPrometheus(std::string_view prefix = "stormbyte_database") const;
+
+		/**
+		 * Renders the snapshot as JSON: one object per statement with its
+		 * counters and, per phase, count, total / mean / max and p50 / p90 /
+		 * p99 in nanoseconds.
+		 * @return JSON text.
+		 */
+		std::string ToJson() const;
+	};
+
+	/**
+	 * @class LatencyHistogram
+	 * @brief Lock-free latency histogram (see LatencyStats for the buckets).
+	 *
+	 * Recording is a handful of relaxed atomic increments; snapshots may be taken
+	 * from any thread while samples are recorded.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC LatencyHistogram {
+		public:
+			/**
+			 * Records one sample.
+			 * @param ns Sample in nanoseconds.
+			 */
+			void Record(std::uint64_t ns) noexcept;
+
+			/**
+			 * @return Current counts.
+			 */
+			LatencyStats Snapshot() const noexcept;
+
+			/**
+			 * Clears every count.
+			 */
+			void Reset() noexcept;
+
+		private:
+			std::array<std::atomic<std::uint64_t>, LatencyStats::Buckets> m_counts{};	///< Samples per bucket
+			std::atomic<std::uint64_t> m_count{0};										///< Samples
+			std::atomic<std::uint64_t> m_total{0};										///< Sum of the samples
+			std::atomic<std::uint64_t> m_max{0};										///< Largest sample
+	};
+
+	/**
+	 * @class StatementMetrics
+	 * @brief Live counters of one statement, updated by PreparedSTMT::Execute() and Database::Query().
+	 *
+	 * A Database is used by one thread at a time, so its counters are written
+	 * without contention; they are relaxed atomics only so that Database::Stats()
+	 * can be read from another thread (a metrics endpoint) at any time.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC StatementMetrics {
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			/**
+			 * @param name Statement name or SQL text.
+			 * @param kind Entry kind.
+			 * @param slow_log Slow statement log checked after every execution (may be null).
+			 */
+			StatementMetrics(std::string name, StatementKind kind, SlowQueryLog* slow_log = nullptr);
+
+			/**
+			 * Runs @p execute, records its outcome and timings and reports it to
+			 * the slow statement log if it exceeded the threshold.
+			 * @param execute Callable returning ExpectedRows.
+			 * @param sql SQL text executed.
+			 * @param parameters Callable returning the bound parameters as a
+			 * std::vector<Value>; only called for slow executions.
+			 * @return What @p execute returned.
+			 */
+			template<typename F, typename P>
+			ExpectedRows Measure(F&& execute, const std::string& sql, P&& parameters) {
+				const Clock::time_point start = Clock::now();
+				ClearDecodeMark();
+				ExpectedRows result = execute();
+				const Clock::time_point end = Clock::now();
+				Record(result, start, TakeDecodeMark(), end, TakeDecodedBytes());
+				if (m_slow_log && m_slow_log->IsSlow(end - start)) {
+					const std::vector<Value> values = parameters();
+					m_slow_log->Report(m_kind == StatementKind::Prepared ? std::string_view(m_name) : std::string_view(), sql, values, end - start, !result);
+				}
+				return result;
+			}
+
+			/**
+			 * Called by backends once the result is available and Rows are about
+			 * to be built: splits the running Measure() into execute and decode.
+			 * Costs one clock read when nothing is measured.
+			 */
+			static void BeginDecode() noexcept;
+
+			/**
+			 * Called by backends once per result with the Value::PayloadSize()
+			 * they summed while building its rows, so the result is not walked again.
+			 * @param bytes Decoded payload bytes.
+			 */
+			static void AddDecodedBytes(std::uint64_t bytes) noexcept;
+
+			/**
+			 * @return Current counters.
+			 */
+			StatementStats Snapshot() const;
+
+			/**
+			 * Clears every counter.
+			 */
+			void Reset() noexcept;
+
+		private:
+			std::string m_name;								///< Statement name or SQL text
+			StatementKind m_kind;							///< Entry kind
+			std::atomic<std::uint64_t> m_calls{0};			///< Executions
+			std::atomic<std::uint64_t> m_errors{0};			///< Failed executions
+			std::atomic<std::uint64_t> m_rows{0};			///< Rows returned
+			std::atomic<std::uint64_t> m_bytes{0};			///< Decoded bytes
+			LatencyHistogram m_execute;						///< Execute phase
+			LatencyHistogram m_decode;						///< Decode phase
+			SlowQueryLog* m_slow_log;						///< Checked after every execution (may be null)
+
+			/**
+			 * Records one execution.
+			 * @param result Its result.
+			 * @param start When it started.
+			 * @param decode When decoding started (epoch if the backend did not say).
+			 * @param end When it returned.
+			 * @param bytes Payload bytes reported by the backend (AddDecodedBytes()).
+			 */
+			void Record(const ExpectedRows& result, Clock::time_point start, Clock::time_point decode, Clock::time_point end, std::uint64_t bytes) noexcept;
+
+			/**
+			 * Forgets the calling thread's decode mark and decoded bytes.
+			 */
+			static void ClearDecodeMark() noexcept;
+
+			/**
+			 * @return The calling thread's decode mark (epoch if unset).
+			 */
+			static Clock::time_point TakeDecodeMark() noexcept;
+
+			/**
+			 * @return The calling thread's decoded bytes since ClearDecodeMark(), reset to 0.
+			 */
+			static std::uint64_t TakeDecodedBytes() noexcept;
+	};
+
+	/**
+	 * @class StatsRegistry
+	 * @brief Owns the StatementMetrics of one Database.
+	 *
+	 * Entries live until the registry is destroyed, so statements keep plain
+	 * pointers to them and named statements keep their history across
+	 * reconnects. At most MaxQueryEntries distinct SQL texts get their own
+	 * entry; later ones share OverflowName.
+	 */
+	class STORMBYTE_DATABASE_PUBLIC StatsRegistry {
+		public:
+			static constexpr std::size_t MaxQueryEntries = 256;		///< Distinct StatementKind::Query entries
+			static constexpr std::string_view OverflowName = "(other)";	///< Entry shared by queries beyond MaxQueryEntries
+
+			/**
+			 * Finds or creates the entry for @p name.
+			 * @param name Statement name or SQL text.
+			 * @param kind Entry kind.
+			 * @return Entry (never null).
+			 */
+			StatementMetrics* Get(std::string_view name, StatementKind kind);
+
+			/**
+			 * @return Snapshot of every entry.
+			 */
+			DatabaseStats Snapshot() const;
+
+			/**
+			 * Clears the counters of every entry.
+			 */
+			void Reset() noexcept;
+
+			/**
+			 * @return Slow statement log shared by every entry.
+			 */
+			inline SlowQueryLog& SlowLog() noexcept {
+				return m_slow_log;
+			}
+
+			/**
+			 * @return Slow statement log shared by every entry.
+			 */
+			inline const SlowQueryLog& SlowLog() const noexcept {
+				return m_slow_log;
+			}
+
+		private:
+			/**
+			 * @struct NameHash
+			 * @brief Transparent hash so that lookups accept std::string_view.
+			 */
+			struct NameHash {
+				using is_transparent = void;
+				inline std::size_t operator()(std::string_view name) const noexcept {
+					return std::hash<std::string_view>{}(name);
+				}
+			};
+
+			using Map = std::unordered_map<std::string, std::unique_ptr<StatementMetrics>, NameHash, std::equal_to<>>;
+
+			mutable std::mutex m_mutex;		///< Guards the maps (not the counters)
+			Map m_prepared;					///< StatementKind::Prepared entries
+			Map m_queries;					///< StatementKind::Query entries
+			SlowQueryLog m_slow_log;		///< Checked by every entry
+	};
+}
@@ -23,7 +23,11 @@
 #include <StormByte/database/exception.hxx>
 
 #include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -32,13 +36,21 @@
  * @brief Database abstraction layer shared by all backends.
  */
 namespace StormByte::Database {
+	struct BatchResult;
+	class BlobStream;
+	class ColumnarRows;
+	class Cursor;
+	class Row;
+	class RowReader;
 	class Rows;
 
 	/**
 	 * @typedef ValuesVariant
-	 * @brief Variant holding supported column value types.
+	 * @brief Variant listing the types a Value can be read as (Value::Get<T>()).
 	 *
-	 * std::monostate represents SQL NULL.
+	 * std::monostate represents SQL NULL. std::string_view and
+	 * std::span<const std::byte> view text / blob payloads without copying
+	 * them. Value itself does not store this variant (see Value).
 	 */
 	using ValuesVariant = std::variant<
 		std::monostate,
@@ -49,7 +61,9 @@ namespace StormByte::Database {
 		double,
 		std::string,
 		bool,
-		std::vector<std::byte>
+		std::vector<std::byte>,
+		std::string_view,
+		std::span<const std::byte>
 	>;
 
 	/**
@@ -58,6 +72,50 @@ namespace StormByte::Database {
 	 */
 	using ExpectedRows = Expected<Rows, QueryException>;
 
+	/**
+	 * @typedef ExpectedRow
+	 * @brief Cursor fetch result: next Row, std::nullopt when exhausted, or QueryException.
+	 */
+	using ExpectedRow = Expected<std::optional<Row>, QueryException>;
+
+	/**
+	 * @typedef ExpectedColumnarRows
+	 * @brief Columnar query result: ColumnarRows or QueryException.
+	 */
+	using ExpectedColumnarRows = Expected<ColumnarRows, QueryException>;
+
+	/**
+	 * @typedef ExpectedCursor
+	 * @brief Streaming query result: Cursor or QueryException.
+	 */
+	using ExpectedCursor = Expected<Cursor, QueryException>;
+
+	/**
+	 * @typedef ExpectedRowReader
+	 * @brief Typed read result: backend RowReader (null when there is no result set) or QueryException.
+	 */
+	using ExpectedRowReader = Expected<std::unique_ptr<RowReader>, QueryException>;
+
+	/**
+	 * @typedef ExpectedBlobStream
+	 * @brief Blob open result: backend BlobStream or QueryException.
+	 */
+	using ExpectedBlobStream = Expected<std::unique_ptr<BlobStream>, QueryException>;
+
+	/**
+	 * @typedef ExpectedVector
+	 * @brief Typed query result: decoded rows or QueryException.
+	 * @tparam T std::tuple or aggregate struct.
+	 */
+	template<typename T>
+	using ExpectedVector = Expected<std::vector<T>, QueryException>;
+
+	/**
+	 * @typedef ExpectedBatch
+	 * @brief Batch execution result: BatchResult or QueryException (BatchError for a failing row).
+	 */
+	using ExpectedBatch = Expected<BatchResult, QueryException>;
+
 	/**
 	 * @enum SslMode
 	 * @brief TLS policy for network backends (MariaDB, PostgreSQL).
@@ -71,6 +129,16 @@ namespace StormByte::Database {
 		Require		///< Require TLS; connection fails if TLS cannot be established
 	};
 
+	/**
+	 * @enum ResultStorage
+	 * @brief Where Query() / ExecuteSTMT() results keep their text and blob payloads.
+	 */
+	enum class ResultStorage {
+		Owned,		///< Each Value owns its std::string / std::vector<std::byte>
+		Arena,		///< Payloads are packed into an Arena owned by the Rows; Values are views
+		Borrowed	///< Text Values view the backend's result buffer, kept alive by the Rows (PostgreSQL; Arena elsewhere)
+	};
+
 	/**
 	 * @enum IsolationLevel
 	 * @brief Transaction isolation level for BeginTransaction().
@@ -23,9 +23,17 @@
 #include <StormByte/database/typedefs.hxx>
 #include <StormByte/database/visibility.h>
 #include <StormByte/type_traits.hxx>
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <span>
+#include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 /**
  * @namespace Database
@@ -35,6 +43,14 @@ namespace StormByte::Database {
 	/**
 	 * @class Value
 	 * @brief Type-erased SQL value (NULL, integers, double, text, blob, bool).
+	 *
+	 * A Value takes 16 bytes and has no virtual functions: a one-byte tag
+	 * (type and storage) next to the payload. Scalars, and text / blobs of up
+	 * to InlineCapacity bytes, are stored inline; longer payloads are kept out
+	 * of line as a pointer and a length, either owned (one heap block) or
+	 * viewed (std::string_view / std::span constructors). A long std::string
+	 * or std::vector<std::byte> passed by rvalue is adopted as is, so its bytes
+	 * are never copied.
 	 */
 	class STORMBYTE_DATABASE_PUBLIC Value {
 		public:
@@ -49,71 +65,154 @@ namespace StormByte::Database {
 				LongInteger,			///< long int
 				UnsignedLongInteger,	///< unsigned long int
 				Double,					///< double
-				Text,					///< std::string
-				Blob,					///< std::vector<std::byte>
+				Text,					///< Text (owned or viewed)
+				Blob,					///< Binary data (owned or viewed)
 				Boolean					///< bool
 			};
 
+			/**
+			 * Longest text / blob stored inside the Value without allocating.
+			 */
+			static constexpr std::size_t InlineCapacity = 14;
+
 			/**
 			 * @name Constructors
 			 * @{
 			 */
-			Value() noexcept:
-			m_value(std::monostate{}), m_type(Type::Null) {}
+			Value() noexcept = default;
+
+			Value(int value) noexcept {
+				SetScalar(value, Type::Integer);
+			}
+
+			Value(unsigned int value) noexcept {
+				SetScalar(value, Type::UnsignedInteger);
+			}
 
-			Value(int value) noexcept:
-			m_value(value), m_type(Type::Integer) {}
+			Value(long int value) noexcept {
+				SetScalar(value, Type::LongInteger);
+			}
 
-			Value(unsigned int value) noexcept:
-			m_value(value), m_type(Type::UnsignedInteger) {}
+			Value(unsigned long int value) noexcept {
+				SetScalar(value, Type::UnsignedLongInteger);
+			}
 
-			Value(long int value) noexcept:
-			m_value(value), m_type(Type::LongInteger) {}
+			Value(double value) noexcept {
+				SetScalar(value, Type::Double);
+			}
 
-			Value(unsigned long int value) noexcept:
-			m_value(value), m_type(Type::UnsignedLongInteger) {}
+			Value(const std::string& value) {
+				SetOwned(value.data(), value.size(), Type::Text);
+			}
 
-			Value(double value) noexcept:
-			m_value(value), m_type(Type::Double) {}
+			/**
+			 * Short text is copied inline; longer text is adopted (the string is
+			 * moved to the heap, its characters are not copied).
+			 */
+			Value(std::string&& value) {
+				if (value.size() <= InlineCapacity)
+					SetOwned(value.data(), value.size(), Type::Text);
+				else
+					SetAdopted(new std::string(std::move(value)), Type::Text, Storage::String);
+			}
 
-			Value(const std::string& value) noexcept:
-			m_value(value), m_type(Type::Text) {}
+			Value(const char* value) {
+				SetOwned(value, std::strlen(value), Type::Text);
+			}
 
-			Value(std::string&& value) noexcept:
-			m_value(std::move(value)), m_type(Type::Text) {}
+			Value(const std::vector<std::byte>& value) {
+				SetOwned(value.data(), value.size(), Type::Blob);
+			}
 
-			Value(const char* value) noexcept:
-			Value(std::string(value)) {}
+			/**
+			 * Short blobs are copied inline; longer ones are adopted, like std::string&&.
+			 */
+			Value(std::vector<std::byte>&& value) {
+				if (value.size() <= InlineCapacity)
+					SetOwned(value.data(), value.size(), Type::Blob);
+				else
+					SetAdopted(new std::vector<std::byte>(std::move(value)), Type::Blob, Storage::Bytes);
+			}
 
-			Value(const std::vector<std::byte>& value) noexcept:
-			m_value(value), m_type(Type::Blob) {}
+			Value(bool value) noexcept {
+				SetScalar(value, Type::Boolean);
+			}
 
-			Value(std::vector<std::byte>&& value) noexcept:
-			m_value(std::move(value)), m_type(Type::Blob) {}
+			/**
+			 * Non-owning text; @p value must outlive this Value (see Detach()).
+			 */
+			explicit Value(std::string_view value) noexcept {
+				SetView(value.data(), value.size(), Type::Text);
+			}
 
-			Value(bool value) noexcept:
-			m_value(value), m_type(Type::Boolean) {}
+			/**
+			 * Non-owning blob; @p value must outlive this Value (see Detach()).
+			 */
+			explicit Value(std::span<const std::byte> value) noexcept {
+				SetView(value.data(), value.size(), Type::Blob);
+			}
 			/** @} */
 
 			/**
-			 * Copy constructor.
+			 * Owning text copied from @p value, without a std::string in between.
+			 * @param value Text to copy.
+			 * @return Text value.
+			 */
+			static Value CopyText(std::string_view value) {
+				Value result;
+				result.SetOwned(value.data(), value.size(), Type::Text);
+				return result;
+			}
+
+			/**
+			 * Owning blob copied from @p value, without a std::vector in between.
+			 * @param value Bytes to copy.
+			 * @return Blob value.
 			 */
-			Value(const Value&) = default;
+			static Value CopyBlob(std::span<const std::byte> value) {
+				Value result;
+				result.SetOwned(value.data(), value.size(), Type::Blob);
+				return result;
+			}
 
 			/**
-			 * Move constructor.
+			 * Copy constructor (duplicates an owned out-of-line payload into one heap block).
 			 */
-			Value(Value&&) noexcept = default;
+			Value(const Value& other) {
+				if (other.OwnsOutOfLine())
+					SetOwned(other.Data(), other.Size(), other.Kind());
+				else
+					CopyFields(other);
+			}
+
+			/**
+			 * Move constructor; @p other becomes NULL.
+			 */
+			Value(Value&& other) noexcept {
+				CopyFields(other);
+				other.SetTag(Type::Null, Storage::Inline);
+			}
 
 			/**
 			 * Copy assignment.
 			 */
-			Value& operator=(const Value&) = default;
+			Value& operator=(const Value& other) {
+				if (this != &other)
+					*this = Value(other);
+				return *this;
+			}
 
 			/**
-			 * Move assignment.
+			 * Move assignment; @p other becomes NULL.
 			 */
-			Value& operator=(Value&&) noexcept = default;
+			Value& operator=(Value&& other) noexcept {
+				if (this != &other) {
+					Release();
+					CopyFields(other);
+					other.SetTag(Type::Null, Storage::Inline);
+				}
+				return *this;
+			}
 
 			/**
 			 * Equality comparison (stored values).
@@ -121,7 +220,19 @@ namespace StormByte::Database {
 			 * @return true if equal.
 			 */
 			inline bool operator==(const Value& other) const noexcept {
-				return m_value == other.m_value;
+				if (Kind() != other.Kind())
+					return false;
+				return Visit([&other](const auto& val) -> bool {
+					using T = std::decay_t<decltype(val)>;
+					if constexpr (std::is_same_v<T, std::monostate>)
+						return true;
+					else if constexpr (std::is_same_v<T, std::string_view>)
+						return val == other.TextView();
+					else if constexpr (std::is_same_v<T, std::span<const std::byte>>)
+						return std::ranges::equal(val, other.BlobView());
+					else
+						return val == other.Load<T>();
+				});
 			}
 
 			/**
@@ -136,7 +247,9 @@ namespace StormByte::Database {
 			/**
 			 * Destructor.
 			 */
-			virtual ~Value() noexcept = default;
+			~Value() noexcept {
+				Release();
+			}
 
 			/**
 			 * Retrieves the stored value as type @p T, with safe numeric conversions.
@@ -148,35 +261,256 @@ namespace StormByte::Database {
 			requires StormByte::Type::VariantHasType<ValuesVariant, std::decay_t<T>>
 			std::decay_t<T> Get() const {
 				using To = std::decay_t<T>;
-				return std::visit([](auto&& val) -> To {
+				return Visit([](const auto& val) -> To {
 					using From = std::decay_t<decltype(val)>;
 					if constexpr (std::is_same_v<From, std::monostate>) {
 						throw WrongValueType("Requested type does not match stored type (null).");
 					} else if constexpr (std::is_same_v<From, To>) {
 						return val;
+					} else if constexpr (std::is_same_v<From, std::string_view> &&
+										 (std::is_same_v<To, std::string> || std::is_same_v<To, std::string_view>)) {
+						return To(val);
+					} else if constexpr (std::is_same_v<From, std::span<const std::byte>> &&
+										 (std::is_same_v<To, std::vector<std::byte>> || std::is_same_v<To, std::span<const std::byte>>)) {
+						return To(val.begin(), val.end());
 					} else if constexpr (std::is_arithmetic_v<From> && std::is_arithmetic_v<To>) {
 						return convert_numeric<To, From>(val);
 					} else {
 						throw WrongValueType("Requested type does not match stored type.");
 					}
-				}, m_value);
+				});
 			}
 
 			/**
 			 * @return Discriminator of the stored alternative.
 			 */
-			inline Type Type() const noexcept {
-				return m_type;
+			inline enum Type Type() const noexcept {
+				return Kind();
 			}
 
 			/**
 			 * @return true if the value is SQL NULL.
 			 */
 			inline bool IsNull() const noexcept {
-				return m_type == Type::Null;
+				return Kind() == Type::Null;
+			}
+
+			/**
+			 * @return true if the value is a non-owning text / blob view.
+			 */
+			inline bool IsView() const noexcept {
+				return StorageKind() == Storage::View;
+			}
+
+			/**
+			 * Replaces a text / blob view with an owning copy; no-op otherwise.
+			 * Use it on values that must outlive the storage they view.
+			 */
+			inline void Detach() {
+				// Views own nothing, so there is nothing to release first
+				if (IsView())
+					SetOwned(Data(), Size(), Kind());
+			}
+
+			/**
+			 * @return Bytes of stored data: the text / blob length, the scalar's
+			 * size, 0 for NULL.
+			 */
+			inline std::size_t PayloadSize() const noexcept {
+				switch (Kind()) {
+					case Type::Null:				return 0;
+					case Type::Integer:				return sizeof(int);
+					case Type::UnsignedInteger:		return sizeof(unsigned int);
+					case Type::LongInteger:			return sizeof(long int);
+					case Type::UnsignedLongInteger:	return sizeof(unsigned long int);
+					case Type::Double:				return sizeof(double);
+					case Type::Boolean:				return sizeof(bool);
+					default:						return Size();
+				}
 			}
 
 		private:
+			/**
+			 * @enum Storage
+			 * @brief Where a text / blob payload lives (scalars are always Inline).
+			 */
+			enum class Storage: std::uint8_t {
+				Inline = 0,		///< In m_bytes
+				Heap,			///< Owned block at the stored pointer
+				View,			///< Caller-owned bytes at the stored pointer
+				String,			///< Adopted std::string at the stored pointer
+				Bytes			///< Adopted std::vector<std::byte> at the stored pointer
+			};
+
+			// Out of line payloads: pointer at 0, 48-bit length at 8 (low 32) and 12 (high 16)
+			static constexpr std::size_t LengthOffset = sizeof(const std::byte*);
+
+			alignas(8) std::byte m_bytes[InlineCapacity];	///< Scalar, inline payload or pointer + length
+			std::uint8_t m_inline_size = 0;					///< Length of an inline payload
+			std::uint8_t m_tag = 0;							///< Type (low nibble) and Storage (high nibble); 0 = inline NULL
+
+			inline enum Type Kind() const noexcept {
+				return static_cast<enum Type>(m_tag & 0x0F);
+			}
+
+			inline Storage StorageKind() const noexcept {
+				return static_cast<Storage>(m_tag >> 4);
+			}
+
+			inline void SetTag(enum Type type, Storage storage) noexcept {
+				m_tag = static_cast<std::uint8_t>(static_cast<unsigned>(type) | (static_cast<unsigned>(storage) << 4));
+			}
+
+			template<typename T>
+			inline T Load(std::size_t offset = 0) const noexcept {
+				T value;
+				std::memcpy(&value, m_bytes + offset, sizeof(T));
+				return value;
+			}
+
+			template<typename T>
+			inline void Store(const T& value, std::size_t offset = 0) noexcept {
+				std::memcpy(m_bytes + offset, &value, sizeof(T));
+			}
+
+			template<typename T>
+			inline void SetScalar(T value, enum Type type) noexcept {
+				Store(value);
+				m_inline_size = 0;
+				SetTag(type, Storage::Inline);
+			}
+
+			/**
+			 * Stores @p data out of line without taking ownership.
+			 */
+			inline void SetView(const void* data, std::size_t size, enum Type type) noexcept {
+				Store(static_cast<const std::byte*>(data));
+				Store(static_cast<std::uint32_t>(size), LengthOffset);
+				Store(static_cast<std::uint16_t>(static_cast<std::uint64_t>(size) >> 32), LengthOffset + 4);
+				m_inline_size = 0;
+				SetTag(type, Storage::View);
+			}
+
+			/**
+			 * Copies @p data inline, or into an owned heap block if it is longer
+			 * than InlineCapacity. Does not release a previous payload.
+			 */
+			inline void SetOwned(const void* data, std::size_t size, enum Type type) {
+				if (size <= InlineCapacity) {
+					if (size > 0)
+						std::memcpy(m_bytes, data, size);
+					m_inline_size = static_cast<std::uint8_t>(size);
+					SetTag(type, Storage::Inline);
+				}
+				else {
+					std::byte* block = new std::byte[size];
+					std::memcpy(block, data, size);
+					SetView(block, size, type);
+					SetTag(type, Storage::Heap);
+				}
+			}
+
+			/**
+			 * Stores an adopted container; its data and size are read through it.
+			 */
+			template<typename T>
+			inline void SetAdopted(const T* owner, enum Type type, Storage storage) noexcept {
+				Store(owner);
+				m_inline_size = 0;
+				SetTag(type, storage);
+			}
+
+			/**
+			 * @return true if the payload is out of line and owned by this Value.
+			 */
+			inline bool OwnsOutOfLine() const noexcept {
+				const Storage storage = StorageKind();
+				return storage == Storage::Heap || storage == Storage::String || storage == Storage::Bytes;
+			}
+
+			/**
+			 * Frees an owned out-of-line payload.
+			 */
+			inline void Release() noexcept {
+				switch (StorageKind()) {
+					case Storage::Heap:		delete[] Load<const std::byte*>(); break;
+					case Storage::String:	delete Load<const std::string*>(); break;
+					case Storage::Bytes:	delete Load<const std::vector<std::byte>*>(); break;
+					default:				break;
+				}
+			}
+
+			inline void CopyFields(const Value& other) noexcept {
+				std::memcpy(m_bytes, other.m_bytes, sizeof(m_bytes));
+				m_inline_size = other.m_inline_size;
+				m_tag = other.m_tag;
+			}
+
+			/**
+			 * @return Start of the text / blob payload.
+			 */
+			inline const std::byte* Data() const noexcept {
+				switch (StorageKind()) {
+					case Storage::Inline:	return m_bytes;
+					case Storage::String:	return reinterpret_cast<const std::byte*>(Load<const std::string*>()->data());
+					case Storage::Bytes:	return Load<const std::vector<std::byte>*>()->data();
+					default:				return Load<const std::byte*>();
+				}
+			}
+
+			/**
+			 * @return Length of the text / blob payload.
+			 */
+			inline std::size_t Size() const noexcept {
+				switch (StorageKind()) {
+					case Storage::Inline:	return m_inline_size;
+					case Storage::String:	return Load<const std::string*>()->size();
+					case Storage::Bytes:	return Load<const std::vector<std::byte>*>()->size();
+					default:				break;
+				}
+				return static_cast<std::size_t>(Load<std::uint32_t>(LengthOffset) | (static_cast<std::uint64_t>(Load<std::uint16_t>(LengthOffset + 4)) << 32));
+			}
+
+			/**
+			 * @return Text payload (owned or viewed); empty for other types.
+			 */
+			inline std::string_view TextView() const noexcept {
+				if (Kind() != Type::Text)
+					return {};
+				return std::string_view(reinterpret_cast<const char*>(Data()), Size());
+			}
+
+			/**
+			 * @return Blob payload (owned or viewed); empty for other types.
+			 */
+			inline std::span<const std::byte> BlobView() const noexcept {
+				if (Kind() != Type::Blob)
+					return {};
+				return std::span<const std::byte>(Data(), Size());
+			}
+
+			/**
+			 * Calls @p visitor with the stored value: std::monostate for NULL,
+			 * the scalar type, std::string_view for text, std::span for blobs.
+			 * @param visitor Callable accepting every alternative.
+			 * @return What @p visitor returns.
+			 */
+			template<typename F>
+			std::invoke_result_t<F&, std::monostate> Visit(F&& visitor) const {
+				switch (Kind()) {
+					case Type::Integer:				return visitor(Load<int>());
+					case Type::UnsignedInteger:		return visitor(Load<unsigned int>());
+					case Type::LongInteger:			return visitor(Load<long int>());
+					case Type::UnsignedLongInteger:	return visitor(Load<unsigned long int>());
+					case Type::Double:				return visitor(Load<double>());
+					case Type::Text:				return visitor(TextView());
+					case Type::Blob:				return visitor(BlobView());
+					case Type::Boolean:				return visitor(Load<bool>());
+					case Type::Null:
+					default:						return visitor(std::monostate{});
+				}
+			}
+
 			/**
 			 * Safe numeric conversion between arithmetic types.
 			 * @tparam To Destination type.
@@ -236,8 +570,7 @@ namespace StormByte::Database {
 					throw WrongValueType("Unsupported numeric conversion.");
 				}
 			}
-
-			ValuesVariant m_value;	///< Internal storage
-			enum Type m_type;		///< Discriminator
 	};
+
+	static_assert(sizeof(Value) == 16, "Value must stay 16 bytes");
 }
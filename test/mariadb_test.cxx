@@ -1,11 +1,19 @@
 #include <StormByte/database/mariadb/mariadb.hxx>
+#include <StormByte/database/reactor.hxx>
 #include <StormByte/database/transaction.hxx>
 #include <StormByte/logger/log.hxx>
 #include <StormByte/logger/threaded_log.hxx>
 #include <StormByte/test_handlers.h>
 
+#include <coroutine>
+#include <exception>
+#include <future>
 #include <memory>
 #include <iostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <tuple>
 #include <vector>
 #include <thread>
 #include <chrono>
@@ -16,11 +24,30 @@ using namespace StormByte::Database::MariaDB;
 using StormByte::Database::IsolationLevel;
 using StormByte::Database::Transaction;
 using StormByte::Database::ColumnNotFound;
+using StormByte::Database::ColumnRef;
+using StormByte::Database::StatementKind;
+using StormByte::Database::SlowQueryOptions;
 using StormByte::Database::SslMode;
+using StormByte::Database::BatchError;
+using StormByte::Database::Reactor;
+using StormByte::Database::BlobLocation;
 
 std::shared_ptr<StormByte::Logger::Log> logger =
 	std::make_shared<StormByte::Logger::ThreadedLog>(std::cout, StormByte::Logger::Level::Info);
 
+/**
+ * Fire-and-forget coroutine used to drive co_await from plain test functions.
+ */
+struct DetachedTask {
+	struct promise_type {
+		DetachedTask get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
 class TestDatabase : public MariaDB {
 	public:
 		TestDatabase()
@@ -28,6 +55,11 @@ class TestDatabase : public MariaDB {
 			SetSslMode(SslMode::Disable);
 		}
 
+		explicit TestDatabase(std::shared_ptr<StormByte::Logger::Log> log)
+			: MariaDB("127.0.0.1", "testuser", "testpass", "stormbyte_test", 3306, std::move(log)) {
+			SetSslMode(SslMode::Disable);
+		}
+
 		const ExpectedRows get_users() { return ExecuteSTMT("select_users"); }
 		const ExpectedRows get_products() { return ExecuteSTMT("select_products"); }
 		const ExpectedRows get_orders() { return ExecuteSTMT("select_orders"); }
@@ -74,6 +106,8 @@ class TestDatabase : public MariaDB {
 			DoPrepareSTMT("select_nulls", "SELECT value FROM nulls;");
 			DoPrepareSTMT("insert_concurrent", "INSERT INTO concurrent (value) VALUES (?);");
 			DoPrepareSTMT("count_concurrent", "SELECT COUNT(*) FROM concurrent;");
+			DoPrepareSTMT("insert_user", "INSERT INTO users (name, email) VALUES (?, ?);");
+			DoPrepareSTMT("count_users", "SELECT COUNT(*) FROM users;");
 		}
 };
 
@@ -352,6 +386,150 @@ int name_access_missing_column() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int column_ref_test() {
+	const std::string fn_name = "column_ref_test";
+	TestDatabase db;
+	db.Connect();
+	auto first = db.get_users();
+	ASSERT_TRUE(fn_name, first.has_value());
+	const ColumnRef email = first.value().Column("email");
+	ASSERT_EQUAL(fn_name, "bob@example.com", first.value()[1][email].Get<std::string>());
+
+	// The reference stays valid for later executions of the statement
+	auto second = db.get_users();
+	ASSERT_TRUE(fn_name, second.has_value());
+	ASSERT_EQUAL(fn_name, "alice@example.com", second.value()[0][email].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "Alice", second.value()[0][std::string_view("name")].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_stats_test() {
+	const std::string fn_name = "statement_stats_test";
+	TestDatabase db;
+	db.Connect();
+	db.ResetStats();
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	const std::string count_sql = "SELECT COUNT(*) FROM users;";
+	ASSERT_TRUE(fn_name, db.Query(count_sql).has_value());
+
+	const auto stats = db.Stats();
+	const auto* users = stats.Find("select_users");
+	ASSERT_TRUE(fn_name, users != nullptr);
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(users->calls));
+	ASSERT_EQUAL(fn_name, 4, static_cast<int>(users->rows));
+	ASSERT_EQUAL(fn_name, 80, static_cast<int>(users->bytes));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(users->decode.count));
+	const auto* count = stats.Find(count_sql, StatementKind::Query);
+	ASSERT_TRUE(fn_name, count != nullptr);
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(count->calls));
+	ASSERT_TRUE(fn_name, stats.ToPrometheus().find("statement=\"select_users\",kind=\"prepared\"} 2\n") != std::string::npos);
+	RETURN_TEST(fn_name, 0);
+}
+
+int slow_query_log_test() {
+	const std::string fn_name = "slow_query_log_test";
+	std::ostringstream output;
+	TestDatabase db(std::make_shared<StormByte::Logger::Log>(output, StormByte::Logger::Level::Warning));
+	db.Connect();
+	SlowQueryOptions options;
+	options.threshold = std::chrono::nanoseconds(1);
+	options.plan_interval = std::chrono::milliseconds(0);
+	db.SetSlowQueryOptions(options);
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(db.SlowQueries().plans));
+	ASSERT_TRUE(fn_name, output.str().find("Slow statement 'select_users' took ") != std::string::npos);
+	ASSERT_TRUE(fn_name, output.str().find("\"query_block\"") != std::string::npos);
+
+	// A statement EXPLAIN rejects leaves the surrounding transaction usable
+	{
+		auto tx = db.BeginTransaction();
+		ASSERT_TRUE(fn_name, db.Query("SET @stormbyte_slow = 1;").has_value());
+		ASSERT_TRUE(fn_name, db.get_users().has_value());
+		tx.Commit();
+	}
+	const auto slow = db.SlowQueries();
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(slow.reported));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(slow.plans));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(slow.plan_errors));
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_batch_test() {
+	const std::string fn_name = "execute_batch_test";
+	TestDatabase db;
+	db.Connect();
+
+	// Array execution reports the total only; a failure is reported for the whole batch
+	std::vector<std::tuple<std::string, std::string>> users;
+	for (int i = 0; i < 1000; ++i)
+		users.emplace_back("user" + std::to_string(i), "user" + std::to_string(i) + "@example.com");
+	auto batch = db.ExecuteBatch("insert_user", users);
+	ASSERT_TRUE(fn_name, batch.has_value());
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(batch->rows));
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(batch->total_affected));
+	ASSERT_TRUE(fn_name, batch->affected.empty() || static_cast<int>(batch->affected.size()) == 1000);
+
+	// A duplicate email fails the batch and nothing is kept
+	std::vector<std::tuple<std::string, std::string>> duplicates{
+		{"Carol", "carol@example.com"}, {"Dave", "dave@example.com"}, {"Eve", "alice@example.com"}, {"Frank", "frank@example.com"}};
+	auto failed = db.ExecuteBatch("insert_user", duplicates);
+	ASSERT_FALSE(fn_name, failed.has_value());
+	auto error = std::dynamic_pointer_cast<BatchError>(failed.error());
+	ASSERT_TRUE(fn_name, error != nullptr);
+
+	auto count = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, count.has_value());
+	ASSERT_EQUAL(fn_name, 1002, static_cast<int>(count.value()[0][0].Get<long int>()));
+
+	// The statement is usable after a failed batch
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", "Zed", "zed@example.com").has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int query_stream_test() {
+	const std::string fn_name = "query_stream_test";
+	TestDatabase db;
+	db.Connect();
+	auto cursor = db.QueryStream("SELECT name FROM users ORDER BY id;");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	auto first = cursor->Next();
+	ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+	ASSERT_EQUAL(fn_name, "Alice", (**first)["name"].Get<std::string>());
+	auto second = cursor->Next();
+	ASSERT_TRUE(fn_name, second.has_value() && second->has_value());
+	auto end = cursor->Next();
+	ASSERT_TRUE(fn_name, end.has_value() && !end->has_value());
+	ASSERT_TRUE(fn_name, cursor->Done());
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_stream_test() {
+	const std::string fn_name = "execute_stream_test";
+	TestDatabase db;
+	db.Connect();
+	{
+		// Abandon the cursor after one row; the connection must be usable afterwards
+		auto cursor = db.ExecuteSTMTStream("select_users");
+		ASSERT_TRUE(fn_name, cursor.has_value());
+		auto first = cursor->Next();
+		ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+	}
+	auto cursor = db.ExecuteSTMTStream("select_users");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	int count = 0;
+	while (true) {
+		auto row = cursor->Next();
+		ASSERT_TRUE(fn_name, row.has_value());
+		if (!row->has_value()) break;
+		++count;
+	}
+	ASSERT_EQUAL(fn_name, 2, count);
+	auto rows = db.Query("SELECT COUNT(*) FROM users;");
+	ASSERT_TRUE(fn_name, rows.has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
 int transaction_commit_test() {
 	const std::string fn_name = "transaction_commit_test";
 	TestDatabase db;
@@ -461,6 +639,225 @@ int concurrent_multiple_connections() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int async_query_test() {
+	const std::string fn_name = "async_query_test";
+	constexpr int num_connections = 4;
+
+	std::vector<std::unique_ptr<ConcurrentDatabase>> dbs;
+	for (int i = 0; i < num_connections; ++i) {
+		dbs.push_back(std::make_unique<ConcurrentDatabase>());
+		dbs.back()->Connect();
+	}
+	dbs.front()->SilentQuery("DELETE FROM concurrent;");
+
+	// Every connection sleeps server-side at the same time, so the whole run
+	// should take about one sleep rather than one per connection
+	std::vector<std::promise<bool>> promises(num_connections);
+	std::vector<std::future<bool>> futures;
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < num_connections; ++i) {
+		futures.push_back(promises[i].get_future());
+		[](ConcurrentDatabase& db, int value, std::promise<bool>& done) -> DetachedTask {
+			auto slept = co_await db.QueryAsync("SELECT SLEEP(0.3);");
+			auto inserted = co_await db.ExecuteAsync("insert_concurrent", value);
+			done.set_value(slept.has_value() && slept->size() == 1 && inserted.has_value());
+		}(*dbs[i], i, promises[i]);
+	}
+	for (auto& future : futures) {
+		ASSERT_TRUE(fn_name, future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+		ASSERT_TRUE(fn_name, future.get());
+	}
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	ASSERT_TRUE(fn_name, elapsed < std::chrono::milliseconds(250 * num_connections));
+
+	auto rows = dbs.front()->ExecuteSTMT("count_concurrent");
+	ASSERT_TRUE(fn_name, rows.has_value());
+	ASSERT_EQUAL(fn_name, num_connections, rows.value()[0][0].Get<int>());
+
+	auto error = [&]() {
+		std::promise<bool> failed;
+		auto result = failed.get_future();
+		[](ConcurrentDatabase& db, std::promise<bool>& failed) -> DetachedTask {
+			auto res = co_await db.QueryAsync("SELECT * FROM missing_table;");
+			failed.set_value(!res.has_value());
+		}(*dbs.front(), failed);
+		return result.get();
+	}();
+	ASSERT_TRUE(fn_name, error);
+	ASSERT_TRUE(fn_name, dbs.front()->ExecuteSTMT("count_concurrent").has_value());
+	dbs.front()->SilentQuery("DELETE FROM concurrent;");
+	RETURN_TEST(fn_name, 0);
+}
+
+int reactor_test() {
+	const std::string fn_name = "reactor_test";
+	constexpr int num_connections = 8;
+	Reactor reactor;
+	for (int i = 0; i < num_connections; ++i) {
+		auto db = std::make_unique<ConcurrentDatabase>();
+		db->Connect();
+		reactor.Add(std::move(db));
+	}
+
+	// One thread drives every connection; the sleeps overlap on the server
+	int succeeded = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (Reactor::ConnectionId id = 0; id < reactor.Size(); ++id) {
+		[](Reactor& reactor, Reactor::ConnectionId id, int& succeeded) -> DetachedTask {
+			auto slept = co_await reactor.QueryAsync(id, "SELECT SLEEP(0.3);");
+			auto counted = co_await reactor.ExecuteAsync(id, "count_concurrent");
+			if (slept && counted)
+				succeeded++;
+		}(reactor, id, succeeded);
+	}
+	while (succeeded < num_connections && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+		reactor.RunOnce(std::chrono::milliseconds(100));
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	ASSERT_EQUAL(fn_name, num_connections, succeeded);
+	ASSERT_TRUE(fn_name, elapsed < std::chrono::milliseconds(200 * num_connections));
+
+	for (Reactor::ConnectionId id = 0; id < reactor.Size(); ++id) {
+		auto stats = reactor.Stats(id);
+		ASSERT_EQUAL(fn_name, 2, static_cast<int>(stats.completed));
+		ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.failed));
+		ASSERT_TRUE(fn_name, stats.max_latency >= std::chrono::milliseconds(300));
+	}
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_cache_test() {
+	const std::string fn_name = "statement_cache_test";
+	TestDatabase db;
+	db.Connect();
+
+	auto alice = db.Query("SELECT name FROM users WHERE id = ?;", 1);
+	auto bob = db.Query("SELECT name FROM users WHERE id = ?;", 2);
+	ASSERT_TRUE(fn_name, alice.has_value());
+	ASSERT_TRUE(fn_name, bob.has_value());
+	ASSERT_EQUAL(fn_name, "Bob", (*bob)[0][0].Get<std::string>());
+	auto stats = db.CacheStats();
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.size));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.hits));
+	ASSERT_FALSE(fn_name, db.Query("SELECT * FROM missing_table WHERE id = ?;", 1).has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(db.CacheStats().size));
+	RETURN_TEST(fn_name, 0);
+}
+
+int stmt_buffer_reuse_test() {
+	const std::string fn_name = "stmt_buffer_reuse_test";
+	TestDatabase db;
+	db.Connect();
+
+	// Same statement, alternating parameters and result lengths
+	for (int i = 0; i < 10; ++i) {
+		auto row = db.Query("SELECT name, email FROM users WHERE id = ?;", 1 + i % 2);
+		ASSERT_TRUE(fn_name, row.has_value());
+		ASSERT_EQUAL(fn_name, 1, static_cast<int>(row->Count()));
+		ASSERT_EQUAL(fn_name, i % 2 ? "bob@example.com" : "alice@example.com", (*row)[0][1].Get<std::string>());
+	}
+
+	// NULL then non-NULL through the same input buffers
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_null", nullptr).has_value());
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_null", std::string("reused")).has_value());
+
+	// A failed execution (duplicate email) must not poison the next one
+	auto before = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, before.has_value());
+	ASSERT_FALSE(fn_name, db.ExecuteSTMT("insert_user", std::string("Eve"), std::string("alice@example.com")).has_value());
+	auto after = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, after.has_value());
+	ASSERT_EQUAL(fn_name, (*before)[0][0].Get<long int>(), (*after)[0][0].Get<long int>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int large_column_test() {
+	const std::string fn_name = "large_column_test";
+	TestDatabase db;
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.Query("CREATE TEMPORARY TABLE large_columns (id INT PRIMARY KEY, body LONGTEXT, data LONGBLOB);").has_value());
+
+	// Below the initial buffer, above it, and above the largest bound buffer
+	const std::vector<std::size_t> sizes = {5, 5000, 300000};
+	for (std::size_t i = 0; i < sizes.size(); ++i) {
+		const std::string body(sizes[i], static_cast<char>('a' + i));
+		const std::vector<std::byte> data(sizes[i], static_cast<std::byte>(i + 1));
+		ASSERT_TRUE(fn_name, db.Query("INSERT INTO large_columns (id, body, data) VALUES (?, ?, ?);", static_cast<int>(i), body, data).has_value());
+	}
+
+	auto rows = db.Query("SELECT body, data FROM large_columns WHERE id >= ? ORDER BY id;", 0);
+	ASSERT_TRUE(fn_name, rows.has_value());
+	ASSERT_EQUAL(fn_name, sizes.size(), rows->Count());
+	for (std::size_t i = 0; i < sizes.size(); ++i) {
+		ASSERT_EQUAL(fn_name, std::string(sizes[i], static_cast<char>('a' + i)), (*rows)[i][0].Get<std::string>());
+		ASSERT_EQUAL(fn_name, sizes[i], (*rows)[i][1].Get<std::vector<std::byte>>().size());
+	}
+
+	// Point lookups reuse the fitted buffers, shrunk back after the large result
+	for (std::size_t i = 0; i < sizes.size(); ++i) {
+		auto row = db.Query("SELECT body FROM large_columns WHERE id = ?;", static_cast<int>(i));
+		ASSERT_TRUE(fn_name, row.has_value());
+		ASSERT_EQUAL(fn_name, sizes[i], (*row)[0][0].Get<std::string>().size());
+	}
+	RETURN_TEST(fn_name, 0);
+}
+
+int blob_stream_test() {
+	const std::string fn_name = "blob_stream_test";
+	TestDatabase db;
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.Query("CREATE TEMPORARY TABLE stream_blobs (id INT PRIMARY KEY, data LONGBLOB);").has_value());
+	ASSERT_TRUE(fn_name, db.Query("INSERT INTO stream_blobs (id, data) VALUES (?, ?);", 1, std::vector<std::byte>(4, std::byte{1})).has_value());
+
+	std::string payload(2 * 1024 * 1024 + 3, '\0');
+	for (std::size_t i = 0; i < payload.size(); i++)
+		payload[i] = static_cast<char>(i % 251);
+	const BlobLocation location{"stream_blobs", "data", "id", 1};
+	auto writer = db.WriteBlob(location, payload.size());
+	ASSERT_TRUE(fn_name, writer.has_value());
+	std::istringstream in(payload);
+	ASSERT_TRUE(fn_name, (*writer)->WriteFrom(in, 256 * 1024).has_value());
+	ASSERT_TRUE(fn_name, (*writer)->Close().has_value());
+
+	auto reader = db.ReadBlob(location);
+	ASSERT_TRUE(fn_name, reader.has_value());
+	ASSERT_EQUAL(fn_name, payload.size(), static_cast<std::size_t>((*reader)->Size()));
+	std::ostringstream out;
+	ASSERT_TRUE(fn_name, (*reader)->ReadTo(out, 300 * 1000).has_value());
+	ASSERT_TRUE(fn_name, out.str() == payload);
+	ASSERT_TRUE(fn_name, (*reader)->Close().has_value());
+
+	// Incomplete writes leave the value unchanged
+	{
+		auto partial = db.WriteBlob(location, 10);
+		ASSERT_TRUE(fn_name, partial.has_value());
+		ASSERT_TRUE(fn_name, (*partial)->Write(std::as_bytes(std::span("abc", 3))).has_value());
+	}
+	auto size = db.Query("SELECT LENGTH(data) FROM stream_blobs WHERE id = ?;", 1);
+	ASSERT_TRUE(fn_name, size.has_value());
+	ASSERT_EQUAL(fn_name, static_cast<long int>(payload.size()), (*size)[0][0].Get<long int>());
+	ASSERT_FALSE(fn_name, db.ReadBlob({"stream_blobs", "data", "id", 2}).has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int view_bind_test() {
+	const std::string fn_name = "view_bind_test";
+	TestDatabase db;
+	db.Connect();
+
+	// MYSQL_BIND points straight at the viewed buffers
+	const std::string source = "viewed text";
+	const std::vector<std::byte> bytes{std::byte{0}, std::byte{0x7F}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", std::string_view(source).substr(0, 6), std::string_view("viewer@example.com")).has_value());
+	auto user = db.Query("SELECT name FROM users WHERE email = ?;", std::string_view("viewer@example.com"));
+	ASSERT_TRUE(fn_name, user.has_value());
+	ASSERT_EQUAL(fn_name, "viewed", (*user)[0][0].Get<std::string>());
+
+	auto blob = db.Query("SELECT HEX(?);", std::span<const std::byte>(bytes));
+	ASSERT_TRUE(fn_name, blob.has_value());
+	ASSERT_EQUAL(fn_name, "007FFF", (*blob)[0][0].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
 int main() {
 	int result = 0;
 
@@ -485,6 +882,11 @@ int main() {
 	result += unknown_stmt_test();
 	result += name_access_test();
 	result += name_access_missing_column();
+	result += column_ref_test();
+	result += statement_stats_test();
+	result += slow_query_log_test();
+	result += query_stream_test();
+	result += execute_stream_test();
 	result += transaction_commit_test();
 	result += transaction_rollback_explicit();
 	result += transaction_rollback_auto();
@@ -492,6 +894,14 @@ int main() {
 	result += isolation_serializable();
 	result += isolation_repeatable_read();
 	result += concurrent_multiple_connections();
+	result += execute_batch_test();
+	result += async_query_test();
+	result += reactor_test();
+	result += statement_cache_test();
+	result += stmt_buffer_reuse_test();
+	result += large_column_test();
+	result += blob_stream_test();
+	result += view_bind_test();
 
 	if (result == 0) {
 		std::cout << "All tests passed successfully.\n";
@@ -1,11 +1,20 @@
 #include <StormByte/database/postgres/postgres.hxx>
+#include <StormByte/database/reactor.hxx>
 #include <StormByte/database/transaction.hxx>
 #include <StormByte/logger/log.hxx>
 #include <StormByte/logger/threaded_log.hxx>
 #include <StormByte/test_handlers.h>
 
+#include <future>
+#include <coroutine>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <iostream>
+#include <span>
+#include <sstream>
+#include <string>
+#include <tuple>
 #include <vector>
 #include <thread>
 #include <chrono>
@@ -16,11 +25,32 @@ using namespace StormByte::Database::Postgres;
 using StormByte::Database::IsolationLevel;
 using StormByte::Database::Transaction;
 using StormByte::Database::ColumnNotFound;
+using StormByte::Database::ColumnRef;
+using StormByte::Database::StatementKind;
+using StormByte::Database::SlowQueryOptions;
 using StormByte::Database::SslMode;
+using StormByte::Database::BatchError;
+using StormByte::Database::Reactor;
+using StormByte::Database::Row;
+using StormByte::Database::Value;
+using StormByte::Database::BlobLocation;
 
 std::shared_ptr<StormByte::Logger::Log> logger =
 	std::make_shared<StormByte::Logger::ThreadedLog>(std::cout, StormByte::Logger::Level::Info);
 
+/**
+ * Fire-and-forget coroutine used to drive co_await from plain test functions.
+ */
+struct DetachedTask {
+	struct promise_type {
+		DetachedTask get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
 class TestDatabase : public Postgres {
 	public:
 		TestDatabase()
@@ -28,6 +58,11 @@ class TestDatabase : public Postgres {
 			SetSslMode(SslMode::Disable);
 		}
 
+		explicit TestDatabase(std::shared_ptr<StormByte::Logger::Log> log)
+			: Postgres("localhost", "testuser", "testpass", "stormbyte_test", std::move(log)) {
+			SetSslMode(SslMode::Disable);
+		}
+
 		const ExpectedRows get_users() { return ExecuteSTMT("select_users"); }
 		const ExpectedRows get_products() { return ExecuteSTMT("select_products"); }
 		const ExpectedRows get_orders() { return ExecuteSTMT("select_orders"); }
@@ -42,8 +77,9 @@ class TestDatabase : public Postgres {
 			DoSilentQuery("CREATE TABLE IF NOT EXISTS blobs (id SERIAL PRIMARY KEY, data BYTEA);");
 			DoSilentQuery("CREATE TABLE IF NOT EXISTS nulls (id SERIAL PRIMARY KEY, value TEXT);");
 			DoSilentQuery("CREATE TABLE IF NOT EXISTS concurrent (id SERIAL PRIMARY KEY, value INTEGER);");
+			DoSilentQuery("CREATE TABLE IF NOT EXISTS copy_items (id INTEGER, name TEXT, price DOUBLE PRECISION, flag BOOLEAN, data BYTEA);");
 
-			DoSilentQuery("TRUNCATE TABLE users, products, orders, blobs, nulls, concurrent RESTART IDENTITY CASCADE;");
+			DoSilentQuery("TRUNCATE TABLE users, products, orders, blobs, nulls, concurrent, copy_items RESTART IDENTITY CASCADE;");
 
 			DoSilentQuery("INSERT INTO users (name, email) VALUES ('Alice', 'alice@example.com');");
 			DoSilentQuery("INSERT INTO users (name, email) VALUES ('Bob', 'bob@example.com');");
@@ -63,6 +99,18 @@ class TestDatabase : public Postgres {
 			DoPrepareSTMT("select_nulls", "SELECT value FROM nulls;");
 			DoPrepareSTMT("insert_concurrent", "INSERT INTO concurrent (value) VALUES ($1);");
 			DoPrepareSTMT("count_concurrent", "SELECT COUNT(*) FROM concurrent;");
+			DoPrepareSTMT("insert_user", "INSERT INTO users (name, email) VALUES ($1, $2);");
+			DoPrepareSTMT("count_users", "SELECT COUNT(*) FROM users;");
+			DoPrepareSTMT("echo_params", "SELECT $1::int2 AS small, $2::int4 AS regular, $3::int8 AS big, $4::float8 AS real, $5::bool AS flag, $6::text AS label, $7::numeric AS amount;");
+			DoPrepareSTMT("concat_params", "SELECT $1::text || $2::text || $3::text || $4::text AS joined;");
+			DoPrepareSTMT("select_typed", "SELECT 12345.678::numeric AS num, TIMESTAMP '2024-01-02 03:04:05.5' AS ts, DATE '2024-01-02' AS day, '00112233-4455-6677-8899-aabbccddeeff'::uuid AS id, 5000000000::int8 AS big, 2.5::float4 AS half, true AS flag;");
+		}
+};
+
+class BinaryDatabase : public TestDatabase {
+	public:
+		BinaryDatabase() {
+			SetResultFormat(ResultFormat::Binary);
 		}
 };
 
@@ -341,6 +389,354 @@ int name_access_missing_column() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int column_ref_test() {
+	const std::string fn_name = "column_ref_test";
+	TestDatabase db;
+	db.Connect();
+	auto first = db.get_users();
+	ASSERT_TRUE(fn_name, first.has_value());
+	const ColumnRef email = first.value().Column("email");
+	ASSERT_EQUAL(fn_name, "bob@example.com", first.value()[1][email].Get<std::string>());
+
+	// The reference stays valid for later executions of the statement
+	auto second = db.get_users();
+	ASSERT_TRUE(fn_name, second.has_value());
+	ASSERT_EQUAL(fn_name, "alice@example.com", second.value()[0][email].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "Alice", second.value()[0][std::string_view("name")].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_stats_test() {
+	const std::string fn_name = "statement_stats_test";
+	TestDatabase db;
+	db.Connect();
+	db.ResetStats();
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	const std::string count_sql = "SELECT COUNT(*) FROM users;";
+	ASSERT_TRUE(fn_name, db.Query(count_sql).has_value());
+
+	const auto stats = db.Stats();
+	const auto* users = stats.Find("select_users");
+	ASSERT_TRUE(fn_name, users != nullptr);
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(users->calls));
+	ASSERT_EQUAL(fn_name, 4, static_cast<int>(users->rows));
+	ASSERT_EQUAL(fn_name, 80, static_cast<int>(users->bytes));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(users->decode.count));
+	const auto* count = stats.Find(count_sql, StatementKind::Query);
+	ASSERT_TRUE(fn_name, count != nullptr);
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(count->calls));
+	ASSERT_TRUE(fn_name, stats.ToPrometheus().find("statement=\"select_users\",kind=\"prepared\"} 2\n") != std::string::npos);
+	RETURN_TEST(fn_name, 0);
+}
+
+int slow_query_log_test() {
+	const std::string fn_name = "slow_query_log_test";
+	std::ostringstream output;
+	TestDatabase db(std::make_shared<StormByte::Logger::Log>(output, StormByte::Logger::Level::Warning));
+	db.Connect();
+	SlowQueryOptions options;
+	options.threshold = std::chrono::nanoseconds(1);
+	options.plan_interval = std::chrono::milliseconds(0);
+	db.SetSlowQueryOptions(options);
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(db.SlowQueries().plans));
+	ASSERT_TRUE(fn_name, output.str().find("Slow statement 'select_users' took ") != std::string::npos);
+	ASSERT_TRUE(fn_name, output.str().find("\"Node Type\"") != std::string::npos);
+
+	// A statement EXPLAIN rejects leaves the surrounding transaction usable
+	{
+		auto tx = db.BeginTransaction();
+		ASSERT_TRUE(fn_name, db.Query("SET LOCAL work_mem = '8MB';").has_value());
+		ASSERT_TRUE(fn_name, db.get_users().has_value());
+		tx.Commit();
+	}
+	const auto slow = db.SlowQueries();
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(slow.reported));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(slow.plans));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(slow.plan_errors));
+	RETURN_TEST(fn_name, 0);
+}
+
+int borrowed_storage_test() {
+	const std::string fn_name = "borrowed_storage_test";
+	TestDatabase db;
+	db.Connect();
+	db.SetResultStorage(StormByte::Database::ResultStorage::Borrowed);
+	std::vector<std::byte> data{std::byte{0}, std::byte{1}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", data).has_value());
+
+	StormByte::Database::Row detached;
+	{
+		auto expected_rows = db.get_users();
+		ASSERT_TRUE(fn_name, expected_rows.has_value());
+		const auto& rows = expected_rows.value();
+		ASSERT_TRUE(fn_name, rows[0]["name"].IsView());
+		ASSERT_EQUAL(fn_name, "Alice", rows[0]["name"].Get<std::string>());
+		detached = rows[1];
+		detached.Detach();
+	}
+	ASSERT_EQUAL(fn_name, "bob@example.com", detached["email"].Get<std::string>());
+
+	auto expected_blob = db.get_blob();
+	ASSERT_TRUE(fn_name, expected_blob.has_value());
+	ASSERT_TRUE(fn_name, expected_blob.value()[0][0] == StormByte::Database::Value(data));
+	auto orders = db.Query("SELECT quantity FROM orders ORDER BY id;");
+	ASSERT_TRUE(fn_name, orders.has_value());
+	ASSERT_EQUAL(fn_name, 2, orders.value()[1][0].Get<int>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int binary_format_test() {
+	const std::string fn_name = "binary_format_test";
+	BinaryDatabase db;
+	db.Connect();
+	auto users = db.get_users();
+	ASSERT_TRUE(fn_name, users.has_value());
+	ASSERT_EQUAL(fn_name, "Alice", users.value()[0]["name"].Get<std::string>());
+	auto products = db.get_products();
+	ASSERT_TRUE(fn_name, products.has_value());
+	ASSERT_EQUAL(fn_name, 999.99, products.value()[0]["price"].Get<double>());
+	auto orders = db.get_orders();
+	ASSERT_TRUE(fn_name, orders.has_value());
+	ASSERT_EQUAL(fn_name, 2, orders.value()[1]["quantity"].Get<int>());
+
+	std::vector<std::byte> data{std::byte{0}, std::byte{'\\'}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", data).has_value());
+	auto blob = db.get_blob();
+	ASSERT_TRUE(fn_name, blob.has_value());
+	ASSERT_TRUE(fn_name, blob.value()[0][0].Get<std::vector<std::byte>>() == data);
+
+	auto typed = db.ExecuteSTMT("select_typed");
+	ASSERT_TRUE(fn_name, typed.has_value());
+	const auto& row = typed.value()[0];
+	ASSERT_EQUAL(fn_name, "12345.678", row["num"].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "2024-01-02 03:04:05.5", row["ts"].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "2024-01-02", row["day"].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "00112233-4455-6677-8899-aabbccddeeff", row["id"].Get<std::string>());
+	ASSERT_EQUAL(fn_name, 5000000000L, row["big"].Get<long int>());
+	ASSERT_EQUAL(fn_name, 2.5, row["half"].Get<double>());
+	ASSERT_TRUE(fn_name, row["flag"].Get<bool>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int binary_params_test() {
+	const std::string fn_name = "binary_params_test";
+	TestDatabase db;
+	db.Connect();
+	for (int i = 0; i < 2; ++i) {
+		// Second round reuses the statement's parameter buffers
+		auto rows = db.ExecuteSTMT("echo_params", 7 + i, 42, 5000000000L, 2.5, true, "label", 1.25);
+		ASSERT_TRUE(fn_name, rows.has_value());
+		const auto& row = rows.value()[0];
+		ASSERT_EQUAL(fn_name, 7 + i, row["small"].Get<int>());
+		ASSERT_EQUAL(fn_name, 42, row["regular"].Get<int>());
+		ASSERT_EQUAL(fn_name, 5000000000L, row["big"].Get<long int>());
+		ASSERT_EQUAL(fn_name, 2.5, row["real"].Get<double>());
+		ASSERT_TRUE(fn_name, row["flag"].Get<bool>());
+		ASSERT_EQUAL(fn_name, "label", row["label"].Get<std::string>());
+		ASSERT_EQUAL(fn_name, "1.25", row["amount"].Get<std::string>());
+	}
+
+	// Long text parameters used to dangle once their storage reallocated
+	const std::string a(40, 'a'), b(40, 'b'), c(40, 'c'), d(40, 'd');
+	auto joined = db.ExecuteSTMT("concat_params", a, b, c, d);
+	ASSERT_TRUE(fn_name, joined.has_value());
+	ASSERT_EQUAL(fn_name, a + b + c + d, joined.value()[0]["joined"].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_batch_test() {
+	const std::string fn_name = "execute_batch_test";
+	TestDatabase db;
+	db.Connect();
+
+	// Pipelined in windows: more rows than one read-back window
+	std::vector<std::tuple<std::string, std::string>> users;
+	for (int i = 0; i < 1000; ++i)
+		users.emplace_back("user" + std::to_string(i), "user" + std::to_string(i) + "@example.com");
+	auto batch = db.ExecuteBatch("insert_user", users);
+	ASSERT_TRUE(fn_name, batch.has_value());
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(batch->rows));
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(batch->total_affected));
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(batch->affected.size()));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(batch->affected[999]));
+
+	// A duplicate email fails the batch and nothing is kept
+	std::vector<std::tuple<std::string, std::string>> duplicates{
+		{"Carol", "carol@example.com"}, {"Dave", "dave@example.com"}, {"Eve", "alice@example.com"}, {"Frank", "frank@example.com"}};
+	auto failed = db.ExecuteBatch("insert_user", duplicates);
+	ASSERT_FALSE(fn_name, failed.has_value());
+	auto error = std::dynamic_pointer_cast<BatchError>(failed.error());
+	ASSERT_TRUE(fn_name, error != nullptr);
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(error->Index()));
+
+	auto count = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, count.has_value());
+	ASSERT_EQUAL(fn_name, 1002, static_cast<int>(count.value()[0][0].Get<long int>()));
+
+	// The statement is usable after a failed batch
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", "Zed", "zed@example.com").has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int pipeline_test() {
+	const std::string fn_name = "pipeline_test";
+	TestDatabase db;
+	db.Connect();
+	auto pipeline = db.BeginPipeline();
+	ASSERT_TRUE(fn_name, pipeline.has_value());
+	ASSERT_FALSE(fn_name, db.BeginPipeline().has_value());
+
+	// Independent statements queued back to back, read in order
+	auto users = pipeline->Add("select_users");
+	auto echo = pipeline->Add("concat_params", "a", "b", "c", "d");
+	auto count = pipeline->AddQuery("SELECT COUNT(*) FROM products;");
+	auto unknown = pipeline->Add("no_such_stmt");
+	ASSERT_TRUE(fn_name, pipeline->Sync());
+
+	ASSERT_FALSE(fn_name, unknown.get().has_value());
+	auto echo_rows = echo.get();
+	ASSERT_TRUE(fn_name, echo_rows.has_value());
+	ASSERT_EQUAL(fn_name, "abcd", echo_rows.value()[0][0].Get<std::string>());
+	auto user_rows = users.get();
+	ASSERT_TRUE(fn_name, user_rows.has_value());
+	ASSERT_TRUE(fn_name, user_rows->Count() > 0);
+	auto count_rows = count.get();
+	ASSERT_TRUE(fn_name, count_rows.has_value());
+	ASSERT_TRUE(fn_name, count_rows.value()[0][0].Get<long int>() > 0);
+
+	// A failure aborts the rest of its sync segment; the next one runs normally
+	auto failing = pipeline->AddQuery("SELECT 1/0;");
+	auto aborted = pipeline->Add("select_products");
+	pipeline->Sync();
+	auto recovered = pipeline->Add("select_products");
+	ASSERT_FALSE(fn_name, failing.get().has_value());
+	ASSERT_FALSE(fn_name, aborted.get().has_value());
+	ASSERT_TRUE(fn_name, recovered.get().has_value());
+
+	// Synchronous calls are refused until the pipeline is finished
+	ASSERT_FALSE(fn_name, db.ExecuteSTMT("select_users").has_value());
+	auto pending = pipeline->Add("select_orders");
+	pipeline->Finish();
+	ASSERT_FALSE(fn_name, pipeline->IsActive());
+	ASSERT_TRUE(fn_name, pending.get().has_value());
+	ASSERT_FALSE(fn_name, pipeline->Add("select_users").get().has_value());
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("select_users").has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int copy_test() {
+	const std::string fn_name = "copy_test";
+	TestDatabase db;
+	db.Connect();
+	const std::vector<std::string> columns{"id", "name", "price", "flag", "data"};
+	const std::vector<std::byte> data{std::byte{0}, std::byte{'\\'}, std::byte{0xFF}};
+
+	// Text format: escaping, nulls and bytea
+	auto text = db.CopyIn("copy_items", columns);
+	ASSERT_TRUE(fn_name, text.has_value());
+	for (int i = 0; i < 1000; ++i)
+		ASSERT_TRUE(fn_name, text->Write({i, "tab\there\nnew\\line", i * 0.5, i % 2 == 0, data}).has_value());
+	ASSERT_TRUE(fn_name, text->Write({1000, Value(), Value(), Value(), Value()}).has_value());
+	ASSERT_FALSE(fn_name, text->Write({1001, "too few"}).has_value());
+	auto copied = text->End();
+	ASSERT_TRUE(fn_name, copied.has_value());
+	ASSERT_EQUAL(fn_name, 1001, static_cast<int>(*copied));
+
+	// Binary format: values must fit the column types
+	auto binary = db.CopyIn("copy_items", columns, CopyFormat::Binary);
+	ASSERT_TRUE(fn_name, binary.has_value());
+	ASSERT_FALSE(fn_name, binary->Write({"not a number", "x", 1.0, true, data}).has_value());
+	for (int i = 2000; i < 3000; ++i)
+		ASSERT_TRUE(fn_name, binary->Write({i, "binary", i, false, data}).has_value());
+	copied = binary->End();
+	ASSERT_TRUE(fn_name, copied.has_value());
+	ASSERT_EQUAL(fn_name, 1000, static_cast<int>(*copied));
+
+	// Aborted copies keep nothing
+	{
+		auto aborted = db.CopyIn("copy_items", columns);
+		ASSERT_TRUE(fn_name, aborted.has_value());
+		ASSERT_TRUE(fn_name, aborted->Write({5000, "gone", 1.0, true, data}).has_value());
+	}
+
+	auto cursor = db.CopyOut("SELECT id, name, price, flag, data FROM copy_items ORDER BY id");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	int count = 0;
+	while (true) {
+		auto row = cursor->Next();
+		ASSERT_TRUE(fn_name, row.has_value());
+		if (!row->has_value())
+			break;
+		const Row& r = **row;
+		if (count == 3) {
+			ASSERT_EQUAL(fn_name, 3, r["id"].Get<int>());
+			ASSERT_EQUAL(fn_name, "tab\there\nnew\\line", r["name"].Get<std::string>());
+			ASSERT_EQUAL(fn_name, 1.5, r["price"].Get<double>());
+			ASSERT_FALSE(fn_name, r["flag"].Get<bool>());
+			ASSERT_TRUE(fn_name, r["data"].Get<std::vector<std::byte>>() == data);
+		}
+		if (count == 1000)
+			ASSERT_TRUE(fn_name, r["name"].IsNull() && r["data"].IsNull());
+		++count;
+	}
+	ASSERT_EQUAL(fn_name, 2001, count);
+
+	// A cursor dropped early leaves the connection usable
+	{
+		auto partial = db.CopyOut("SELECT id FROM copy_items");
+		ASSERT_TRUE(fn_name, partial.has_value());
+		ASSERT_TRUE(fn_name, partial->Next().has_value());
+	}
+	ASSERT_TRUE(fn_name, db.Query("SELECT 1;").has_value());
+	ASSERT_FALSE(fn_name, db.CopyOut("SELECT * FROM no_such_table").has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int query_stream_test() {
+	const std::string fn_name = "query_stream_test";
+	TestDatabase db;
+	db.Connect();
+	auto cursor = db.QueryStream("SELECT name FROM users ORDER BY id;");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	auto first = cursor->Next();
+	ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+	ASSERT_EQUAL(fn_name, "Alice", (**first)["name"].Get<std::string>());
+	auto second = cursor->Next();
+	ASSERT_TRUE(fn_name, second.has_value() && second->has_value());
+	auto end = cursor->Next();
+	ASSERT_TRUE(fn_name, end.has_value() && !end->has_value());
+	ASSERT_TRUE(fn_name, cursor->Done());
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_stream_test() {
+	const std::string fn_name = "execute_stream_test";
+	TestDatabase db;
+	db.Connect();
+	{
+		// Abandon the cursor after one row; the connection must be usable afterwards
+		auto cursor = db.ExecuteSTMTStream("select_users");
+		ASSERT_TRUE(fn_name, cursor.has_value());
+		auto first = cursor->Next();
+		ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+	}
+	auto cursor = db.ExecuteSTMTStream("select_users");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	int count = 0;
+	while (true) {
+		auto row = cursor->Next();
+		ASSERT_TRUE(fn_name, row.has_value());
+		if (!row->has_value()) break;
+		++count;
+	}
+	ASSERT_EQUAL(fn_name, 2, count);
+	auto rows = db.Query("SELECT COUNT(*) FROM users;");
+	ASSERT_TRUE(fn_name, rows.has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
 int transaction_commit_test() {
 	const std::string fn_name = "transaction_commit_test";
 	TestDatabase db;
@@ -450,6 +846,213 @@ int concurrent_multiple_connections() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int async_query_test() {
+	const std::string fn_name = "async_query_test";
+	constexpr int num_connections = 4;
+
+	std::vector<std::unique_ptr<ConcurrentDatabase>> dbs;
+	for (int i = 0; i < num_connections; ++i) {
+		dbs.push_back(std::make_unique<ConcurrentDatabase>());
+		dbs.back()->Connect();
+	}
+	dbs.front()->SilentQuery("DELETE FROM concurrent;");
+
+	// Every connection sleeps server-side at the same time, so the whole run
+	// should take about one sleep rather than one per connection
+	std::vector<std::promise<bool>> promises(num_connections);
+	std::vector<std::future<bool>> futures;
+	const auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < num_connections; ++i) {
+		futures.push_back(promises[i].get_future());
+		[](ConcurrentDatabase& db, int value, std::promise<bool>& done) -> DetachedTask {
+			auto slept = co_await db.QueryAsync("SELECT pg_sleep(0.3);");
+			auto inserted = co_await db.ExecuteAsync("insert_concurrent", value);
+			done.set_value(slept.has_value() && slept->size() == 1 && inserted.has_value());
+		}(*dbs[i], i, promises[i]);
+	}
+	for (auto& future : futures) {
+		ASSERT_TRUE(fn_name, future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+		ASSERT_TRUE(fn_name, future.get());
+	}
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	ASSERT_TRUE(fn_name, elapsed < std::chrono::milliseconds(250 * num_connections));
+
+	auto rows = dbs.front()->ExecuteSTMT("count_concurrent");
+	ASSERT_TRUE(fn_name, rows.has_value());
+	ASSERT_EQUAL(fn_name, num_connections, rows.value()[0][0].Get<int>());
+
+	auto error = [&]() {
+		std::promise<bool> failed;
+		auto result = failed.get_future();
+		[](ConcurrentDatabase& db, std::promise<bool>& failed) -> DetachedTask {
+			auto res = co_await db.QueryAsync("SELECT * FROM missing_table;");
+			failed.set_value(!res.has_value());
+		}(*dbs.front(), failed);
+		return result.get();
+	}();
+	ASSERT_TRUE(fn_name, error);
+	ASSERT_TRUE(fn_name, dbs.front()->ExecuteSTMT("count_concurrent").has_value());
+	dbs.front()->SilentQuery("DELETE FROM concurrent;");
+	RETURN_TEST(fn_name, 0);
+}
+
+int reactor_test() {
+	const std::string fn_name = "reactor_test";
+	constexpr int num_connections = 8;
+	Reactor reactor;
+	for (int i = 0; i < num_connections; ++i) {
+		auto db = std::make_unique<ConcurrentDatabase>();
+		db->Connect();
+		reactor.Add(std::move(db));
+	}
+
+	// One thread drives every connection; the sleeps overlap on the server
+	int succeeded = 0;
+	const auto start = std::chrono::steady_clock::now();
+	for (Reactor::ConnectionId id = 0; id < reactor.Size(); ++id) {
+		[](Reactor& reactor, Reactor::ConnectionId id, int& succeeded) -> DetachedTask {
+			auto slept = co_await reactor.QueryAsync(id, "SELECT pg_sleep(0.3);");
+			auto counted = co_await reactor.ExecuteAsync(id, "count_concurrent");
+			if (slept && counted)
+				succeeded++;
+		}(reactor, id, succeeded);
+	}
+	while (succeeded < num_connections && std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+		reactor.RunOnce(std::chrono::milliseconds(100));
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	ASSERT_EQUAL(fn_name, num_connections, succeeded);
+	ASSERT_TRUE(fn_name, elapsed < std::chrono::milliseconds(200 * num_connections));
+
+	for (Reactor::ConnectionId id = 0; id < reactor.Size(); ++id) {
+		auto stats = reactor.Stats(id);
+		ASSERT_EQUAL(fn_name, 2, static_cast<int>(stats.completed));
+		ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.failed));
+		ASSERT_TRUE(fn_name, stats.max_latency >= std::chrono::milliseconds(300));
+	}
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_cache_test() {
+	const std::string fn_name = "statement_cache_test";
+	TestDatabase db;
+	db.Connect();
+
+	auto alice = db.Query("SELECT name FROM users WHERE id = $1;", 1);
+	auto bob = db.Query("SELECT name FROM users WHERE id = $1;", 2);
+	ASSERT_TRUE(fn_name, alice.has_value());
+	ASSERT_TRUE(fn_name, bob.has_value());
+	ASSERT_EQUAL(fn_name, "Bob", (*bob)[0][0].Get<std::string>());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(db.CacheStats().hits));
+
+	// Evicted statements are deallocated on the server
+	db.SetStatementCacheSize(1);
+	ASSERT_TRUE(fn_name, db.Query("SELECT price FROM products WHERE id = $1;", 1).has_value());
+	auto prepared = db.Query("SELECT COUNT(*) FROM pg_prepared_statements WHERE name LIKE $1;", "stormbyte_cached_%");
+	ASSERT_TRUE(fn_name, prepared.has_value());
+	ASSERT_EQUAL(fn_name, 1, (*prepared)[0][0].Get<int>());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(db.CacheStats().evictions));
+	RETURN_TEST(fn_name, 0);
+}
+
+int blob_stream_test() {
+	const std::string fn_name = "blob_stream_test";
+	TestDatabase db;
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.Query("CREATE TEMPORARY TABLE stream_blobs (id INTEGER PRIMARY KEY, data BYTEA);").has_value());
+	ASSERT_TRUE(fn_name, db.Query("INSERT INTO stream_blobs (id, data) VALUES ($1, $2);", 1, std::vector<std::byte>(4, std::byte{1})).has_value());
+
+	std::string payload(2 * 1024 * 1024 + 3, '\0');
+	for (std::size_t i = 0; i < payload.size(); i++)
+		payload[i] = static_cast<char>(i % 251);
+	const BlobLocation location{"stream_blobs", "data", "id", 1};
+	auto writer = db.WriteBlob(location, payload.size());
+	ASSERT_TRUE(fn_name, writer.has_value());
+	std::istringstream in(payload);
+	ASSERT_TRUE(fn_name, (*writer)->WriteFrom(in, 256 * 1024).has_value());
+	ASSERT_TRUE(fn_name, (*writer)->Close().has_value());
+
+	auto reader = db.ReadBlob(location);
+	ASSERT_TRUE(fn_name, reader.has_value());
+	ASSERT_EQUAL(fn_name, payload.size(), static_cast<std::size_t>((*reader)->Size()));
+	std::ostringstream out;
+	ASSERT_TRUE(fn_name, (*reader)->ReadTo(out, 300 * 1000).has_value());
+	ASSERT_TRUE(fn_name, out.str() == payload);
+	ASSERT_TRUE(fn_name, (*reader)->Close().has_value());
+
+	// Incomplete writes leave the value unchanged
+	{
+		auto partial = db.WriteBlob(location, 10);
+		ASSERT_TRUE(fn_name, partial.has_value());
+		ASSERT_TRUE(fn_name, (*partial)->Write(std::as_bytes(std::span("abc", 3))).has_value());
+	}
+	auto size = db.Query("SELECT octet_length(data) FROM stream_blobs WHERE id = $1;", 1);
+	ASSERT_TRUE(fn_name, size.has_value());
+	ASSERT_EQUAL(fn_name, static_cast<int>(payload.size()), (*size)[0][0].Get<int>());
+	ASSERT_FALSE(fn_name, db.ReadBlob({"stream_blobs", "data", "id", 2}).has_value());
+
+	// One write stream per connection, on its own or inside a caller's transaction
+	ASSERT_TRUE(fn_name, db.Query("INSERT INTO stream_blobs (id, data) VALUES ($1, NULL), ($2, NULL);", 2, 3).has_value());
+	const BlobLocation second_location{"stream_blobs", "data", "id", 2};
+	const BlobLocation third_location{"stream_blobs", "data", "id", 3};
+	for (bool in_transaction : {false, true}) {
+		std::optional<Transaction> tx;
+		if (in_transaction)
+			tx.emplace(db.BeginTransaction());
+		auto first = db.WriteBlob(second_location, 4);
+		ASSERT_TRUE(fn_name, first.has_value());
+		ASSERT_FALSE(fn_name, db.WriteBlob(third_location, 4).has_value());
+		ASSERT_TRUE(fn_name, (*first)->Write(std::as_bytes(std::span(in_transaction ? "txn!" : "full", 4))).has_value());
+		ASSERT_TRUE(fn_name, (*first)->Close().has_value());
+		auto second = db.WriteBlob(third_location, 4);
+		ASSERT_TRUE(fn_name, second.has_value());
+		ASSERT_TRUE(fn_name, (*second)->Write(std::as_bytes(std::span("ab", 2))).has_value());
+		ASSERT_FALSE(fn_name, (*second)->Close().has_value());
+		if (tx)
+			tx->Commit();
+		auto kept = db.Query("SELECT convert_from(data, 'UTF8') FROM stream_blobs WHERE id = $1;", 2);
+		ASSERT_TRUE(fn_name, kept.has_value());
+		ASSERT_EQUAL(fn_name, std::string(in_transaction ? "txn!" : "full"), (*kept)[0][0].Get<std::string>());
+		auto untouched = db.Query("SELECT data IS NULL FROM stream_blobs WHERE id = $1;", 3);
+		ASSERT_TRUE(fn_name, untouched.has_value());
+		ASSERT_TRUE(fn_name, (*untouched)[0][0].Get<bool>());
+	}
+
+	// A row deleted while the stream is open makes Close() fail
+	auto orphan = db.WriteBlob(third_location, 2);
+	ASSERT_TRUE(fn_name, orphan.has_value());
+	ASSERT_TRUE(fn_name, db.Query("DELETE FROM stream_blobs WHERE id = $1;", 3).has_value());
+	ASSERT_TRUE(fn_name, (*orphan)->Write(std::as_bytes(std::span("ab", 2))).has_value());
+	ASSERT_FALSE(fn_name, (*orphan)->Close().has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int view_bind_test() {
+	const std::string fn_name = "view_bind_test";
+	TestDatabase db;
+	db.Connect();
+
+	// Text-typed and bytea parameters are sent from the caller's buffers;
+	// other types still get the text form
+	const std::string source = "viewed text";
+	const std::vector<std::byte> bytes{std::byte{0}, std::byte{'\\'}, std::byte{0xFF}};
+	auto echoed = db.Query("SELECT $1::text, $2::varchar, $3::int4 + 1, $4::bytea, $5::text IS NULL, $6::text;",
+		std::string_view(source).substr(0, 6), std::string_view(source), std::string_view("41"), std::span<const std::byte>(bytes), std::string_view(), std::string("owned"));
+	ASSERT_TRUE(fn_name, echoed.has_value());
+	const Row& row = (*echoed)[0];
+	ASSERT_EQUAL(fn_name, "viewed", row[0].Get<std::string>());
+	ASSERT_EQUAL(fn_name, source, row[1].Get<std::string>());
+	ASSERT_EQUAL(fn_name, 42, row[2].Get<int>());
+	ASSERT_TRUE(fn_name, row[3].Get<std::vector<std::byte>>() == bytes);
+	ASSERT_FALSE(fn_name, row[4].Get<bool>());
+	ASSERT_EQUAL(fn_name, "owned", row[5].Get<std::string>());
+
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", std::string_view("Viewer"), std::string_view("viewer@example.com")).has_value());
+	auto user = db.Query("SELECT name FROM users WHERE email = $1;", std::string_view("viewer@example.com"));
+	ASSERT_TRUE(fn_name, user.has_value());
+	ASSERT_EQUAL(fn_name, "Viewer", (*user)[0][0].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
 int main() {
 	int result = 0;
 
@@ -474,6 +1077,14 @@ int main() {
 	result += unknown_stmt_test();
 	result += name_access_test();
 	result += name_access_missing_column();
+	result += column_ref_test();
+	result += statement_stats_test();
+	result += slow_query_log_test();
+	result += borrowed_storage_test();
+	result += binary_format_test();
+	result += binary_params_test();
+	result += query_stream_test();
+	result += execute_stream_test();
 	result += transaction_commit_test();
 	result += transaction_rollback_explicit();
 	result += transaction_rollback_auto();
@@ -481,6 +1092,14 @@ int main() {
 	result += isolation_serializable();
 	result += isolation_repeatable_read();
 	result += concurrent_multiple_connections();
+	result += execute_batch_test();
+	result += pipeline_test();
+	result += copy_test();
+	result += async_query_test();
+	result += reactor_test();
+	result += statement_cache_test();
+	result += blob_stream_test();
+	result += view_bind_test();
 
 	if (result == 0) {
 		std::cout << "All tests passed successfully.\n";
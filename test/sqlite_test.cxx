@@ -1,3 +1,5 @@
+#include <StormByte/database/connection_pool.hxx>
+#include <StormByte/database/reactor.hxx>
 #include <StormByte/database/sqlite/sqlite3.hxx>
 #include <StormByte/database/transaction.hxx>
 #include <StormByte/logger/log.hxx>
@@ -5,8 +7,17 @@
 #include <StormByte/system.hxx>
 #include <StormByte/test_handlers.h>
 
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <future>
 #include <memory>
+#include <optional>
+#include <tuple>
 #include <iostream>
+#include <span>
+#include <sstream>
 #include <vector>
 #include <thread>
 #include <chrono>
@@ -18,13 +29,43 @@ using namespace StormByte::Database::SQLite;
 using StormByte::Database::IsolationLevel;
 using StormByte::Database::Transaction;
 using StormByte::Database::ColumnNotFound;
+using StormByte::Database::Statement;
+using StormByte::Database::ConnectionPool;
+using StormByte::Database::PoolOptions;
+using StormByte::Database::BatchError;
+using StormByte::Database::Reactor;
+using StormByte::Database::AsyncOperation;
+using StormByte::Database::AsyncStatus;
+using StormByte::Database::EventLoop;
+using StormByte::Database::BlobLocation;
+using StormByte::Database::Value;
+using StormByte::Database::ColumnRef;
+using StormByte::Database::Row;
+using StormByte::Database::StatementKind;
+using StormByte::Database::LatencyHistogram;
+using StormByte::Database::LatencyStats;
+using StormByte::Database::SlowQueryOptions;
 
 std::shared_ptr<StormByte::Logger::Log> logger =
 	std::make_shared<StormByte::Logger::ThreadedLog>(std::cout, StormByte::Logger::Level::Info);
 
+/**
+ * Fire-and-forget coroutine used to drive co_await from plain test functions.
+ */
+struct DetachedTask {
+	struct promise_type {
+		DetachedTask get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
 class TestMemoryDatabase : public SQLite3 {
 	public:
 		TestMemoryDatabase() : SQLite3(logger) {}
+		explicit TestMemoryDatabase(std::shared_ptr<StormByte::Logger::Log> log) : SQLite3(std::move(log)) {}
 
 		const ExpectedRows get_users() { return ExecuteSTMT("select_users"); }
 		const ExpectedRows get_products() { return ExecuteSTMT("select_products"); }
@@ -32,6 +73,10 @@ class TestMemoryDatabase : public SQLite3 {
 		const ExpectedRows get_joined_data() { return ExecuteSTMT("select_join"); }
 		const ExpectedRows get_blob() { return ExecuteSTMT("select_blob"); }
 
+		Statement<std::string, double> insert_product;
+		Statement<std::optional<std::string>> insert_nullable;
+		Statement<std::int64_t> select_order_by_user;
+
 	private:
 		void DoPostConnect() noexcept override {
 			DoSilentQuery("PRAGMA foreign_keys = ON;");
@@ -61,6 +106,12 @@ class TestMemoryDatabase : public SQLite3 {
 			DoPrepareSTMT("select_nulls", "SELECT value FROM nulls;");
 			DoPrepareSTMT("insert_concurrent", "INSERT INTO concurrent (value) VALUES (?);");
 			DoPrepareSTMT("count_concurrent", "SELECT COUNT(*) FROM concurrent;");
+			DoPrepareSTMT("insert_user", "INSERT INTO users (name, email) VALUES (?, ?);");
+			DoPrepareSTMT("count_users", "SELECT COUNT(*) FROM users;");
+
+			insert_product = DoPrepareSTMT<std::string, double>("insert_product", "INSERT INTO products (name, price) VALUES (?, ?);");
+			insert_nullable = DoPrepareSTMT<std::optional<std::string>>("insert_nullable", "INSERT INTO nulls (value) VALUES (?);");
+			select_order_by_user = DoPrepareSTMT<std::int64_t>("select_order_by_user", "SELECT product_id, quantity FROM orders WHERE user_id = ?;");
 		}
 };
 
@@ -320,6 +371,582 @@ int name_access_missing_column() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int shared_schema_test() {
+	const std::string fn_name = "shared_schema_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto expected_rows = db.get_users();
+	ASSERT_TRUE(fn_name, expected_rows.has_value());
+	const auto& rows = expected_rows.value();
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(rows.Count()));
+	ASSERT_TRUE(fn_name, rows[0].Schema() != nullptr);
+	ASSERT_TRUE(fn_name, rows[0].Schema() == rows[1].Schema());
+	ASSERT_EQUAL(fn_name, "email", rows[0].Schema()->Name(1));
+	ASSERT_EQUAL(fn_name, "TEXT", rows[0].Schema()->DeclaredType(1));
+	ASSERT_EQUAL(fn_name, "bob@example.com", rows[1]["email"].Get<std::string>());
+	RETURN_TEST(fn_name, 0);
+}
+
+int column_ref_test() {
+	const std::string fn_name = "column_ref_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto expected_rows = db.get_users();
+	ASSERT_TRUE(fn_name, expected_rows.has_value());
+	const auto& rows = expected_rows.value();
+
+	// Resolved once, then indexed on every row of the same schema
+	const ColumnRef email = rows.Column("email");
+	ASSERT_TRUE(fn_name, email.ResolvedFor(rows[0].Schema().get()));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(email.Index()));
+	ASSERT_EQUAL(fn_name, "alice@example.com", rows[0][email].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "bob@example.com", rows[1][email].Get<std::string>());
+
+	// std::string_view keys need no std::string
+	const std::string_view name_key = "name";
+	ASSERT_EQUAL(fn_name, "Bob", rows[1][name_key].Get<std::string>());
+
+	// Rows of another schema fall back to the name
+	Row other;
+	other.add("email", Value("carol@example.com"));
+	other.add("name", Value("Carol"));
+	ASSERT_EQUAL(fn_name, "carol@example.com", other[email].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "Carol", other[ColumnRef("name")].Get<std::string>());
+
+	bool threw = false;
+	try {
+		(void)rows.Column("non_existent_column");
+	} catch (const ColumnNotFound&) {
+		threw = true;
+	}
+	ASSERT_TRUE(fn_name, threw);
+	threw = false;
+	try {
+		(void)other[ColumnRef("id")];
+	} catch (const ColumnNotFound&) {
+		threw = true;
+	}
+	ASSERT_TRUE(fn_name, threw);
+	RETURN_TEST(fn_name, 0);
+}
+
+int arena_storage_test() {
+	const std::string fn_name = "arena_storage_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	db.SetResultStorage(StormByte::Database::ResultStorage::Arena);
+	std::vector<std::byte> data{std::byte{0}, std::byte{1}, std::byte{2}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", data).has_value());
+
+	StormByte::Database::Row detached;
+	{
+		auto expected_rows = db.get_users();
+		ASSERT_TRUE(fn_name, expected_rows.has_value());
+		const auto& rows = expected_rows.value();
+		ASSERT_TRUE(fn_name, rows.GetArena() != nullptr);
+		ASSERT_TRUE(fn_name, rows[0]["name"].IsView());
+		ASSERT_EQUAL(fn_name, "Alice", rows[0]["name"].Get<std::string>());
+		ASSERT_TRUE(fn_name, rows[1]["email"] == StormByte::Database::Value(std::string("bob@example.com")));
+		detached = rows[1];
+		detached.Detach();
+		ASSERT_FALSE(fn_name, detached["name"].IsView());
+	}
+	ASSERT_EQUAL(fn_name, "Bob", detached["name"].Get<std::string>());
+
+	auto expected_blob = db.get_blob();
+	ASSERT_TRUE(fn_name, expected_blob.has_value());
+	const auto blob = expected_blob.value()[0][0].Get<std::span<const std::byte>>();
+	ASSERT_EQUAL(fn_name, 4, static_cast<int>(blob.size()));
+	ASSERT_EQUAL(fn_name, 255, static_cast<int>(static_cast<unsigned char>(blob[3])));
+	ASSERT_TRUE(fn_name, expected_blob.value()[0][0] == StormByte::Database::Value(data));
+
+	db.SetResultStorage(StormByte::Database::ResultStorage::Owned);
+	auto owned = db.get_users();
+	ASSERT_TRUE(fn_name, owned.has_value());
+	ASSERT_TRUE(fn_name, owned.value().GetArena() == nullptr);
+	ASSERT_FALSE(fn_name, owned.value()[0]["name"].IsView());
+	RETURN_TEST(fn_name, 0);
+}
+
+struct TypedProduct {
+	std::string name;
+	double price;
+};
+
+struct TypedNullable {
+	std::optional<std::string> value;
+};
+
+int execute_as_tuple_test() {
+	const std::string fn_name = "execute_as_tuple_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto orders = db.ExecuteSTMTAs<std::tuple<std::int64_t, int, short>>("select_orders");
+	ASSERT_TRUE(fn_name, orders.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(orders->size()));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(std::get<0>((*orders)[1])));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(std::get<2>((*orders)[1])));
+
+	std::vector<std::byte> data{std::byte{0}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", data).has_value());
+	auto blobs = db.ExecuteSTMTAs<std::tuple<std::vector<std::byte>>>("select_blob");
+	ASSERT_TRUE(fn_name, blobs.has_value());
+	ASSERT_TRUE(fn_name, std::get<0>((*blobs)[0]) == data);
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_as_struct_test() {
+	const std::string fn_name = "execute_as_struct_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto products = db.ExecuteSTMTAs<TypedProduct>("select_products");
+	ASSERT_TRUE(fn_name, products.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(products->size()));
+	ASSERT_EQUAL(fn_name, "Mouse", (*products)[1].name);
+	ASSERT_EQUAL(fn_name, 19.99, (*products)[1].price);
+
+	auto nullable = db.ExecuteSTMTAs<TypedNullable>("select_nulls");
+	ASSERT_TRUE(fn_name, nullable.has_value());
+	ASSERT_FALSE(fn_name, (*nullable)[0].value.has_value());
+
+	// NULL into a non-optional field, and more fields than columns, are errors
+	ASSERT_FALSE(fn_name, db.ExecuteSTMTAs<std::tuple<std::string>>("select_nulls").has_value());
+	ASSERT_FALSE(fn_name, (db.ExecuteSTMTAs<std::tuple<std::string, double, int>>("select_products").has_value()));
+	ASSERT_FALSE(fn_name, db.ExecuteSTMTAs<TypedProduct>("missing").has_value());
+
+	// The statement is reusable afterwards
+	auto again = db.ExecuteSTMTAs<TypedProduct>("select_products");
+	ASSERT_TRUE(fn_name, again.has_value());
+	ASSERT_EQUAL(fn_name, "Laptop", (*again)[0].name);
+	RETURN_TEST(fn_name, 0);
+}
+
+int typed_statement_test() {
+	const std::string fn_name = "typed_statement_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.insert_product.IsValid());
+
+	// Binds straight from a literal and a double, repeatedly
+	ASSERT_TRUE(fn_name, db.insert_product.Execute("Keyboard", 49.5).has_value());
+	const std::string name = "Monitor";
+	ASSERT_TRUE(fn_name, db.insert_product.Execute(name, 150.0).has_value());
+	auto products = db.ExecuteSTMTAs<TypedProduct>("select_products");
+	ASSERT_TRUE(fn_name, products.has_value());
+	ASSERT_EQUAL(fn_name, 4, static_cast<int>(products->size()));
+	ASSERT_EQUAL(fn_name, "Keyboard", (*products)[2].name);
+	ASSERT_EQUAL(fn_name, 150.0, (*products)[3].price);
+
+	ASSERT_TRUE(fn_name, db.insert_nullable.Execute(std::nullopt).has_value());
+	ASSERT_TRUE(fn_name, db.insert_nullable.Execute(std::string("set")).has_value());
+	auto nullable = db.ExecuteSTMTAs<TypedNullable>("select_nulls");
+	ASSERT_TRUE(fn_name, nullable.has_value());
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(nullable->size()));
+	ASSERT_FALSE(fn_name, (*nullable)[1].value.has_value());
+	ASSERT_EQUAL(fn_name, "set", *(*nullable)[2].value);
+
+	auto orders = db.select_order_by_user.ExecuteAs<std::tuple<int, int>>(2);
+	ASSERT_TRUE(fn_name, orders.has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(orders->size()));
+	ASSERT_EQUAL(fn_name, 2, std::get<1>((*orders)[0]));
+
+	// Same statement is still reachable by name
+	auto rows = db.ExecuteSTMT("select_order_by_user", 1);
+	ASSERT_TRUE(fn_name, rows.has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(rows->Count()));
+
+	// A default handle reports an error instead of crashing
+	Statement<int> empty;
+	ASSERT_FALSE(fn_name, empty.IsValid());
+	ASSERT_FALSE(fn_name, empty.Execute(1).has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_batch_test() {
+	const std::string fn_name = "execute_batch_test";
+	TestMemoryDatabase db;
+	db.Connect();
+
+	std::vector<std::tuple<std::string, std::string>> users;
+	for (int i = 0; i < 100; ++i)
+		users.emplace_back("user" + std::to_string(i), "user" + std::to_string(i) + "@example.com");
+	auto batch = db.ExecuteBatch("insert_user", users);
+	ASSERT_TRUE(fn_name, batch.has_value());
+	ASSERT_EQUAL(fn_name, 100, static_cast<int>(batch->rows));
+	ASSERT_EQUAL(fn_name, 100, static_cast<int>(batch->total_affected));
+	ASSERT_EQUAL(fn_name, 100, static_cast<int>(batch->affected.size()));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(batch->affected[99]));
+
+	auto count = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, count.has_value());
+	ASSERT_EQUAL(fn_name, 102, count.value()[0][0].Get<int>());
+
+	// The third row violates UNIQUE(email): the error names it and the whole batch is rolled back
+	std::vector<std::pair<std::string_view, std::string_view>> duplicates{
+		{"Carol", "carol@example.com"}, {"Dave", "dave@example.com"}, {"Eve", "alice@example.com"}, {"Frank", "frank@example.com"}};
+	auto failed = db.ExecuteBatch("insert_user", duplicates);
+	ASSERT_FALSE(fn_name, failed.has_value());
+	auto error = std::dynamic_pointer_cast<BatchError>(failed.error());
+	ASSERT_TRUE(fn_name, error != nullptr);
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(error->Index()));
+	count = db.ExecuteSTMT("count_users");
+	ASSERT_TRUE(fn_name, count.has_value());
+	ASSERT_EQUAL(fn_name, 102, count.value()[0][0].Get<int>());
+
+	// Optional columns bind NULL; the statement stays usable afterwards
+	std::vector<std::tuple<std::optional<std::string>>> nullable{{std::nullopt}, {"x"}};
+	auto nulls = db.ExecuteBatch("insert_null", nullable);
+	ASSERT_TRUE(fn_name, nulls.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(nulls->total_affected));
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", "Zed", "zed@example.com").has_value());
+	ASSERT_FALSE(fn_name, db.ExecuteBatch("missing", users).has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int columnar_kernels_test() {
+	const std::string fn_name = "columnar_kernels_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto expected = db.QueryColumnar(
+		"WITH RECURSIVE seq(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM seq WHERE x < 200) "
+		"SELECT x, CASE WHEN x % 10 = 0 THEN NULL ELSE x * 0.5 END AS half, 'n' || x AS label FROM seq;");
+	ASSERT_TRUE(fn_name, expected.has_value());
+	const auto& columns = expected.value();
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(columns.ColumnCount()));
+	ASSERT_EQUAL(fn_name, 200, static_cast<int>(columns.RowCount()));
+
+	const auto& x = columns["x"];
+	const auto& half = columns["half"];
+	ASSERT_TRUE(fn_name, x.Type() == StormByte::Database::Column::Type::Int64);
+	ASSERT_TRUE(fn_name, half.Type() == StormByte::Database::Column::Type::Double);
+	ASSERT_EQUAL(fn_name, 20100L, x.Sum().Get<long int>());
+	ASSERT_EQUAL(fn_name, 1L, x.Min().Get<long int>());
+	ASSERT_EQUAL(fn_name, 200L, x.Max().Get<long int>());
+	ASSERT_EQUAL(fn_name, 180, static_cast<int>(half.Count()));
+	ASSERT_EQUAL(fn_name, 20, static_cast<int>(half.NullCount()));
+	ASSERT_EQUAL(fn_name, 9000.0, half.Sum().Get<double>());
+	ASSERT_TRUE(fn_name, half.At(9).IsNull());
+
+	auto selection = x.Filter(StormByte::Database::Predicate::Greater, 100);
+	ASSERT_EQUAL(fn_name, 100, static_cast<int>(selection.Count()));
+	ASSERT_EQUAL(fn_name, 15050L, x.Sum(&selection).Get<long int>());
+	ASSERT_EQUAL(fn_name, 90, static_cast<int>(half.Count(&selection)));
+	ASSERT_EQUAL(fn_name, 99.5, half.Max(&selection).Get<double>());
+
+	auto label = columns["label"].Filter(StormByte::Database::Predicate::Equal, "n42");
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(label.Count()));
+	ASSERT_TRUE(fn_name, label.Test(41));
+	ASSERT_EQUAL(fn_name, "n42", std::string(columns["label"].Text(41)));
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_columnar_test() {
+	const std::string fn_name = "execute_columnar_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto expected = db.ExecuteColumnar("select_products");
+	ASSERT_TRUE(fn_name, expected.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(expected->RowCount()));
+	ASSERT_EQUAL(fn_name, 999.99, (*expected)["price"].Max().Get<double>());
+	ASSERT_EQUAL(fn_name, "Mouse", std::string((*expected)["name"].Text(1)));
+	auto empty = db.QueryColumnar("SELECT price FROM products WHERE price < 0;");
+	ASSERT_TRUE(fn_name, empty.has_value());
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(empty->RowCount()));
+	ASSERT_TRUE(fn_name, (*empty)[0].Sum().IsNull());
+	auto mixed = db.QueryColumnar("SELECT 1 AS v UNION ALL SELECT 'a';");
+	ASSERT_FALSE(fn_name, mixed.has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int query_stream_test() {
+	const std::string fn_name = "query_stream_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto cursor = db.QueryStream("SELECT name FROM users ORDER BY id;");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	auto first = cursor->Next();
+	ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+	ASSERT_EQUAL(fn_name, "Alice", (**first)[0].Get<std::string>());
+	auto second = cursor->Next();
+	ASSERT_TRUE(fn_name, second.has_value() && second->has_value());
+	ASSERT_EQUAL(fn_name, "Bob", (**second)["name"].Get<std::string>());
+	auto end = cursor->Next();
+	ASSERT_TRUE(fn_name, end.has_value() && !end->has_value());
+	ASSERT_TRUE(fn_name, cursor->Done());
+	RETURN_TEST(fn_name, 0);
+}
+
+int query_stream_error_test() {
+	const std::string fn_name = "query_stream_error_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto cursor = db.QueryStream("SELEC * FROM users;");
+	ASSERT_FALSE(fn_name, cursor.has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_stream_test() {
+	const std::string fn_name = "execute_stream_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	{
+		// Abandon the cursor after one row; the statement must be reusable afterwards
+		auto cursor = db.ExecuteSTMTStream("select_users");
+		ASSERT_TRUE(fn_name, cursor.has_value());
+		auto first = cursor->Next();
+		ASSERT_TRUE(fn_name, first.has_value() && first->has_value());
+		ASSERT_EQUAL(fn_name, "Alice", (**first)["name"].Get<std::string>());
+	}
+	auto cursor = db.ExecuteSTMTStream("select_users");
+	ASSERT_TRUE(fn_name, cursor.has_value());
+	int count = 0;
+	while (true) {
+		auto row = cursor->Next();
+		ASSERT_TRUE(fn_name, row.has_value());
+		if (!row->has_value()) break;
+		++count;
+	}
+	ASSERT_EQUAL(fn_name, 2, count);
+	auto rows = db.get_users();
+	ASSERT_TRUE(fn_name, rows.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(rows->Count()));
+	RETURN_TEST(fn_name, 0);
+}
+
+int execute_stream_unknown_stmt_test() {
+	const std::string fn_name = "execute_stream_unknown_stmt_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	auto cursor = db.ExecuteSTMTStream("non_existent_stmt");
+	ASSERT_FALSE(fn_name, cursor.has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int async_query_test() {
+	const std::string fn_name = "async_query_test";
+	TestMemoryDatabase db;
+	db.Connect();
+
+	struct Results {
+		ExpectedRows query, stmt, typed, error, unknown;
+	};
+	std::promise<Results> promise;
+	auto future = promise.get_future();
+	[](TestMemoryDatabase& db, std::promise<Results>& promise) -> DetachedTask {
+		Results results;
+		results.query = co_await db.QueryAsync("SELECT name FROM users ORDER BY id;");
+		results.stmt = co_await db.ExecuteAsync("select_order_by_user", 2);
+		results.typed = co_await db.select_order_by_user.ExecuteAsync(1);
+		results.error = co_await db.QueryAsync("SELECT * FROM missing_table;");
+		results.unknown = co_await db.ExecuteAsync("non_existent_stmt");
+		promise.set_value(std::move(results));
+	}(db, promise);
+
+	ASSERT_TRUE(fn_name, future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+	Results results = future.get();
+	ASSERT_TRUE(fn_name, results.query.has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(results.query->size()));
+	ASSERT_EQUAL(fn_name, "Bob", (*results.query)[1][0].Get<std::string>());
+	ASSERT_TRUE(fn_name, results.stmt.has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(results.stmt->size()));
+	ASSERT_TRUE(fn_name, results.typed.has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(results.typed->size()));
+	ASSERT_FALSE(fn_name, results.error.has_value());
+	ASSERT_FALSE(fn_name, results.unknown.has_value());
+
+	// The connection is still usable synchronously afterwards
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int reactor_test() {
+	const std::string fn_name = "reactor_test";
+	constexpr int num_connections = 3;
+	Reactor reactor;
+	std::vector<Reactor::ConnectionId> ids;
+	for (int i = 0; i < num_connections; ++i) {
+		auto db = std::make_unique<TestMemoryDatabase>();
+		db->Connect();
+		ids.push_back(reactor.Add(std::move(db)));
+	}
+	ASSERT_EQUAL(fn_name, num_connections, static_cast<int>(reactor.Size()));
+
+	int succeeded = 0;
+	const auto submit = [&reactor, &succeeded](Reactor::ConnectionId id) -> DetachedTask {
+		auto users = co_await reactor.QueryAsync(id, "SELECT name FROM users;");
+		auto orders = co_await reactor.ExecuteAsync(id, "select_order_by_user", 1);
+		if (users && users->size() == 2 && orders && orders->size() == 1)
+			succeeded++;
+	};
+	for (auto id : ids)
+		submit(id);
+	// Two more on the first connection queue up behind the running one
+	submit(ids[0]);
+	submit(ids[0]);
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(reactor.Stats(ids[0]).queued));
+
+	bool fired = false;
+	reactor.After(std::chrono::milliseconds(20), [&fired] { fired = true; });
+	const auto cancelled = reactor.After(std::chrono::milliseconds(10), [&fired] { fired = false; });
+	ASSERT_TRUE(fn_name, reactor.Cancel(cancelled));
+	ASSERT_FALSE(fn_name, reactor.Cancel(cancelled));
+
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+	while ((succeeded < num_connections + 2 || !fired) && std::chrono::steady_clock::now() < deadline)
+		reactor.RunOnce(std::chrono::milliseconds(50));
+	ASSERT_EQUAL(fn_name, num_connections + 2, succeeded);
+	ASSERT_TRUE(fn_name, fired);
+
+	auto stats = reactor.Stats(ids[0]);
+	ASSERT_EQUAL(fn_name, 6, static_cast<int>(stats.completed));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.failed));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.queued));
+	ASSERT_FALSE(fn_name, stats.in_flight);
+	ASSERT_TRUE(fn_name, stats.max_latency >= stats.AverageLatency());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(reactor.Stats(ids[1]).completed));
+
+	std::optional<ExpectedRows> unknown;
+	[](Reactor& reactor, std::optional<ExpectedRows>& out) -> DetachedTask {
+		out = co_await reactor.QueryAsync(99, "SELECT 1;");
+	}(reactor, unknown);
+	ASSERT_TRUE(fn_name, unknown.has_value());
+	ASSERT_FALSE(fn_name, unknown->has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int event_loop_unwatchable_test() {
+	const std::string fn_name = "event_loop_unwatchable_test";
+	// No socket to poll: the default loop must still resume it until done
+	class Unwatchable final: public AsyncOperation {
+		public:
+			AsyncStatus Start() override { return AsyncStatus::WantRead; }
+			AsyncStatus Resume() override { return ++resumed < 3 ? AsyncStatus::WantRead : AsyncStatus::Done; }
+			std::atomic<int> resumed{0};
+	} operation;
+
+	std::promise<void> done;
+	auto finished = done.get_future();
+	EventLoop::Default().Watch(operation, operation.Start(), [&done] { done.set_value(); });
+	ASSERT_TRUE(fn_name, finished.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+	ASSERT_EQUAL(fn_name, 3, operation.resumed.load());
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_cache_test() {
+	const std::string fn_name = "statement_cache_test";
+	TestMemoryDatabase db;
+	db.Connect();
+
+	auto alice = db.Query("SELECT name FROM users WHERE id = ?;", 1);
+	auto bob = db.Query("SELECT name FROM users WHERE id = ?;", 2);
+	ASSERT_TRUE(fn_name, alice.has_value());
+	ASSERT_TRUE(fn_name, bob.has_value());
+	ASSERT_EQUAL(fn_name, "Alice", (*alice)[0][0].Get<std::string>());
+	ASSERT_EQUAL(fn_name, "Bob", (*bob)[0][0].Get<std::string>());
+	auto stats = db.CacheStats();
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.size));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.hits));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.misses));
+
+	// Least recently used statement goes first
+	db.SetStatementCacheSize(2);
+	ASSERT_TRUE(fn_name, db.Query("SELECT price FROM products WHERE id = ?;", 1).has_value());
+	ASSERT_TRUE(fn_name, db.Query("SELECT name FROM users WHERE id = ?;", 1).has_value());
+	ASSERT_TRUE(fn_name, db.Query("SELECT quantity FROM orders WHERE id = ?;", 1).has_value());
+	stats = db.CacheStats();
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(stats.size));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(stats.evictions));
+	ASSERT_TRUE(fn_name, db.Query("SELECT name FROM users WHERE id = ?;", 2).has_value());
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(db.CacheStats().hits));
+
+	ASSERT_FALSE(fn_name, db.Query("SELECT * FROM missing_table WHERE id = ?;", 1).has_value());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(db.CacheStats().size));
+
+	db.SetStatementCacheSize(0);
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(db.CacheStats().size));
+	auto uncached = db.Query("SELECT email FROM users WHERE name = ?;", "Bob");
+	ASSERT_TRUE(fn_name, uncached.has_value());
+	ASSERT_EQUAL(fn_name, "bob@example.com", (*uncached)[0][0].Get<std::string>());
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(db.CacheStats().size));
+
+	db.SetStatementCacheSize(8);
+	ASSERT_TRUE(fn_name, db.Query("SELECT name FROM users WHERE id = ?;", 1).has_value());
+	db.Disconnect();
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(db.CacheStats().size));
+	ASSERT_FALSE(fn_name, db.Query("SELECT name FROM users WHERE id = ?;", 1).has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
+int blob_stream_test() {
+	const std::string fn_name = "blob_stream_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.Query("INSERT INTO blobs (id, data) VALUES (?, ?);", 7, "old").has_value());
+
+	// 3 MiB pattern written from a stream in 64 KiB chunks
+	std::string payload(3 * 1024 * 1024 + 5, '\0');
+	for (std::size_t i = 0; i < payload.size(); i++)
+		payload[i] = static_cast<char>(i % 251);
+	const BlobLocation location{"blobs", "data", "id", 7};
+	auto writer = db.WriteBlob(location, payload.size());
+	ASSERT_TRUE(fn_name, writer.has_value());
+	std::istringstream in(payload);
+	auto written = (*writer)->WriteFrom(in, 64 * 1024);
+	ASSERT_TRUE(fn_name, written.has_value());
+	ASSERT_EQUAL(fn_name, payload.size(), static_cast<std::size_t>(*written));
+	ASSERT_FALSE(fn_name, (*writer)->Write(std::as_bytes(std::span("x", 1))).has_value());
+	ASSERT_TRUE(fn_name, (*writer)->Close().has_value());
+	ASSERT_FALSE(fn_name, (*writer)->IsOpen());
+
+	auto reader = db.ReadBlob(location);
+	ASSERT_TRUE(fn_name, reader.has_value());
+	ASSERT_EQUAL(fn_name, payload.size(), static_cast<std::size_t>((*reader)->Size()));
+	std::ostringstream out;
+	ASSERT_TRUE(fn_name, (*reader)->ReadTo(out, 100 * 1000).has_value());
+	ASSERT_TRUE(fn_name, out.str() == payload);
+
+	// Random access and short reads at the end
+	std::array<std::byte, 16> chunk;
+	ASSERT_TRUE(fn_name, (*reader)->Seek(payload.size() - 3).has_value());
+	auto tail = (*reader)->Read(chunk);
+	ASSERT_TRUE(fn_name, tail.has_value());
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(*tail));
+	ASSERT_EQUAL(fn_name, payload[payload.size() - 1], static_cast<char>(chunk[2]));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(*(*reader)->Read(chunk)));
+	ASSERT_FALSE(fn_name, (*reader)->Seek(payload.size() + 1).has_value());
+	ASSERT_TRUE(fn_name, (*reader)->Close().has_value());
+
+	// An incomplete write is discarded
+	writer = db.WriteBlob(location, 10);
+	ASSERT_TRUE(fn_name, writer.has_value());
+	ASSERT_TRUE(fn_name, (*writer)->Write(std::as_bytes(std::span("abc", 3))).has_value());
+	ASSERT_FALSE(fn_name, (*writer)->Close().has_value());
+	auto size = db.Query("SELECT length(data) FROM blobs WHERE id = ?;", 7);
+	ASSERT_TRUE(fn_name, size.has_value());
+	ASSERT_EQUAL(fn_name, static_cast<int>(payload.size()), (*size)[0][0].Get<int>());
+
+	// A second write stream is refused while one is open; the first is unaffected
+	ASSERT_TRUE(fn_name, db.Query("INSERT INTO blobs (id, data) VALUES (?, ?), (?, ?);", 8, "old", 9, "old").has_value());
+	auto first = db.WriteBlob({"blobs", "data", "id", 8}, 4);
+	ASSERT_TRUE(fn_name, first.has_value());
+	ASSERT_FALSE(fn_name, db.WriteBlob({"blobs", "data", "id", 9}, 4).has_value());
+	ASSERT_TRUE(fn_name, (*first)->Write(std::as_bytes(std::span("full", 4))).has_value());
+	ASSERT_TRUE(fn_name, (*first)->Close().has_value());
+	auto second = db.WriteBlob({"blobs", "data", "id", 9}, 2);
+	ASSERT_TRUE(fn_name, second.has_value());
+	ASSERT_TRUE(fn_name, (*second)->Write(std::as_bytes(std::span("ab", 2))).has_value());
+	ASSERT_TRUE(fn_name, (*second)->Close().has_value());
+	auto kept = db.Query("SELECT CAST(data AS TEXT) FROM blobs WHERE id IN (8, 9) ORDER BY id;");
+	ASSERT_TRUE(fn_name, kept.has_value());
+	ASSERT_EQUAL(fn_name, std::string("full"), (*kept)[0][0].Get<std::string>());
+	ASSERT_EQUAL(fn_name, std::string("ab"), (*kept)[1][0].Get<std::string>());
+
+	ASSERT_FALSE(fn_name, db.ReadBlob({"blobs", "data", "id", 99}).has_value());
+	ASSERT_FALSE(fn_name, db.WriteBlob({"blobs", "data", "id", 99}, 4).has_value());
+	ASSERT_TRUE(fn_name, db.Query("SELECT 1 WHERE ? = 1;", 1).has_value());
+	RETURN_TEST(fn_name, 0);
+}
+
 int transaction_commit_test() {
 	const std::string fn_name = "transaction_commit_test";
 	TestMemoryDatabase db;
@@ -441,6 +1068,309 @@ int concurrent_multiple_connections() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int connection_pool_test() {
+	const std::string fn_name = "connection_pool_test";
+	constexpr int num_threads = 8;
+	constexpr int inserts_per_thread = 25;
+
+	const std::filesystem::path db_path = StormByte::System::TempFileName("stormbyte_sqlite_pool");
+	std::error_code ec;
+	std::filesystem::remove(db_path, ec);
+
+	{
+		PoolOptions options;
+		options.min_size = 2;
+		options.max_size = 3;
+		options.acquire_timeout = std::chrono::milliseconds(30000);
+		ConnectionPool<TestFileDatabase> pool([&db_path] { return std::make_unique<TestFileDatabase>(db_path); }, options);
+
+		// Pre-warmed connections already prepared their statements
+		ASSERT_EQUAL(fn_name, 2, static_cast<int>(pool.Stats().size));
+		{
+			auto lease = pool.Acquire();
+			ASSERT_TRUE(fn_name, lease.has_value());
+			ASSERT_TRUE(fn_name, (*lease)->ExecuteSTMT("count_concurrent").has_value());
+			ASSERT_EQUAL(fn_name, 1, static_cast<int>(pool.Stats().in_use));
+		}
+		ASSERT_EQUAL(fn_name, 0, static_cast<int>(pool.Stats().in_use));
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < num_threads; ++t) {
+			threads.emplace_back([t, &pool]() {
+				for (int i = 0; i < inserts_per_thread; ++i) {
+					auto lease = pool.Acquire();
+					if (lease)
+						(*lease)->ExecuteSTMT("insert_concurrent", t * 1000 + i);
+				}
+			});
+		}
+		for (auto& th : threads)
+			th.join();
+
+		auto stats = pool.Stats();
+		ASSERT_TRUE(fn_name, stats.size <= 3);
+		ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.in_use));
+		ASSERT_EQUAL(fn_name, 1 + num_threads * inserts_per_thread, static_cast<int>(stats.acquired));
+		ASSERT_EQUAL(fn_name, 0, static_cast<int>(stats.timeouts));
+
+		auto lease = pool.Acquire();
+		ASSERT_TRUE(fn_name, lease.has_value());
+		auto rows = (*lease)->ExecuteSTMT("count_concurrent");
+		ASSERT_TRUE(fn_name, rows.has_value());
+		ASSERT_EQUAL(fn_name, num_threads * inserts_per_thread, rows.value()[0][0].Get<int>());
+	}
+
+	std::filesystem::remove(db_path, ec);
+	RETURN_TEST(fn_name, 0);
+}
+
+int connection_pool_limits_test() {
+	const std::string fn_name = "connection_pool_limits_test";
+	PoolOptions options;
+	options.max_size = 1;
+	options.idle_timeout = std::chrono::milliseconds(20);
+	ConnectionPool<TestMemoryDatabase> pool([] { return std::make_unique<TestMemoryDatabase>(); }, options);
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(pool.Stats().size));
+
+	{
+		auto held = pool.Acquire();
+		ASSERT_TRUE(fn_name, held.has_value());
+		ASSERT_FALSE(fn_name, pool.TryAcquire().has_value());
+		ASSERT_FALSE(fn_name, pool.Acquire(std::chrono::milliseconds(10)).has_value());
+		ASSERT_EQUAL(fn_name, 1, static_cast<int>(pool.Stats().timeouts));
+		ASSERT_EQUAL(fn_name, 1.0, pool.Stats().Utilization());
+
+		// A connection released disconnected is closed, not reused
+		(*held)->Disconnect();
+	}
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(pool.Stats().size));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(pool.Stats().health_failures));
+
+	{
+		auto lease = pool.TryAcquire();
+		ASSERT_TRUE(fn_name, lease.has_value());
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(40));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(pool.EvictIdle()));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(pool.Stats().size));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(pool.Stats().created));
+	RETURN_TEST(fn_name, 0);
+}
+
+int view_bind_test() {
+	const std::string fn_name = "view_bind_test";
+	TestMemoryDatabase db;
+	db.Connect();
+
+	// Views are bound in place, owned strings keep embedded NULs
+	const std::string source = std::string("viewed") + '\0' + "text";
+	const std::string_view text(source);
+	const std::vector<std::byte> bytes{std::byte{0}, std::byte{0x7F}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_user", text.substr(0, 6), std::string_view("view@example.com")).has_value());
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", std::span<const std::byte>(bytes)).has_value());
+	auto echoed = db.Query("SELECT ?, length(CAST(? AS BLOB)), ?;", text, source, std::span<const std::byte>(bytes).first(2));
+	ASSERT_TRUE(fn_name, echoed.has_value());
+	ASSERT_TRUE(fn_name, (*echoed)[0][0].Get<std::string>() == source);
+	ASSERT_EQUAL(fn_name, static_cast<int>(source.size()), (*echoed)[0][1].Get<int>());
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>((*echoed)[0][2].Get<std::vector<std::byte>>().size()));
+
+	auto user = db.Query("SELECT name FROM users WHERE email = ?;", std::string_view("view@example.com"));
+	ASSERT_TRUE(fn_name, user.has_value());
+	ASSERT_EQUAL(fn_name, "viewed", (*user)[0][0].Get<std::string>());
+	auto blob = db.Query("SELECT data FROM blobs WHERE data = ?;", std::span<const std::byte>(bytes));
+	ASSERT_TRUE(fn_name, blob.has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(blob->Count()));
+	ASSERT_TRUE(fn_name, (*blob)[0][0].Get<std::vector<std::byte>>() == bytes);
+	RETURN_TEST(fn_name, 0);
+}
+
+int value_layout_test() {
+	const std::string fn_name = "value_layout_test";
+	ASSERT_EQUAL(fn_name, 16, static_cast<int>(sizeof(Value)));
+
+	// Inline and heap payloads survive copies and moves
+	const std::string longer(100, 'x');
+	Value inline_text("short text");
+	Value heap_text(longer);
+	Value copy = heap_text;
+	Value moved = std::move(copy);
+	ASSERT_TRUE(fn_name, copy.IsNull());
+	ASSERT_EQUAL(fn_name, longer, moved.Get<std::string>());
+	ASSERT_TRUE(fn_name, moved == heap_text);
+	moved = inline_text;
+	ASSERT_EQUAL(fn_name, "short text", moved.Get<std::string>());
+	ASSERT_FALSE(fn_name, moved == heap_text);
+
+	// Views stay views until detached
+	std::string source(40, 'v');
+	Value view{std::string_view(source)};
+	ASSERT_TRUE(fn_name, view.IsView());
+	view.Detach();
+	source.assign(40, 'w');
+	ASSERT_FALSE(fn_name, view.IsView());
+	ASSERT_EQUAL(fn_name, std::string(40, 'v'), view.Get<std::string>());
+
+	// Long rvalue strings and vectors are adopted, not copied
+	std::string adopted_text(64, 'a');
+	const char* text_data = adopted_text.data();
+	Value adopted(std::move(adopted_text));
+	ASSERT_TRUE(fn_name, adopted.Get<std::string_view>().data() == text_data);
+	Value adopted_copy = adopted;
+	ASSERT_FALSE(fn_name, adopted_copy.Get<std::string_view>().data() == text_data);
+	ASSERT_TRUE(fn_name, adopted_copy == adopted);
+	std::vector<std::byte> adopted_bytes(32, std::byte{3});
+	const std::byte* bytes_data = adopted_bytes.data();
+	Value adopted_blob(std::move(adopted_bytes));
+	Value adopted_moved = std::move(adopted_blob);
+	ASSERT_TRUE(fn_name, adopted_moved.Get<std::span<const std::byte>>().data() == bytes_data);
+	ASSERT_EQUAL(fn_name, 32, static_cast<int>(adopted_moved.PayloadSize()));
+
+	const std::vector<std::byte> bytes(20, std::byte{7});
+	ASSERT_TRUE(fn_name, Value::CopyBlob(bytes) == Value(bytes));
+	ASSERT_EQUAL(fn_name, 5000000000L, Value(5000000000L).Get<long int>());
+	ASSERT_EQUAL(fn_name, 2.5, Value(2.5).Get<double>());
+	ASSERT_TRUE(fn_name, Value(true).Get<bool>());
+	ASSERT_FALSE(fn_name, Value(1) == Value(1L));
+	RETURN_TEST(fn_name, 0);
+}
+
+int statement_stats_test() {
+	const std::string fn_name = "statement_stats_test";
+	TestMemoryDatabase db;
+	db.Connect();
+	for (int i = 0; i < 3; i++)
+		ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_TRUE(fn_name, db.select_order_by_user.Execute(1).has_value());
+	const std::string count_sql = "SELECT COUNT(*) FROM users;";
+	ASSERT_TRUE(fn_name, db.Query(count_sql).has_value());
+	ASSERT_TRUE(fn_name, db.Query(count_sql).has_value());
+	ASSERT_FALSE(fn_name, db.Query("SELECT * FROM missing_table;").has_value());
+	ASSERT_TRUE(fn_name, db.Query("SELECT name FROM users WHERE id = ?;", 1).has_value());
+
+	auto stats = db.Stats();
+	const auto* users = stats.Find("select_users");
+	ASSERT_TRUE(fn_name, users != nullptr);
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(users->calls));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(users->errors));
+	ASSERT_EQUAL(fn_name, 6, static_cast<int>(users->rows));
+	// Alice, alice@example.com, Bob, bob@example.com per execution
+	ASSERT_EQUAL(fn_name, 120, static_cast<int>(users->bytes));
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(users->execute.count));
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(users->decode.count));
+	ASSERT_TRUE(fn_name, users->execute.Percentile(0.5) <= std::chrono::nanoseconds(users->execute.max_ns));
+
+	const auto* handle = stats.Find("select_order_by_user");
+	ASSERT_TRUE(fn_name, handle != nullptr);
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(handle->calls));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(handle->rows));
+
+	const auto* count = stats.Find(count_sql, StatementKind::Query);
+	ASSERT_TRUE(fn_name, count != nullptr);
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(count->calls));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(count->rows));
+	const auto* missing = stats.Find("SELECT * FROM missing_table;", StatementKind::Query);
+	ASSERT_TRUE(fn_name, missing != nullptr);
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(missing->errors));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(missing->decode.count));
+	const auto* cached = stats.Find("SELECT name FROM users WHERE id = ?;", StatementKind::Query);
+	ASSERT_TRUE(fn_name, cached != nullptr);
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(cached->calls));
+
+	const std::string prometheus = stats.ToPrometheus();
+	ASSERT_TRUE(fn_name, prometheus.find("stormbyte_database_statement_calls_total{statement=\"select_users\",kind=\"prepared\"} 3\n") != std::string::npos);
+	ASSERT_TRUE(fn_name, prometheus.find("stormbyte_database_statement_execute_seconds_bucket{statement=\"select_users\",kind=\"prepared\",le=\"+Inf\"} 3\n") != std::string::npos);
+	ASSERT_TRUE(fn_name, prometheus.find("# TYPE stormbyte_database_statement_decode_seconds histogram") != std::string::npos);
+	const std::string json = stats.ToJson();
+	ASSERT_TRUE(fn_name, json.find("{\"name\":\"select_users\",\"kind\":\"prepared\",\"calls\":3,\"errors\":0,\"rows\":6,\"bytes\":120,") != std::string::npos);
+
+	// Disabled statistics are not recorded; reset clears them
+	db.SetStatsEnabled(false);
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_TRUE(fn_name, db.Query(count_sql).has_value());
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(db.Stats().Find("select_users")->calls));
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(db.Stats().Find(count_sql, StatementKind::Query)->calls));
+	db.SetStatsEnabled(true);
+	db.ResetStats();
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(db.Stats().Find("select_users")->calls));
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(db.Stats().Find("select_users")->calls));
+	RETURN_TEST(fn_name, 0);
+}
+
+int latency_histogram_test() {
+	const std::string fn_name = "latency_histogram_test";
+	for (std::size_t bucket = 0; bucket < LatencyStats::Buckets; bucket++)
+		ASSERT_EQUAL(fn_name, static_cast<int>(bucket), static_cast<int>(LatencyStats::BucketOf(LatencyStats::LowerBound(bucket))));
+	ASSERT_EQUAL(fn_name, static_cast<int>(LatencyStats::Buckets - 1), static_cast<int>(LatencyStats::BucketOf(~std::uint64_t{0})));
+
+	LatencyHistogram histogram;
+	for (std::uint64_t ns = 1; ns <= 10000; ns++)
+		histogram.Record(ns * 1000);
+	const LatencyStats stats = histogram.Snapshot();
+	ASSERT_EQUAL(fn_name, 10000, static_cast<int>(stats.count));
+	ASSERT_EQUAL(fn_name, 10000000, static_cast<int>(stats.max_ns));
+	ASSERT_EQUAL(fn_name, 5000500, static_cast<int>(stats.Mean().count()));
+	// Log-linear buckets: within 12.5% of the exact quantile
+	const auto p50 = stats.Percentile(0.5).count();
+	const auto p99 = stats.Percentile(0.99).count();
+	ASSERT_TRUE(fn_name, p50 >= 5000000 && p50 <= 5625000);
+	ASSERT_TRUE(fn_name, p99 >= 9900000 && p99 <= 10000000);
+	ASSERT_EQUAL(fn_name, 10000000, static_cast<int>(stats.Percentile(1.0).count()));
+	histogram.Reset();
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(histogram.Snapshot().count));
+	RETURN_TEST(fn_name, 0);
+}
+
+int slow_query_log_test() {
+	const std::string fn_name = "slow_query_log_test";
+	std::ostringstream output;
+	TestMemoryDatabase db(std::make_shared<StormByte::Logger::Log>(output, StormByte::Logger::Level::Warning));
+	db.Connect();
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(db.SlowQueries().reported));
+
+	// The first slow execution gets its plan; later ones within the interval do not
+	db.SetSlowQueryThreshold(std::chrono::nanoseconds(1));
+	ASSERT_TRUE(fn_name, db.select_order_by_user.Execute(2).has_value());
+	ASSERT_TRUE(fn_name, db.Query("SELECT name FROM users WHERE name = ?;", "O'Brien").has_value());
+	auto slow = db.SlowQueries();
+	ASSERT_EQUAL(fn_name, 2, static_cast<int>(slow.reported));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(slow.plans));
+	ASSERT_EQUAL(fn_name, 1, static_cast<int>(slow.plans_skipped));
+	std::string log = output.str();
+	ASSERT_TRUE(fn_name, log.find("Slow statement 'select_order_by_user' took ") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("SELECT product_id, quantity FROM orders WHERE user_id = ?; [parameters: 2]\nPlan:\n") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("SCAN") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("Slow query took ") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("WHERE name = ?; [parameters: 'O''Brien'] (plan not captured: rate limited)") != std::string::npos);
+
+	// Without a rate limit every successful execution is explained; failed ones never are
+	SlowQueryOptions options;
+	options.threshold = std::chrono::nanoseconds(1);
+	options.plan_interval = std::chrono::milliseconds(0);
+	options.max_parameter_length = 4;
+	db.SetSlowQueryOptions(options);
+	output.str("");
+	const std::vector<std::byte> blob{std::byte{0x01}, std::byte{0xAB}, std::byte{0xFF}};
+	ASSERT_TRUE(fn_name, db.ExecuteSTMT("insert_blob", blob).has_value());
+	ASSERT_TRUE(fn_name, db.insert_product.Execute("Keyboard", 49.5).has_value());
+	ASSERT_FALSE(fn_name, db.Query("SELECT * FROM missing_table;").has_value());
+	slow = db.SlowQueries();
+	ASSERT_EQUAL(fn_name, 5, static_cast<int>(slow.reported));
+	ASSERT_EQUAL(fn_name, 3, static_cast<int>(slow.plans));
+	ASSERT_EQUAL(fn_name, 0, static_cast<int>(slow.plan_errors));
+	log = output.str();
+	ASSERT_TRUE(fn_name, log.find("[parameters: X'01ab'... (3 bytes)]") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("[parameters: 'Keyb'... (8 bytes), 49.5]") != std::string::npos);
+	ASSERT_TRUE(fn_name, log.find("Slow query failed after ") != std::string::npos);
+
+	// A zero threshold turns the log off
+	db.SetSlowQueryThreshold(std::chrono::nanoseconds(0));
+	ASSERT_TRUE(fn_name, db.get_users().has_value());
+	ASSERT_EQUAL(fn_name, 5, static_cast<int>(db.SlowQueries().reported));
+	RETURN_TEST(fn_name, 0);
+}
+
 int main() {
 	int result = 0;
 
@@ -465,6 +1395,29 @@ int main() {
 	result += unknown_stmt_test();
 	result += name_access_test();
 	result += name_access_missing_column();
+	result += shared_schema_test();
+	result += column_ref_test();
+	result += arena_storage_test();
+	result += execute_as_tuple_test();
+	result += execute_as_struct_test();
+	result += typed_statement_test();
+	result += execute_batch_test();
+	result += columnar_kernels_test();
+	result += execute_columnar_test();
+	result += query_stream_test();
+	result += query_stream_error_test();
+	result += execute_stream_test();
+	result += execute_stream_unknown_stmt_test();
+	result += async_query_test();
+	result += reactor_test();
+	result += event_loop_unwatchable_test();
+	result += statement_cache_test();
+	result += blob_stream_test();
+	result += view_bind_test();
+	result += value_layout_test();
+	result += statement_stats_test();
+	result += latency_histogram_test();
+	result += slow_query_log_test();
 	result += transaction_commit_test();
 	result += transaction_rollback_explicit();
 	result += transaction_rollback_auto();
@@ -472,6 +1425,8 @@ int main() {
 	result += isolation_serializable();
 	result += isolation_repeatable_read();
 	result += concurrent_multiple_connections();
+	result += connection_pool_test();
+	result += connection_pool_limits_test();
 
 	if (result == 0) {
 		std::cout << "All tests passed successfully.\n";